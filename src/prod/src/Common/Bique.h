@@ -17,6 +17,20 @@ namespace Common
     typedef size_t sequence_t;
     typedef ptrdiff_t seq_diff_t;
 
+    //
+    // Optional source of bique buffer memory, e.g. a pool of fixed size blocks. Allocate
+    // may return nullptr when it cannot serve the requested size, heap is used instead.
+    // Buffers may outlive the bique, so the allocator must outlive all buffers it served.
+    //
+    class IBufferAllocator
+    {
+    public:
+        virtual ~IBufferAllocator() = default;
+
+        virtual void * Allocate(size_t size) = 0;
+        virtual void Free(void * mem) = 0;
+    };
+
     namespace detail
     {
         class BufferData
@@ -104,7 +118,7 @@ namespace Common
         public:
             intrusive::list_entry link_;
 
-            static this_type * Create( sequence_t start, size_t num_elements )
+            static this_type * Create( sequence_t start, size_t num_elements, IBufferAllocator * allocator = nullptr )
             {
                 // Workaround for PREfast bug; use static_cast<size_t> here
                 size_t offset = std::max( sizeof( this_type ), static_cast<size_t>(__alignof( T )));
@@ -116,17 +130,22 @@ namespace Common
                 if (FAILED(SizeTAdd(offset, allocationSize, &allocationSize)))
                     throw std::bad_alloc();
 
-                void* mem = HeapAlloc( GetProcessHeap(), HEAP_GENERATE_EXCEPTIONS, allocationSize);
+                void* mem = ( allocator != nullptr ) ? allocator->Allocate( allocationSize ) : nullptr;
                 if ( mem == nullptr )
-                    throw std::bad_alloc();
+                {
+                    allocator = nullptr;
+                    mem = HeapAlloc( GetProcessHeap(), HEAP_GENERATE_EXCEPTIONS, allocationSize);
+                    if ( mem == nullptr )
+                        throw std::bad_alloc();
+                }
 
                 T * data = reinterpret_cast<T*>(( byte* )mem + offset );
 
-                return new( mem ) this_type( start, num_elements, data );
+                return new( mem ) this_type( start, num_elements, data, allocator );
             }
 
-            BufferListEntry( sequence_t start, size_t num_elements, T* data )
-                : sequence_( start ), size_( num_elements ), data_( data )
+            BufferListEntry( sequence_t start, size_t num_elements, T* data, IBufferAllocator * allocator )
+                : sequence_( start ), size_( num_elements ), data_( data ), allocator_( allocator )
             {}
 
             T & at( sequence_t pos ) { return data_[pos - sequence_]; }
@@ -147,14 +166,24 @@ namespace Common
         protected:
             void OnDestroy()
             {
+                IBufferAllocator * allocator = allocator_;
                 this->~BufferListEntry();
-                HeapFree( GetProcessHeap(), 0, this );
+
+                if ( allocator != nullptr )
+                {
+                    allocator->Free( this );
+                }
+                else
+                {
+                    HeapFree( GetProcessHeap(), 0, this );
+                }
             }
 
         private:
             T * data_;
             sequence_t sequence_;
             size_t size_;
+            IBufferAllocator * allocator_;
         };
 
         template <class T> class BufferList
@@ -172,12 +201,14 @@ namespace Common
                 : capacity_( 0 )
                 , DEFAULT_BUFFER_SIZE( buffer_size )
                 , desired_capacity_( DEFAULT_BUFFER_SIZE * 2 ) 
+                , allocator_( nullptr )
             {}
 
             BufferList(BufferList && other)
                 : capacity_( other.capacity_ )
                 , DEFAULT_BUFFER_SIZE( other.DEFAULT_BUFFER_SIZE )
                 , desired_capacity_(other.desired_capacity_) 
+                , allocator_( other.allocator_ )
             {
                 q_.swap(other.q_);
                 other.capacity_ = 0;
@@ -202,6 +233,7 @@ namespace Common
                     capacity_ = other.capacity_;
                     DEFAULT_BUFFER_SIZE = other.DEFAULT_BUFFER_SIZE;
                     desired_capacity_ = other.desired_capacity_;    
+                    allocator_ = other.allocator_;
                     other.capacity_ = 0;
                 }
 
@@ -221,7 +253,7 @@ namespace Common
                 {
                     size_t size = DEFAULT_BUFFER_SIZE;
 
-                    BufferRef * p = BufferRef::Create( sequence, size );
+                    BufferRef * p = BufferRef::Create( sequence, size, allocator_ );
 
                     q_.push_back( p );
 
@@ -292,6 +324,7 @@ namespace Common
             size_t capacity() const { return capacity_; }
             size_t desired_capacity() const { return desired_capacity_; }
             void desired_capacity( size_t desired ) { desired_capacity_ = desired; }
+            void set_allocator( IBufferAllocator * allocator ) { allocator_ = allocator; }
 
         private:
             friend void UnsafeClearForMove(BufferList && bl )
@@ -323,6 +356,7 @@ namespace Common
             size_t capacity_;         // end() - begin()
             size_t DEFAULT_BUFFER_SIZE;
             size_t desired_capacity_;
+            IBufferAllocator * allocator_;
         };
     }
 
@@ -557,6 +591,12 @@ namespace Common
             chain_.desired_capacity( desired_capacity );
         }
 
+        // buffers allocated after this call come from allocator, see IBufferAllocator
+        void set_buffer_allocator( IBufferAllocator * allocator )
+        {
+            chain_.set_allocator( allocator );
+        }
+
         void WriteTo( TextWriter &w, Common::FormatOptions const& ) const
         {
             w.Write( "start {0} size {1} desired {2} chain_ {3}", 
@@ -74,6 +74,15 @@ void EventLoopPool::SetSchedParam(int policy, int priority)
     }
 }
 
+void EventLoopPool::SetCpuAffinity(int cpu)
+{
+    WriteInfo(TracePool, id_, "pinning loop threads to cpu {0}", cpu);
+    for(auto const & loop : pool_)
+    {
+        loop->SetCpuAffinity(cpu);
+    }
+}
+
 EventLoop* EventLoopPool::Assign_CallerHoldingLock()
 {
     auto* result = &(*(pool_[assignmentIndex_]));
@@ -113,10 +122,11 @@ class EventLoop::FdContext
 public:
     typedef std::shared_ptr<FdContext> SPtr;
 
-    FdContext(int fd, uint events, Callback const & cb, bool dispatchEventAsync);
+    FdContext(int fd, uint events, Callback const & cb, bool dispatchEventAsync, bool retainOnError);
 
     int Fd() const;
     uint Events() const;
+    bool RetainOnError() const;
     void FireEvent(uint event);
     void Close(bool waitForCallback);
 
@@ -130,6 +140,7 @@ private:
     const uint events_;
     const Callback cb_;
     const bool dispatchEventAsync_;
+    const bool retainOnError_;
     std::atomic_int cbRunning_ {1};
     ManualResetEvent closedEvent_;
 };
@@ -175,6 +186,24 @@ void EventLoop::SetSchedParam(int policy, int priority)
     }
 }
 
+void EventLoop::SetCpuAffinity(int cpu)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    auto retval = pthread_setaffinity_np(tid_, sizeof(cpuSet), &cpuSet);
+    if (retval)
+    {
+        WriteWarning(
+            TraceLoop,
+            id_,
+            "failed to set cpu affinity on loop thread: pthread_t={0:x}, cpu = {1}, error = {2}",
+            tid_,
+            cpu,
+            retval);
+    }
+}
+
 void* EventLoop::PthreadFunc(void *arg)
 {
     ((EventLoop*)arg)->Loop();
@@ -223,11 +252,14 @@ void EventLoop::Loop()
                 bool(evt & EPOLLHUP),
                 bool(evt & EPOLLERR));
 
-            if (errOrHup)
+            if ((evt & EPOLLHUP) || ((evt & EPOLLERR) && !fdc->RetainOnError()))
             {
                 // unregister with epoll otherwise EPOLLERR/EPOLLHUP will be reported
                 // again at next call of epoll_wait. It is okay to unregister on EPOLLHUP
-                // because read and write events are registered to seperate EventLoop instances
+                // because read and write events are registered to seperate EventLoop instances.
+                // EPOLLERR is left registered when requested, as it may only indicate pending
+                // error queue notifications, EPOLLONESHOT keeps it from being reported again
+                // until the callback activates fdc
                 epoll_ctl(epfd_, EPOLL_CTL_DEL, fdc->Fd(), nullptr);
             }
 
@@ -245,9 +277,9 @@ void EventLoop::Cleanup()
     fdMapSize_ = fdMap_.size();
 }
 
-EventLoop::FdContext* EventLoop::RegisterFd(int fd, uint events, bool dispatchEventAsync, Callback const & cb)
+EventLoop::FdContext* EventLoop::RegisterFd(int fd, uint events, bool dispatchEventAsync, Callback const & cb, bool retainOnError)
 {
-    auto ctx = make_shared<FdContext>(fd, events, cb, dispatchEventAsync);
+    auto ctx = make_shared<FdContext>(fd, events, cb, dispatchEventAsync, retainOnError);
     {
         AcquireWriteLock grab(lock_);
 
@@ -269,9 +301,14 @@ EventLoop::FdContext* EventLoop::RegisterFd(int fd, uint events, bool dispatchEv
 
 ErrorCode EventLoop::Activate(FdContext* fdc)
 {
-    WriteNoise(TraceLoop, id_, "Activate({0})", *fdc);
+    return Activate(fdc, fdc->Events());
+}
 
-    epoll_event ev = { .events = fdc->Events()};
+ErrorCode EventLoop::Activate(FdContext* fdc, uint events)
+{
+    WriteNoise(TraceLoop, id_, "Activate({0}, events={1:x})", *fdc, events);
+
+    epoll_event ev = { .events = events | defaultEventMask };
     ev.data.ptr = fdc;
 
     ErrorCode error;
@@ -324,8 +361,8 @@ void EventLoop::UnregisterFd(FdContext* fdc, bool waitForCallback)
         CommonConfig::GetConfig().EventLoopCleanupDelay);
 }
 
-EventLoop::FdContext::FdContext(int fd, uint events, Callback const & cb, bool dispatchEventAsync)
-    : fd_(fd), events_(events | defaultEventMask), cb_(cb), dispatchEventAsync_(dispatchEventAsync)
+EventLoop::FdContext::FdContext(int fd, uint events, Callback const & cb, bool dispatchEventAsync, bool retainOnError)
+    : fd_(fd), events_(events | defaultEventMask), cb_(cb), dispatchEventAsync_(dispatchEventAsync), retainOnError_(retainOnError)
 {
     WriteInfo(TraceLoop, "FdContext ctor: {0}", *this);
 }
@@ -340,6 +377,11 @@ uint EventLoop::FdContext::Events() const
     return events_;
 }
 
+bool EventLoop::FdContext::RetainOnError() const
+{
+    return retainOnError_;
+}
+
 int EventLoop::FdContext::CallbackRunningDec()
 {
     auto after = --cbRunning_;
@@ -393,5 +435,5 @@ void EventLoop::FdContext::Close(bool waitForCallback)
 
 void EventLoop::FdContext::WriteTo(Common::TextWriter & w, Common::FormatOptions const &) const
 {
-    w.Write("(fdc={0},fd={1:x}, events={2:x}, dispatchEventAsync={3})", TextTraceThis, fd_, events_, dispatchEventAsync_);
+    w.Write("(fdc={0},fd={1:x}, events={2:x}, dispatchEventAsync={3}, retainOnError={4})", TextTraceThis, fd_, events_, dispatchEventAsync_, retainOnError_);
 }    
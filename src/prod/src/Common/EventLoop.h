@@ -16,14 +16,19 @@ namespace Common
         ~EventLoop();
 
         class FdContext;
-        FdContext* RegisterFd(int fd, uint events, bool dispatchEventAsync, Callback const & cb);
+        // retainOnError keeps fd registered on EPOLLERR, for sockets that receive notifications
+        // on the error queue (e.g. MSG_ZEROCOPY completions) and should not be treated as failed
+        FdContext* RegisterFd(int fd, uint events, bool dispatchEventAsync, Callback const & cb, bool retainOnError = false);
         void UnregisterFd(FdContext* fdc, bool waitForCallback);
 
         Common::ErrorCode Activate(FdContext* fdc);
+        // Arms fdc for the given events instead of the registered ones, EPOLLERR and EPOLLHUP are always reported
+        Common::ErrorCode Activate(FdContext* fdc, uint events);
 
         static bool IsFdClosedOrInError(uint events) { return events & (EPOLLERR|EPOLLHUP); }
 
         void SetSchedParam(int policy, int priority);
+        void SetCpuAffinity(int cpu);
 
     private:
         typedef std::unordered_map<int, std::shared_ptr<FdContext>> FdMap;
@@ -53,6 +58,7 @@ namespace Common
         void AssignPair(EventLoop** inLoop, EventLoop** outLoop);
 
         void SetSchedParam(int policy, int priority);
+        void SetCpuAffinity(int cpu);
 
         static EventLoopPool* GetDefault(); 
 
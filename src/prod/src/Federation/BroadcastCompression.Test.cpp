@@ -0,0 +1,136 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace FederationUnitTests
+{
+    using namespace std;
+    using namespace Common;
+    using namespace Transport;
+    using namespace Federation;
+
+    class BroadcastCompressionTests
+    {
+    protected:
+        static MessageUPtr CreateMessage(vector<byte> const & body);
+        static vector<byte> GetBody(Message & message);
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(BroadcastCompressionTestsSuite, BroadcastCompressionTests)
+
+    BOOST_AUTO_TEST_CASE(CompressAndDecompress)
+    {
+        vector<byte> body(64 * 1024);
+        for (size_t i = 0; i < body.size(); i++)
+        {
+            body[i] = static_cast<byte>(i % 16);
+        }
+
+        MessageUPtr message = CreateMessage(body);
+        message->Headers.Add(ActionHeader(L"BroadcastCompressionTest"));
+
+        VERIFY_IS_TRUE(BroadcastCompression::TryCompress(message, 1024));
+        VERIFY_IS_TRUE(message->SerializedBodySize() < body.size());
+        VERIFY_ARE_EQUAL(message->Action, L"BroadcastCompressionTest");
+
+        BroadcastCompressionHeader header;
+        VERIFY_IS_TRUE(message->Headers.TryReadFirst(header));
+        VERIFY_ARE_EQUAL(header.OriginalSize, static_cast<uint>(body.size()));
+
+        // Decompressing a clone leaves the original compressed for forwarding
+        MessageUPtr clone = message->Clone();
+        VERIFY_IS_TRUE(BroadcastCompression::TryDecompress(clone));
+        VERIFY_IS_FALSE(clone->Headers.TryReadFirst(header));
+        VERIFY_ARE_EQUAL(clone->Action, L"BroadcastCompressionTest");
+        VERIFY_IS_TRUE(GetBody(*clone) == body);
+
+        VERIFY_IS_TRUE(message->Headers.TryReadFirst(header));
+        VERIFY_IS_TRUE(message->SerializedBodySize() < body.size());
+    }
+
+    BOOST_AUTO_TEST_CASE(MessageStateIsPreserved)
+    {
+        vector<byte> body(64 * 1024, 1);
+
+        MessageUPtr message = CreateMessage(body);
+        message->Headers.Add(ActionHeader(L"BroadcastCompressionTest"));
+        message->Idempotent = true;
+        message->AddProperty(wstring(L"BroadcastCompressionTestProperty"));
+
+        VERIFY_IS_TRUE(BroadcastCompression::TryCompress(message, 1024));
+        VERIFY_IS_TRUE(message->Idempotent);
+        VERIFY_IS_TRUE(message->TryGetProperty<wstring>() != nullptr);
+
+        VERIFY_IS_TRUE(BroadcastCompression::TryDecompress(message));
+        VERIFY_IS_TRUE(message->Idempotent);
+        VERIFY_ARE_EQUAL(message->Action, L"BroadcastCompressionTest");
+
+        auto property = message->TryGetProperty<wstring>();
+        VERIFY_IS_TRUE(property != nullptr);
+        VERIFY_ARE_EQUAL(*property, L"BroadcastCompressionTestProperty");
+    }
+
+    BOOST_AUTO_TEST_CASE(SmallBodyIsNotCompressed)
+    {
+        vector<byte> body(100, 1);
+        MessageUPtr message = CreateMessage(body);
+        Message * original = message.get();
+
+        VERIFY_IS_FALSE(BroadcastCompression::TryCompress(message, 1024));
+        VERIFY_IS_FALSE(BroadcastCompression::TryCompress(message, 0));
+        VERIFY_IS_TRUE(message.get() == original);
+
+        // Messages without compression header are left alone
+        VERIFY_IS_TRUE(BroadcastCompression::TryDecompress(message));
+        VERIFY_IS_TRUE(message.get() == original);
+    }
+
+    BOOST_AUTO_TEST_CASE(IncompressibleBodyIsNotCompressed)
+    {
+        vector<byte> body(4096);
+        uint64 value = 0x9E3779B97F4A7C15ull;
+        for (size_t i = 0; i < body.size(); i++)
+        {
+            value ^= value << 13;
+            value ^= value >> 7;
+            value ^= value << 17;
+            body[i] = static_cast<byte>(value);
+        }
+
+        MessageUPtr message = CreateMessage(body);
+        VERIFY_IS_FALSE(BroadcastCompression::TryCompress(message, 1024));
+        VERIFY_IS_TRUE(GetBody(*message) == body);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    MessageUPtr BroadcastCompressionTests::CreateMessage(vector<byte> const & body)
+    {
+        auto buffer = new vector<byte>(body);
+        vector<const_buffer> buffers(1, const_buffer(buffer->data(), buffer->size()));
+        return make_unique<Message>(
+            buffers,
+            [] (vector<const_buffer> const &, void * state) { delete static_cast<vector<byte>*>(state); },
+            buffer);
+    }
+
+    vector<byte> BroadcastCompressionTests::GetBody(Message & message)
+    {
+        vector<const_buffer> buffers;
+        message.GetBody(buffers);
+
+        vector<byte> body;
+        for (auto const & buffer : buffers)
+        {
+            body.insert(body.end(), buffer.cbegin(), buffer.cend());
+        }
+
+        return body;
+    }
+}
@@ -0,0 +1,148 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+using namespace Federation;
+using namespace Transport;
+using namespace Common;
+using namespace std;
+
+bool BroadcastCompression::TryCompress(__inout MessageUPtr & message, size_t threshold)
+{
+    size_t originalSize = message->SerializedBodySize();
+    if (threshold == 0 || originalSize < threshold)
+    {
+        return false;
+    }
+
+#ifdef PLATFORM_UNIX
+    vector<const_buffer> buffers;
+    message->GetBody(buffers);
+
+    z_stream stream = {};
+    if (deflateInit(&stream, Z_BEST_SPEED) != Z_OK)
+    {
+        return false;
+    }
+
+    vector<byte> compressed(deflateBound(&stream, static_cast<uLong>(originalSize)));
+    stream.next_out = compressed.data();
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    int result = Z_OK;
+    for (auto const & buffer : buffers)
+    {
+        if (buffer.len == 0)
+        {
+            continue;
+        }
+
+        stream.next_in = reinterpret_cast<Bytef *>(buffer.buf);
+        stream.avail_in = static_cast<uInt>(buffer.len);
+
+        result = deflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK)
+        {
+            break;
+        }
+    }
+
+    if (result == Z_OK)
+    {
+        result = deflate(&stream, Z_FINISH);
+    }
+
+    size_t compressedSize = stream.total_out;
+    deflateEnd(&stream);
+
+    if (result != Z_STREAM_END || compressedSize >= originalSize)
+    {
+        return false;
+    }
+
+    compressed.resize(compressedSize);
+
+    MessageUPtr compressedMessage = CreateMessage(*message, move(compressed));
+    compressedMessage->Headers.Add(BroadcastCompressionHeader(static_cast<uint>(originalSize)));
+    message = move(compressedMessage);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool BroadcastCompression::TryDecompress(__inout MessageUPtr & message)
+{
+    BroadcastCompressionHeader header;
+    if (!message->Headers.TryReadFirst(header))
+    {
+        return true;
+    }
+
+#ifdef PLATFORM_UNIX
+    vector<const_buffer> buffers;
+    message->GetBody(buffers);
+
+    z_stream stream = {};
+    if (inflateInit(&stream) != Z_OK)
+    {
+        return false;
+    }
+
+    vector<byte> body(header.OriginalSize);
+    stream.next_out = body.data();
+    stream.avail_out = static_cast<uInt>(body.size());
+
+    int result = Z_OK;
+    for (auto const & buffer : buffers)
+    {
+        if (buffer.len == 0)
+        {
+            continue;
+        }
+
+        stream.next_in = reinterpret_cast<Bytef *>(buffer.buf);
+        stream.avail_in = static_cast<uInt>(buffer.len);
+
+        result = inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK)
+        {
+            break;
+        }
+    }
+
+    size_t decompressedSize = stream.total_out;
+    inflateEnd(&stream);
+
+    if (result != Z_STREAM_END || decompressedSize != body.size())
+    {
+        return false;
+    }
+
+    // Headers are copied into the new message, so removing the header does not affect
+    // clones of the compressed message that are still being forwarded. Idempotence,
+    // properties, security context and receive time are preserved as in Message::Clone.
+    MessageUPtr decompressedMessage = CreateMessage(*message, move(body));
+    decompressedMessage->Headers.TryRemoveHeader<BroadcastCompressionHeader>();
+    message = move(decompressedMessage);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+MessageUPtr BroadcastCompression::CreateMessage(__in Message & from, vector<byte> && body)
+{
+    auto bodyBuffer = new vector<byte>(move(body));
+    vector<const_buffer> buffers(1, const_buffer(bodyBuffer->data(), bodyBuffer->size()));
+
+    return from.Clone(
+        buffers,
+        [] (vector<const_buffer> const &, void * state) { delete static_cast<vector<byte>*>(state); },
+        bodyBuffer);
+}
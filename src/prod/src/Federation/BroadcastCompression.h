@@ -0,0 +1,30 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Federation
+{
+    // Compresses broadcast message bodies once at the broadcasting node, so that all the
+    // copies forwarded through the broadcast tree share the smaller body. The body is
+    // decompressed only for local dispatch. Compression is only supported on Linux.
+    class BroadcastCompression
+    {
+        DENY_COPY(BroadcastCompression);
+
+    public:
+        // Replaces the message with a copy that has a compressed body and a BroadcastCompressionHeader,
+        // returns false and leaves the message unchanged when the body is smaller than threshold or
+        // does not get smaller.
+        static bool TryCompress(__inout Transport::MessageUPtr & message, size_t threshold);
+
+        // Replaces the message with a copy that has the original body, if the message has a
+        // BroadcastCompressionHeader. Returns false if the body cannot be decompressed.
+        static bool TryDecompress(__inout Transport::MessageUPtr & message);
+
+    private:
+        static Transport::MessageUPtr CreateMessage(__in Transport::Message & from, std::vector<byte> && body);
+    };
+}
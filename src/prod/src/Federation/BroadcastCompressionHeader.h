@@ -0,0 +1,38 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Federation
+{
+    // Marks a broadcast message whose body was compressed by the broadcasting node
+    class BroadcastCompressionHeader : public Transport::MessageHeader<Transport::MessageHeaderId::BroadcastCompression>, public Serialization::FabricSerializable
+    {
+    public:
+        BroadcastCompressionHeader()
+            : originalSize_(0)
+        {
+        }
+
+        explicit BroadcastCompressionHeader(uint originalSize)
+            : originalSize_(originalSize)
+        {
+        }
+
+        __declspec(property(get=get_OriginalSize)) uint OriginalSize;
+
+        uint get_OriginalSize() const { return this->originalSize_; }
+
+        void WriteTo(Common::TextWriter & w, Common::FormatOptions const &) const
+        {
+            w << "[OriginalSize: " << this->originalSize_ << "]";
+        }
+
+        FABRIC_FIELDS_01(originalSize_);
+
+    private:
+        uint originalSize_;
+    };
+}
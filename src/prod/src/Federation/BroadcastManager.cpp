@@ -65,23 +65,35 @@ void BroadcastManager::OnTimer()
     this->reliableBroadcastContexts_.RemoveExpiredEntries();
 }
 
-BroadcastHeader BroadcastManager::AddBroadcastHeaders(__in Message & message, bool expectsReply, bool expectsAck)
+BroadcastHeader BroadcastManager::AddBroadcastHeaders(__inout MessageUPtr & message, bool expectsReply, bool expectsAck)
 {
-    MessageId id = message.MessageId;
+    MessageId id = message->MessageId;
     if (id.IsEmpty())
     {
         id = MessageId();
     }
     else
     {
-        message.Headers.TryRemoveHeader<MessageIdHeader>();
+        message->Headers.TryRemoveHeader<MessageIdHeader>();
     }
 
-    message.Idempotent = true;
+    message->Idempotent = true;
 
     auto header = BroadcastHeader(this->siteNode_.Instance, id, expectsReply, expectsAck, siteNode_.RingName);
 
-    message.Headers.Add(header);
+    message->Headers.Add(header);
+
+    // Compress once here, all the copies forwarded by this and other nodes share the compressed body
+    uint originalSize = message->SerializedBodySize();
+    if (BroadcastCompression::TryCompress(message, static_cast<size_t>(FederationConfig::GetConfig().BroadcastCompressionThreshold)))
+    {
+        WriteInfo(
+            TraceStart,
+            "Broadcast {0} body compressed from {1} to {2} bytes",
+            id,
+            originalSize,
+            message->SerializedBodySize());
+    }
 
     return header;
 }
@@ -93,13 +105,13 @@ void BroadcastManager::OnBroadcastCompleted(MessageId const & broadcastId)
 
 void BroadcastManager::Broadcast(MessageUPtr && message)
 {
-    auto header = this->AddBroadcastHeaders(*message, false, false);
+    auto header = this->AddBroadcastHeaders(message, false, false);
     this->InternalBroadcast(std::move(message), header);
 }
 
 AsyncOperationSPtr BroadcastManager::BeginBroadcast(MessageUPtr && message, bool toAllRings, AsyncCallback const & callback, AsyncOperationSPtr const & parent)
 {
-    auto header = this->AddBroadcastHeaders(*message, false, true);
+    auto header = this->AddBroadcastHeaders(message, false, true);
     WriteInfo(
         TraceStart,
         "Broadcast started for {0}",
@@ -121,7 +133,7 @@ ErrorCode BroadcastManager::EndBroadcast(AsyncOperationSPtr const & operation)
 
 IMultipleReplyContextSPtr BroadcastManager::BroadcastRequest(MessageUPtr && message, TimeSpan retryInterval)
 {
-    auto header = this->AddBroadcastHeaders(*message, true, false);
+    auto header = this->AddBroadcastHeaders(message, true, false);
 
     // It is the responsibility of the person making the broadcast to keep SiteNode alive for this context
     BroadcastReplyContextSPtr replyContext = make_shared<BroadcastReplyContext>(
@@ -213,6 +225,17 @@ bool BroadcastManager::DispatchBroadcastMessage(
     BroadcastHeader const & broadcastHeader,
     RequestReceiverContextUPtr && routedRequestContext)
 {
+    // Messages forwarded to other nodes keep the compressed body, only the local copy is decompressed
+    if (!BroadcastCompression::TryDecompress(message))
+    {
+        WriteError(
+            TraceFault,
+            "Could not decompress body at node {0} for message broadcast id {1}",
+            this->siteNode_.Instance,
+            broadcastHeader.BroadcastId);
+        return false;
+    }
+
     // An application may expect the same messageid it gave to a broadcast message on the other side, this is also useful for testing
     ASSERT_IF(!message->MessageId.IsEmpty(), "MessageId not removed for {0}", *message);
     message->Headers.Add(MessageIdHeader(broadcastHeader.BroadcastId));
@@ -41,7 +41,7 @@ namespace Federation
 
         void InternalBroadcast(Transport::MessageUPtr && message, BroadcastHeader const & header);
 
-        BroadcastHeader AddBroadcastHeaders(__in Transport::Message & message, bool expectsReply, bool expectsAck);
+        BroadcastHeader AddBroadcastHeaders(__inout Transport::MessageUPtr & message, bool expectsReply, bool expectsAck);
 
         void ProcessBroadcastMessage(__in Transport::MessageUPtr & message, PartnerNodeSPtr const & hopFrom);
 
@@ -92,6 +92,9 @@ namespace Federation
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Federation", BroadcastContextKeepDuration, Common::TimeSpan::FromSeconds(300), Common::ConfigEntryUpgradePolicy::Static);
         // The number of children in the broadcast spanning tree.
         INTERNAL_CONFIG_ENTRY(int, L"Federation", BroadcastPropagationFactor, 8, Common::ConfigEntryUpgradePolicy::Static, Common::GreaterThan(1));
+        // Broadcast message bodies of at least this many bytes are compressed once by the broadcasting node and
+        // forwarded compressed, 0 disables compression. Only enable after all nodes understand compressed broadcasts.
+        INTERNAL_CONFIG_ENTRY(int, L"Federation", BroadcastCompressionThreshold, 0, Common::ConfigEntryUpgradePolicy::Static, Common::NoLessThan(0));
         // The max number of nodes in each child of spanning tree.
         INTERNAL_CONFIG_ENTRY(int, L"Federation", MaxMulticastSubtreeSize, 1000, Common::ConfigEntryUpgradePolicy::Static, Common::GreaterThan(1));
 
@@ -215,6 +218,15 @@ namespace Federation
         INTERNAL_CONFIG_ENTRY(int, L"Federation", LeaseRetryCount, 3, Common::ConfigEntryUpgradePolicy::Static);
         // The starting point of first renew message within a lease interval; it is interpreted as 1 over LeaseRenewBeginRatio.
         INTERNAL_CONFIG_ENTRY(int, L"Federation", LeaseRenewBeginRatio, 6, Common::ConfigEntryUpgradePolicy::Static);
+        // Whether lease messages use an isolated I/O path on Linux: a single pair of event loop threads that is not shared
+        // with any other transport, optionally pinned and given real time priority, and prioritized sockets.
+        INTERNAL_CONFIG_ENTRY(bool, L"Federation", LeaseTransportIsolatedIo, false, Common::ConfigEntryUpgradePolicy::Static);
+        // The cpu the isolated lease event loop threads are pinned to, -1 means no pinning.
+        INTERNAL_CONFIG_ENTRY(int, L"Federation", LeaseTransportCpuAffinity, -1, Common::ConfigEntryUpgradePolicy::Static, Common::InRange<int>(-1, 1023));
+        // The SCHED_RR priority of the isolated lease event loop threads, 0 keeps the default scheduling policy.
+        INTERNAL_CONFIG_ENTRY(int, L"Federation", LeaseTransportSchedPriority, 0, Common::ConfigEntryUpgradePolicy::Static, Common::InRange<int>(0, 99));
+        // The SO_PRIORITY of isolated lease transport sockets, -1 keeps the system default.
+        INTERNAL_CONFIG_ENTRY(int, L"Federation", LeaseTransportSocketPriority, 6, Common::ConfigEntryUpgradePolicy::Static, Common::InRange<int>(-1, 6));
         // The TTL granted by lease driver to leasing applications.
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Federation", ApplicationLeaseDuration, Common::TimeSpan::FromSeconds(1), Common::ConfigEntryUpgradePolicy::Static);
         // The timeout for arbitration request.
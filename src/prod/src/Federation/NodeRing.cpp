@@ -133,6 +133,7 @@ namespace Federation
         }
 
         ring_.insert(ring_.begin() + position, node);
+        version_++;
 
         OnNodeAdded(node, position);
 
@@ -143,6 +144,7 @@ namespace Federation
     {
         PartnerNodeSPtr node = ring_[position];
         ring_.erase(ring_.begin() + position);
+        version_++;
 
         OnNodeRemoved(node, position);
     }
@@ -151,6 +153,7 @@ namespace Federation
     {
         PartnerNodeSPtr oldNode = ring_[position];
         ring_[position] = newNode;
+        version_++;
 
         OnNodeReplaced(oldNode, newNode, position);
     }
@@ -158,6 +161,7 @@ namespace Federation
     void NodeRingBase::Clear()
     {
         ring_.clear();
+        version_++;
     }
 
     void NodeRingBase::WriteTo(TextWriter& w, FormatOptions const&) const
@@ -193,6 +197,7 @@ namespace Federation
 
         ring_.clear();
         ring_.push_back(thisNode);
+        version_++;
 
         thisNode_ = 0;
     }
@@ -1014,6 +1019,7 @@ namespace Federation
         {
             nth_element(ring_.begin(), ring_.begin() + config.RoutingTableCapacity, ring_.end(), ComparePartnerNode);
             ring_.erase(ring_.begin() + config.RoutingTableCapacity, ring_.end());
+            version_++;
             lastCompactTime_ = DateTime::Now();
         }
 
@@ -13,11 +13,20 @@ namespace Federation
 
     public:
         NodeRingBase()
+            : version_(0)
+        {
+        }
+
+        /// <summary>
+        /// Create a ring that holds the same nodes as another ring
+        /// </summary>
+        explicit NodeRingBase(std::vector<PartnerNodeSPtr> const & nodes)
+            : ring_(nodes), version_(0)
         {
         }
 
         NodeRingBase(NodeRingBase && other)
-            : ring_(std::move(other.ring_))
+            : ring_(std::move(other.ring_)), version_(other.version_)
         {
         }
 
@@ -27,6 +36,18 @@ namespace Federation
         __declspec (property(get=getSize)) size_t Size;
         size_t getSize() const { return ring_.size(); }
 
+        /// <summary>
+        /// Return the nodes of the ring sorted by node id
+        /// </summary>
+        __declspec (property(get=getNodes)) std::vector<PartnerNodeSPtr> const & Nodes;
+        std::vector<PartnerNodeSPtr> const & getNodes() const { return ring_; }
+
+        /// <summary>
+        /// Return the number of changes made to the ring
+        /// </summary>
+        __declspec (property(get=getVersion)) uint64 Version;
+        uint64 getVersion() const { return version_; }
+
         /// <summary>
         /// Get a node at specified position
         /// </summary>
@@ -130,6 +151,11 @@ namespace Federation
         /// The ring data structure
         /// </summary>
         std::vector<PartnerNodeSPtr> ring_;
+
+        /// <summary>
+        /// Incremented whenever a node is added, removed or replaced
+        /// </summary>
+        uint64 version_;
     };
 
     /// <summary>
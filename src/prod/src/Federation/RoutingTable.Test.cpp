@@ -512,7 +512,7 @@ namespace FederationUnitTests
         NodeId node140(LargeInteger(0, 140));
         NodeId node150(LargeInteger(0, 150));
 
-		sitePtr->Test_SetToken(RoutingToken(NodeIdRange(LargeInteger(0, 96), LargeInteger(0, 105)), 1));
+		table.Test_SetToken(RoutingToken(NodeIdRange(LargeInteger(0, 96), LargeInteger(0, 105)), 1));
 
         // Check a routing hop arriving at the current node
         node = table.GetRoutingHop(NodeId(LargeInteger(0, 100)), L"", 0, ownsToken);
@@ -544,6 +544,43 @@ namespace FederationUnitTests
         FederationConfig::Test_Reset();
     }
 
+    BOOST_AUTO_TEST_CASE(RoutingTableSnapshotTest)
+    {
+        FederationConfig::Test_Reset();
+
+        SiteNodeSPtr sitePtr = CreateSiteNode(100);
+        OpenSiteNode(sitePtr);
+
+        RoutingTable & table = sitePtr->Table;
+
+        size_t tableNodes[] = {90, 110, 120};
+        FillTable(table, tableNodes, 3);
+
+        NodeId node110(LargeInteger(0, 110));
+        NodeId node120(LargeInteger(0, 120));
+
+        RoutingTableSnapshotSPtr snapshot = table.GetSnapshot();
+        VERIFY_IS_TRUE(snapshot->FindClosest(NodeId(LargeInteger(0, 118)), true)->Instance.Id == node120);
+
+        // Stale information does not modify the ring, so no new snapshot is published
+        table.Consider(CreateNodeHeader(120, NodePhase::Inserting));
+        VERIFY_IS_TRUE(table.GetSnapshot() == snapshot);
+
+        // Existing snapshots are not modified when a new one is published
+        table.SetShutdown(NodeInstance(node120, 1), L"");
+        RoutingTableSnapshotSPtr newSnapshot = table.GetSnapshot();
+        VERIFY_IS_TRUE(newSnapshot->Version > snapshot->Version);
+        VERIFY_IS_TRUE(newSnapshot->FindClosest(NodeId(LargeInteger(0, 118)), true)->Instance.Id == node110);
+        VERIFY_IS_TRUE(snapshot->FindClosest(NodeId(LargeInteger(0, 118)), true)->Instance.Id == node120);
+
+        PartnerNodeSPtr node = table.FindClosest(NodeId(LargeInteger(0, 118)), L"");
+        VERIFY_IS_TRUE(node->Instance.Id == node110);
+
+        CloseSiteNode(sitePtr);
+
+        FederationConfig::Test_Reset();
+    }
+
     BOOST_AUTO_TEST_CASE(RoutingTableGetHoodTest)
     {
         FederationConfig::Test_Reset();
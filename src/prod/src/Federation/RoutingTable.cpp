@@ -53,6 +53,8 @@ namespace Federation
         {
             oldTokenVersion_ = table.site_.Token.Version;
             oldNeighborhoodVersion_ = table.neighborhoodVersion_;
+            oldRingVersion_ = table.ring_.Version;
+            oldHoodRange_ = table.knownTable_.GetRange();
         }
 
         ~WriteLock()
@@ -69,6 +71,14 @@ namespace Federation
                     table_.OnRoutingTokenChanged((static_cast<uint>(oldTokenVersion_)) != table_.site_.Token.TokenVersion);
                 }
             }
+
+            // Publish all the changes made under this lock at once
+            if (oldRingVersion_ != table_.ring_.Version ||
+                oldTokenVersion_ != table_.site_.Token.Version ||
+                oldHoodRange_ != table_.knownTable_.GetRange())
+            {
+                table_.PublishSnapshot();
+            }
         }
 
     private:
@@ -76,6 +86,8 @@ namespace Federation
         RoutingTable & table_;
         uint64 oldTokenVersion_;
         uint oldNeighborhoodVersion_;
+        uint64 oldRingVersion_;
+        NodeIdRange oldHoodRange_;
     };
 
     class GapRequestAction : public StateMachineAction
@@ -208,7 +220,9 @@ namespace Federation
         isTestMode_(false),
         globalTimeManager_(*site, lock_),
         lastGlobalTimeUncertaintyIncreaseTime_(Stopwatch::Now()),
-        implicitLeaseContext_(*site)
+        implicitLeaseContext_(*site),
+        snapshot_(),
+        snapshotVersion_(0)
     {
         timer_ = Timer::Create(
             RoutingTableTimerTag,
@@ -217,6 +231,8 @@ namespace Federation
                 this->OnTimer();
             },
             true);
+
+        PublishSnapshot();
     }
 
     RoutingTable::~RoutingTable()
@@ -229,22 +245,52 @@ namespace Federation
         return ring_.GetRoutingNodeCount();
     }
 
+    void RoutingTable::Test_SetToken(RoutingToken const & token)
+    {
+        WriteLock grab(*this);
+        site_.Test_SetToken(token);
+        PublishSnapshot();
+    }
+
+    RoutingTableSnapshotSPtr RoutingTable::GetSnapshot() const
+    {
+        return std::atomic_load(&snapshot_);
+    }
+
+    void RoutingTable::PublishSnapshot()
+    {
+        RoutingTableSnapshotSPtr snapshot = make_shared<RoutingTableSnapshot>(
+            ++snapshotVersion_,
+            ring_,
+            knownTable_.ThisNodePtr,
+            knownTable_.GetRange(),
+            site_.Token);
+
+        std::atomic_store(&snapshot_, move(snapshot));
+    }
+
     PartnerNodeSPtr RoutingTable::FindClosest(NodeId const& value, wstring const & toRing) const
     {
+        if (site_.IsRingNameMatched(toRing))
+        {
+            return GetSnapshot()->FindClosest(value, site_.IsAvailable);
+        }
+
         AcquireReadLock grab(lock_);
         return InternalFindClosest(value, toRing, false);
     }
 
     PartnerNodeSPtr RoutingTable::GetRoutingHop(NodeId const& value, wstring const & toRing, bool safeMode, bool& ownsToken) const
     {
-        AcquireReadLock grab(lock_);
-        
-        ownsToken = (site_.IsRingNameMatched(toRing) && site_.Token.Contains(value));
-        if (ownsToken)
+        if (site_.IsRingNameMatched(toRing))
         {
-            return knownTable_.ThisNodePtr;
+            // Routing within the local ring uses the published snapshot and does not take the lock
+            return GetSnapshot()->GetRoutingHop(value, site_.IsAvailable, ownsToken);
         }
 
+        AcquireReadLock grab(lock_);
+
+        ownsToken = false;
         return InternalFindClosest(value, toRing, safeMode);
     }
 
@@ -277,111 +323,19 @@ namespace Federation
 
     PartnerNodeSPtr const& RoutingTable::InternalFindClosest(NodeId const& value, NodeRingBase const & ring) const
     {
-        if (ring.Size == 0)
-        {
-            return knownTable_.ThisNodePtr;
-        }
-
         bool isLocal = (&ring == &ring_);
-        size_t succOrSame = ring.FindSuccOrSamePosition(value);
-        size_t pred = ring.GetPred(succOrSame);
-
-        // to save the first routing (but may be unknown) node on both side, initialize them to avoid warning
-        size_t savedSuccOrSame = succOrSame;
-        size_t savedPred = pred;
-
-        // try to find an routing and known node in the successor side, 
-        // also save the first routing (but maybe unknown) node we found
-        bool found = false;
-        bool foundSuccRouting = false;
-        for (size_t i = 0; i < ring.Size; i++)
+        if (isLocal && site_.IsAvailable)
         {
-            PartnerNodeSPtr const& currentNode = ring.GetNode(succOrSame);
-
-            if (currentNode->IsRouting)
-            {
-                if (!foundSuccRouting)
-                {
-                    savedSuccOrSame = succOrSame;
-                    foundSuccRouting = true;
-                }
-
-                if (!currentNode->IsUnknown || (isLocal && site_.IsAvailable && knownTable_.WithinHoodRange(currentNode->Id)))
-                {
-                    found = true;
-                    break;
-                }
-            }
-
-            succOrSame = ring.GetSucc(succOrSame);
-        }
-
-        if (!foundSuccRouting)
-        {
-            // no routing node in the routing table
-            return (isLocal ? NullNode : knownTable_.ThisNodePtr);
-        }
-
-        // try to find an routing and known node in the predecessor side, 
-        // also save the first routing (but maybe unknown) node we found
-        bool foundPredRouting = false;
-
-        for (size_t i = 0; i < ring.Size; i++)
-        {
-            PartnerNodeSPtr const& currentNode = ring.GetNode(pred);
-
-            if (currentNode->IsRouting)
-            {
-                if (!foundPredRouting)
-                {
-                    savedPred = pred;
-                    foundPredRouting = true;
-                }
-
-                if (!currentNode->IsUnknown || (isLocal && site_.IsAvailable && knownTable_.WithinHoodRange(currentNode->Id)))
-                {
-                    break;
-                }
-            }
-
-            pred = ring.GetPred(pred);
-        }
-
-        ASSERT_IF(!foundPredRouting, "Found routing node in successor side but not in predecessor side");
-
-        if (found)
-        {
-            // found on successor side is equivalent to found on both side
-            PartnerNodeSPtr const& predNode = ring.GetNode(pred);
-            PartnerNodeSPtr const& succOrSameNode = ring.GetNode(succOrSame);
-
-            // Check which one has smallest distance,
-            // if the distances are same, return the predecessor.
-            // If the node to return equal to "this" node, don't return here
-            // but will check whether it is better than the saved unknown nodes
-            if (value.PredDist(predNode->Id) <= value.SuccDist(succOrSameNode->Id))
-            {
-                if (!isLocal || pred != ring_.ThisNode)
-                {
-                    return predNode;
-                }
-            }
-            else
-            {
-                if (!isLocal || succOrSame != ring_.ThisNode)
-                {
-                    return succOrSameNode;
-                }
-            }
+            NodeIdRange hoodRange = knownTable_.GetRange();
+            return RoutingTableSnapshot::FindClosest(value, ring, ring_.ThisNode, knownTable_.ThisNodePtr, &hoodRange);
         }
 
-        // if no routing and known node found, or the best routing and known node is "this" node
-        // we return the best one from the unknown routing nodes and "this" node
-        PartnerNodeSPtr const& savedPredNode = ring.GetNode(savedPred);
-        PartnerNodeSPtr const& savedSuccOrSameNode = ring.GetNode(savedSuccOrSame);
-        return (value.PredDist(savedPredNode->Id) <= 
-            value.SuccDist(savedSuccOrSameNode->Id)) ? 
-            savedPredNode : savedSuccOrSameNode;
+        return RoutingTableSnapshot::FindClosest(
+            value,
+            ring,
+            isLocal ? ring_.ThisNode : RoutingTableSnapshot::NoPosition,
+            knownTable_.ThisNodePtr,
+            nullptr);
     }
 
     PartnerNodeSPtr RoutingTable::Get(NodeInstance const & value) const
@@ -37,6 +37,8 @@ namespace Federation
 			isTestMode_ = true;
 		}
 
+        void Test_SetToken(RoutingToken const & token);
+
         /// <summary>
         /// Get the size of the routing table (all nodes including "this" node and shutdown ones)
         /// </summary>
@@ -57,6 +59,12 @@ namespace Federation
 
         PartnerNodeSPtr GetRoutingHop(NodeId const& value, std::wstring const & ringName, bool safeMode, bool& ownsToken) const;
 
+        /// <summary>
+        /// Get the last published snapshot of the local ring. The snapshot is
+        /// replaced, never modified, when the routing table changes.
+        /// </summary>
+        RoutingTableSnapshotSPtr GetSnapshot() const;
+
         /// <summary>
         /// Get the PartnerNode with the id in the input.
         /// </summary>
@@ -431,6 +439,15 @@ namespace Federation
 
         ImplicitLeaseContext implicitLeaseContext_;
 
+        /// <summary>
+        /// Published under the write lock and read with atomic_load,
+        /// so routing in the local ring does not take the lock.
+        /// </summary>
+        RoutingTableSnapshotSPtr snapshot_;
+        uint64 snapshotVersion_;
+
+        void PublishSnapshot();
+
         PartnerNodeSPtr const& InternalFindClosest(NodeId const& value, std::wstring const & toRing, bool safeMode) const;
         PartnerNodeSPtr const& InternalFindClosest(NodeId const& value, NodeRingBase const & ring) const;
 
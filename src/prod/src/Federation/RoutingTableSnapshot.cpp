@@ -0,0 +1,159 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+namespace Federation
+{
+    using namespace std;
+    using namespace Common;
+
+    size_t const RoutingTableSnapshot::NoPosition = static_cast<size_t>(-1);
+
+    RoutingTableSnapshot::RoutingTableSnapshot(
+        uint64 version,
+        NodeRing const & ring,
+        PartnerNodeSPtr const & thisNode,
+        NodeIdRange const & hoodRange,
+        RoutingToken const & token)
+        : version_(version),
+        ring_(ring.Nodes),
+        thisPosition_(ring.ThisNode),
+        thisNode_(thisNode),
+        hoodRange_(hoodRange),
+        token_(token)
+    {
+    }
+
+    PartnerNodeSPtr const & RoutingTableSnapshot::GetRoutingHop(NodeId const & value, bool isSiteAvailable, bool & ownsToken) const
+    {
+        ownsToken = token_.Contains(value);
+        if (ownsToken)
+        {
+            return thisNode_;
+        }
+
+        return FindClosest(value, isSiteAvailable);
+    }
+
+    PartnerNodeSPtr const & RoutingTableSnapshot::FindClosest(NodeId const & value, bool isSiteAvailable) const
+    {
+        return FindClosest(value, ring_, thisPosition_, thisNode_, isSiteAvailable ? &hoodRange_ : nullptr);
+    }
+
+    PartnerNodeSPtr const & RoutingTableSnapshot::FindClosest(
+        NodeId const & value,
+        NodeRingBase const & ring,
+        size_t thisPosition,
+        PartnerNodeSPtr const & thisNode,
+        NodeIdRange const * hoodRange)
+    {
+        if (ring.Size == 0)
+        {
+            return thisNode;
+        }
+
+        bool isLocal = (thisPosition != NoPosition);
+        size_t succOrSame = ring.FindSuccOrSamePosition(value);
+        size_t pred = ring.GetPred(succOrSame);
+
+        // to save the first routing (but may be unknown) node on both side, initialize them to avoid warning
+        size_t savedSuccOrSame = succOrSame;
+        size_t savedPred = pred;
+
+        // try to find an routing and known node in the successor side,
+        // also save the first routing (but maybe unknown) node we found
+        bool found = false;
+        bool foundSuccRouting = false;
+        for (size_t i = 0; i < ring.Size; i++)
+        {
+            PartnerNodeSPtr const& currentNode = ring.GetNode(succOrSame);
+
+            if (currentNode->IsRouting)
+            {
+                if (!foundSuccRouting)
+                {
+                    savedSuccOrSame = succOrSame;
+                    foundSuccRouting = true;
+                }
+
+                if (!currentNode->IsUnknown || (isLocal && hoodRange && hoodRange->Contains(currentNode->Id)))
+                {
+                    found = true;
+                    break;
+                }
+            }
+
+            succOrSame = ring.GetSucc(succOrSame);
+        }
+
+        if (!foundSuccRouting)
+        {
+            // no routing node in the routing table
+            return (isLocal ? RoutingTable::NullNode : thisNode);
+        }
+
+        // try to find an routing and known node in the predecessor side,
+        // also save the first routing (but maybe unknown) node we found
+        bool foundPredRouting = false;
+
+        for (size_t i = 0; i < ring.Size; i++)
+        {
+            PartnerNodeSPtr const& currentNode = ring.GetNode(pred);
+
+            if (currentNode->IsRouting)
+            {
+                if (!foundPredRouting)
+                {
+                    savedPred = pred;
+                    foundPredRouting = true;
+                }
+
+                if (!currentNode->IsUnknown || (isLocal && hoodRange && hoodRange->Contains(currentNode->Id)))
+                {
+                    break;
+                }
+            }
+
+            pred = ring.GetPred(pred);
+        }
+
+        ASSERT_IF(!foundPredRouting, "Found routing node in successor side but not in predecessor side");
+
+        if (found)
+        {
+            // found on successor side is equivalent to found on both side
+            PartnerNodeSPtr const& predNode = ring.GetNode(pred);
+            PartnerNodeSPtr const& succOrSameNode = ring.GetNode(succOrSame);
+
+            // Check which one has smallest distance,
+            // if the distances are same, return the predecessor.
+            // If the node to return equal to "this" node, don't return here
+            // but will check whether it is better than the saved unknown nodes
+            if (value.PredDist(predNode->Id) <= value.SuccDist(succOrSameNode->Id))
+            {
+                if (pred != thisPosition)
+                {
+                    return predNode;
+                }
+            }
+            else
+            {
+                if (succOrSame != thisPosition)
+                {
+                    return succOrSameNode;
+                }
+            }
+        }
+
+        // if no routing and known node found, or the best routing and known node is "this" node
+        // we return the best one from the unknown routing nodes and "this" node
+        PartnerNodeSPtr const& savedPredNode = ring.GetNode(savedPred);
+        PartnerNodeSPtr const& savedSuccOrSameNode = ring.GetNode(savedSuccOrSame);
+        return (value.PredDist(savedPredNode->Id) <=
+            value.SuccDist(savedSuccOrSameNode->Id)) ?
+            savedPredNode : savedSuccOrSameNode;
+    }
+}
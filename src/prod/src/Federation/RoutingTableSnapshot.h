@@ -0,0 +1,79 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Federation
+{
+    class RoutingTableSnapshot;
+    typedef std::shared_ptr<RoutingTableSnapshot const> RoutingTableSnapshotSPtr;
+
+    /// <summary>
+    /// Immutable copy of the local routing ring, the neighborhood range and the routing token
+    /// of the site node. The routing table publishes a new snapshot when a write lock is
+    /// released after any of them changed, so routing hops can be computed without taking
+    /// the routing table lock. All the changes made under one write lock are published together.
+    /// </summary>
+    /// <remarks>
+    /// The partner nodes are shared with the routing table, so nodes that are marked as
+    /// unknown are seen by existing snapshots.
+    /// </remarks>
+    class RoutingTableSnapshot
+    {
+        DENY_COPY(RoutingTableSnapshot);
+
+    public:
+        /// <summary>
+        /// Position passed to FindClosest for rings that do not contain "this" node
+        /// </summary>
+        static size_t const NoPosition;
+
+        RoutingTableSnapshot(
+            uint64 version,
+            NodeRing const & ring,
+            PartnerNodeSPtr const & thisNode,
+            NodeIdRange const & hoodRange,
+            RoutingToken const & token);
+
+        __declspec (property(get=getVersion)) uint64 Version;
+        uint64 getVersion() const { return version_; }
+
+        __declspec (property(get=getToken)) RoutingToken const & Token;
+        RoutingToken const & getToken() const { return token_; }
+
+        /// <summary>
+        /// Find the closest routing node to the value, or "this" node if it owns the value.
+        /// </summary>
+        /// <param name="value">The value to search</param>
+        /// <param name="isSiteAvailable">Whether unknown nodes in the neighborhood can be used</param>
+        /// <param name="ownsToken">Set to true if "this" node owns the value</param>
+        PartnerNodeSPtr const & GetRoutingHop(NodeId const & value, bool isSiteAvailable, bool & ownsToken) const;
+
+        PartnerNodeSPtr const & FindClosest(NodeId const & value, bool isSiteAvailable) const;
+
+        /// <summary>
+        /// Find the closest routing node to the value in a ring, preferring nodes that are not unknown.
+        /// </summary>
+        /// <param name="value">The value to search</param>
+        /// <param name="ring">The ring to search</param>
+        /// <param name="thisPosition">The position of "this" node in the ring, or NoPosition</param>
+        /// <param name="thisNode">"this" node</param>
+        /// <param name="hoodRange">Unknown nodes in this range are treated as known, can be null</param>
+        static PartnerNodeSPtr const & FindClosest(
+            NodeId const & value,
+            NodeRingBase const & ring,
+            size_t thisPosition,
+            PartnerNodeSPtr const & thisNode,
+            NodeIdRange const * hoodRange);
+
+    private:
+        uint64 version_;
+        NodeRingBase ring_;
+        size_t thisPosition_;
+        PartnerNodeSPtr thisNode_;
+        NodeIdRange hoodRange_;
+        RoutingToken token_;
+    };
+}
@@ -254,6 +254,7 @@ SiteNode::SiteNode(
     REGISTER_MESSAGE_HEADER(BroadcastRangeHeader);
     REGISTER_MESSAGE_HEADER(BroadcastRelatesToHeader);
     REGISTER_MESSAGE_HEADER(BroadcastStepHeader);
+    REGISTER_MESSAGE_HEADER(BroadcastCompressionHeader);
     REGISTER_MESSAGE_HEADER(FabricCodeVersionHeader);
     REGISTER_MESSAGE_HEADER(FederationNeighborhoodRangeHeader);
     REGISTER_MESSAGE_HEADER(FederationNeighborhoodVersionHeader);
@@ -43,6 +43,8 @@
 #include "Federation/BroadcastRangeHeader.h"
 #include "Federation/BroadcastRelatesToHeader.h"
 #include "Federation/BroadcastStepHeader.h"
+#include "Federation/BroadcastCompressionHeader.h"
+#include "Federation/BroadcastCompression.h"
 #include "Federation/MulticastHeader.h"
 #include "Federation/MulticastTargetsHeader.h"
 #include "Federation/MulticastForwardContext.h"
@@ -61,6 +63,7 @@
 #include "Federation/Multicast.h"
 #include "Federation/SendMessageAction.h"
 #include "Federation/NodeRing.h"
+#include "Federation/RoutingTableSnapshot.h"
 #include "Federation/RoutingTable.h"
 #include "Federation/JoinLock.h"
 #include "Federation/JoinLockManager.h"
@@ -6245,6 +6245,21 @@ DoMaintenance(
         //
         DeallocateFailedRemoteLeaseAgents(LeaseAgentContext, FALSE, Now);
 
+        //
+        // Report the renew round trip time distribution of the last interval.
+        //
+        if (LeaseAgentContext->RenewRoundTripTime.Count() > 0)
+        {
+            EventWriteLeaseRenewRoundTripTime(
+                NULL,
+                TransportIdentifier(LeaseAgentContext->Transport),
+                LeaseAgentContext->Instance.QuadPart,
+                LeaseAgentContext->RenewRoundTripTime
+                );
+
+            LeaseAgentContext->RenewRoundTripTime.Reset();
+        }
+
         //
         // Check state of lease agent. If the lease agent is not failed,
         // see if it can be failed right now.
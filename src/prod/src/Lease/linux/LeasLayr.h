@@ -510,6 +510,8 @@ LeaseTrace::WriteInfo("MonitorExpired", "Monitor Expired: {0}/{1} subject = {2},
 LeaseTrace::WriteInfo("LeaseAgentBlocked", "Lease agent blocked {0}/{1}",b,c)
 #define EventWritePerformMaintenance(a)  \
 LeaseTrace::WriteInfo("PerformMaintenance", "Worker thread is performing maintenance")
+#define EventWriteLeaseRenewRoundTripTime(a,b,c,d)  \
+LeaseTrace::WriteInfo("LeaseRenewRoundTripTime", "Lease agent {0}/{1} renew round trip time: {2}",b,c,d)
 #define EventWriteLeaseAgentCleanup(a,b,c)  \
 LeaseTrace::WriteInfo("LeaseAgentCleanup", "Cleaning up lease agent {0}/{1}",b,c)
 #define EventWriteCleanupApplication(a,b,c,d)  \
@@ -1229,6 +1231,12 @@ typedef struct _LEASE_AGENT_CONTEXT {
     // leases renewed indirectly
     LONG ConsecutiveIndirectLeaseLimit;
 
+    //
+    // Round trip time of renew requests sent by this lease agent,
+    // traced and reset by the maintenance worker.
+    //
+    Transport::LatencyHistogram RenewRoundTripTime;
+
 } LEASE_AGENT_CONTEXT, * PLEASE_AGENT_CONTEXT;
 
 //
@@ -1363,6 +1371,11 @@ typedef struct _LEASE_RELATIONSHIP_CONTEXT {
     BOOLEAN IsRenewRetry;
     LONG RenewRetryCount;
     LONG IndirectLeaseCount;
+    //
+    // Time the last direct renew request was sent, zero if its response
+    // was received. Used to measure renew round trip time.
+    //
+    LARGE_INTEGER RenewRequestSendTime;
 
     //
     // Timer for ping retry.
@@ -3057,6 +3057,20 @@ emptySet,
                 RemoteLeaseAgentContext->LeaseRelationshipContext->IndirectLeaseCount = 0;
             }
 
+            if (0 != RemoteLeaseAgentContext->LeaseRelationshipContext->RenewRequestSendTime.QuadPart && LEASE_RESPONSE == MessageType)
+            {
+                //
+                // Measured from the latest renew request, a response to an earlier retry is reported shorter.
+                //
+                LARGE_INTEGER Now;
+                GetCurrentTime(&Now);
+
+                RemoteLeaseAgentContext->LeaseAgentContext->RenewRoundTripTime.Record(Common::TimeSpan::FromTicks(
+                    Now.QuadPart - RemoteLeaseAgentContext->LeaseRelationshipContext->RenewRequestSendTime.QuadPart));
+
+                RemoteLeaseAgentContext->LeaseRelationshipContext->RenewRequestSendTime.QuadPart = 0;
+            }
+
             //
             // Process state change.
             //
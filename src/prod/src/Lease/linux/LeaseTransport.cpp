@@ -24,12 +24,43 @@ namespace
     EventLoopPool* eventLoopPool = nullptr;
     INIT_ONCE initPoolOnce = INIT_ONCE_STATIC_INIT;
 
+    // incoming lease messages are copied here before being processed, socket events are
+    // dispatched synchronously, so each event loop thread can reuse its own buffer
+    thread_local vector<BYTE> receiveBuffer;
+
     BOOL CALLBACK InitEventLoopPool(PINIT_ONCE, PVOID, PVOID*)
     {
         // create a dedicated EventLoopPool for isolation, also, dispatch socket events
         // synchronously to avoid potential delay in thread pool, assuming the number
         // of socket events for lease transport is small and their processing is fast
-        eventLoopPool = new EventLoopPool(L"lease");
+        auto const & config = Federation::FederationConfig::GetConfig();
+        if (!config.LeaseTransportIsolatedIo)
+        {
+            eventLoopPool = new EventLoopPool(L"lease");
+            return TRUE;
+        }
+
+        // isolated mode, a single input/output loop pair that can be pinned to a cpu
+        // reserved for lease and scheduled ahead of other threads
+        eventLoopPool = new EventLoopPool(L"lease", 2);
+
+        if (config.LeaseTransportCpuAffinity >= 0)
+        {
+            eventLoopPool->SetCpuAffinity(config.LeaseTransportCpuAffinity);
+        }
+
+        if (config.LeaseTransportSchedPriority > 0)
+        {
+            eventLoopPool->SetSchedParam(SCHED_RR, config.LeaseTransportSchedPriority);
+        }
+
+        LeaseTrace::WriteInfo(
+            TraceType,
+            "isolated lease I/O enabled: cpu affinity = {0}, sched priority = {1}, socket priority = {2}",
+            config.LeaseTransportCpuAffinity,
+            config.LeaseTransportSchedPriority,
+            config.LeaseTransportSocketPriority);
+
         return TRUE;
     }
 
@@ -66,6 +97,11 @@ NTSTATUS TransportCreate(
     transport->DisableThrottle();
     transport->SetConnectionOpenTimeout(Federation::FederationConfig::GetConfig().ConnectionOpenTimeout);
 
+    if (Federation::FederationConfig::GetConfig().LeaseTransportIsolatedIo)
+    {
+        transport->SetSocketPriority(Federation::FederationConfig::GetConfig().LeaseTransportSocketPriority);
+    }
+
     if (securitySettings)
     {
         ASSERT_IFNOT(
@@ -97,17 +133,20 @@ NTSTATUS TransportListen(PLEASE_TRANSPORT const & transport, __in TRANSPORT_MESS
             totalBytes += buffer.size();
         }
 
-        auto buf = new BYTE[totalBytes];
-        KFinally([buf] { delete buf; });
+        // only grows, lease messages are small and of similar sizes
+        if (receiveBuffer.size() < totalBytes)
+        {
+            receiveBuffer.resize(totalBytes);
+        }
 
-        auto ptr = buf;
+        auto ptr = receiveBuffer.data();
         for(auto const & buffer : buffers)
         {
             memcpy(ptr, buffer.buf, buffer.len);
             ptr += buffer.len;
         }
 
-        callback(NULL, sender, buf, totalBytes, state);//jc
+        callback(NULL, sender, receiveBuffer.data(), totalBytes, state);//jc
     });
 
     return transport->Start().ToHResult();
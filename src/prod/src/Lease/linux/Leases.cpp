@@ -1749,6 +1749,10 @@ emptySet,
             {
                 Release(RemoteLeaseAgentContext);
             }
+            else
+            {
+                RemoteLeaseAgentContext->LeaseRelationshipContext->RenewRequestSendTime = Now;
+            }
         }
     }
 
@@ -2126,6 +2130,7 @@ Return Value:
 
     LeaseRelationshipContext->IsRenewRetry = FALSE;
     LeaseRelationshipContext->RenewRetryCount = 0;
+    LeaseRelationshipContext->RenewRequestSendTime.QuadPart = 0;
 
     return STATUS_SUCCESS;
     
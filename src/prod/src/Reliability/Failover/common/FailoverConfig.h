@@ -73,6 +73,12 @@ namespace Reliability
         // The PeriodicStateScanInterval determines how often the FM background thread activates to scan for changes and kick off actions
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"FailoverManager", PeriodicStateScanInterval, Common::TimeSpan::FromSeconds(5.0), Common::ConfigEntryUpgradePolicy::Dynamic);
 
+        // Determines how often the FM background thread visits all FailoverUnits. Runs in between only visit FailoverUnits
+        // that changed or were not stable at their last visit. Zero means that every run visits all FailoverUnits, and
+        // FailoverUnit changes are not tracked. The FailoverUnit count performance counters are only updated by full scans,
+        // so they can be stale by up to this interval.
+        INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"FailoverManager", PeriodicStateFullScanInterval, Common::TimeSpan::Zero, Common::ConfigEntryUpgradePolicy::Dynamic);
+
         // When the FM sends a particular action for a specific replica, it starts this timer.  Before it expires, the FM will not send additional
         // actions to the replica
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"FailoverManager", MinActionRetryIntervalPerReplica, Common::TimeSpan::FromSeconds(10.0), Common::ConfigEntryUpgradePolicy::Dynamic);
@@ -180,6 +186,10 @@ namespace Reliability
         // equal to the number of cores on the machine
         INTERNAL_CONFIG_ENTRY(int, L"FailoverManager", BackgroundThreadCount, 0, Common::ConfigEntryUpgradePolicy::Dynamic);
 
+        // The number of shards the FM FailoverUnit cache is split into. Each shard has its own lock,
+        // so that lookups of FailoverUnits in different shards do not contend with each other.
+        INTERNAL_CONFIG_ENTRY(int, L"FailoverManager", FailoverUnitCacheShardCount, 64, Common::ConfigEntryUpgradePolicy::Static);
+
         // The number of threads that the FM should use for FailoverUnit specific message processing and PLB action consumption
         // The default value of 0 indicates that the FM should use a number of threads equal to the number of cores on the machine
         INTERNAL_CONFIG_ENTRY(int, L"FailoverManager", ProcessingQueueThreadCount, 0, Common::ConfigEntryUpgradePolicy::Static);
@@ -493,6 +503,9 @@ namespace Reliability
         // The maximum time to wait for async ESE transactions to commit
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"ReconfigurationAgent/Store", MaxEseCommitWaitDuration, Common::TimeSpan::MaxValue, Common::ConfigEntryUpgradePolicy::Dynamic);
 
+        // The maximum number of concurrent entity commits that are persisted in a single local store transaction. 1 = each commit uses its own transaction
+        INTERNAL_CONFIG_ENTRY(int, L"ReconfigurationAgent/Store", MaxStoreCommitBatchSize, 64, Common::ConfigEntryUpgradePolicy::Dynamic);
+
         // Specify timespan in seconds. The duration for which the system will wait before terminating service hosts that have replicas that are stuck in close during node deactivation.
         PUBLIC_CONFIG_ENTRY(Common::TimeSpan, L"ReconfigurationAgent", NodeDeactivationMaxReplicaCloseDuration, Common::TimeSpan::FromSeconds(900), Common::ConfigEntryUpgradePolicy::Dynamic);
 
@@ -0,0 +1,146 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace FailoverManagerUnitTest
+{
+    using namespace Common;
+    using namespace std;
+    using namespace Federation;
+    using namespace Reliability;
+    using namespace Reliability::FailoverManagerComponent;
+
+    class BackgroundManagerTest
+    {
+    protected:
+
+        BackgroundManagerTest() { BOOST_REQUIRE(ClassSetup()); }
+        ~BackgroundManagerTest() { BOOST_REQUIRE(ClassCleanup()); }
+
+        TEST_CLASS_SETUP(ClassSetup);
+        TEST_CLASS_CLEANUP(ClassCleanup);
+
+        FailoverUnitUPtr CreateCommittedFailoverUnit(wstring const& failoverUnitStr);
+
+        ComponentRootSPtr root_;
+        FailoverManagerSPtr fm_;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(BackgroundManagerTestSuite, BackgroundManagerTest)
+
+    BOOST_AUTO_TEST_CASE(IsFullScanNeededTest)
+    {
+        BackgroundManager backgroundManager(*fm_, *root_);
+
+        DateTime now = DateTime::Now();
+        LONG64 commitCount = 10;
+        FABRIC_SEQUENCE_NUMBER healthSequence = 20;
+
+        // Every run is a full scan while the interval is zero
+        FailoverConfig::GetConfig().PeriodicStateFullScanInterval = TimeSpan::Zero;
+        backgroundManager.Test_SetLastFullScan(now, commitCount, healthSequence, false);
+        VERIFY_IS_TRUE(backgroundManager.IsFullScanNeeded(now, commitCount, healthSequence));
+
+        FailoverConfig::GetConfig().PeriodicStateFullScanInterval = TimeSpan::FromMinutes(5);
+
+        // The first run after changes are tracked has to visit the FailoverUnits changed before
+        backgroundManager.Test_SetLastFullScan(DateTime::Zero, commitCount, healthSequence, false);
+        VERIFY_IS_TRUE(backgroundManager.IsFullScanNeeded(now, commitCount, healthSequence));
+
+        backgroundManager.Test_SetLastFullScan(now, commitCount, healthSequence, false);
+        VERIFY_IS_FALSE(backgroundManager.IsFullScanNeeded(now + TimeSpan::FromMinutes(1), commitCount, healthSequence));
+
+        // Interval elapsed
+        VERIFY_IS_TRUE(backgroundManager.IsFullScanNeeded(now + TimeSpan::FromMinutes(6), commitCount, healthSequence));
+
+        // A node, service, service type or application was committed
+        VERIFY_IS_TRUE(backgroundManager.IsFullScanNeeded(now + TimeSpan::FromMinutes(1), commitCount + 1, healthSequence));
+
+        // The invalidated health sequence moved
+        VERIFY_IS_TRUE(backgroundManager.IsFullScanNeeded(now + TimeSpan::FromMinutes(1), commitCount, healthSequence + 1));
+
+        // The previous enumeration was aborted
+        backgroundManager.Test_SetLastFullScan(now, commitCount, healthSequence, true);
+        VERIFY_IS_TRUE(backgroundManager.IsFullScanNeeded(now + TimeSpan::FromMinutes(1), commitCount, healthSequence));
+
+        backgroundManager.Stop();
+    }
+
+    BOOST_AUTO_TEST_CASE(IsQuiescentTest)
+    {
+        FailoverUnitUPtr failoverUnit = CreateCommittedFailoverUnit(L"3 2 SP 000/111 [1 N/P RD - Up] [2 N/S RD - Up] [3 N/S RD - Up]");
+        VERIFY_IS_TRUE(failoverUnit->IsStable);
+        VERIFY_IS_TRUE(BackgroundManager::IsQuiescent(*failoverUnit));
+
+        // Not yet persisted
+        failoverUnit = TestHelper::FailoverUnitFromString(L"3 2 SP 000/111 [1 N/P RD - Up] [2 N/S RD - Up] [3 N/S RD - Up]");
+        VERIFY_IS_FALSE(BackgroundManager::IsQuiescent(*failoverUnit));
+
+        // Replica being built
+        failoverUnit = CreateCommittedFailoverUnit(L"3 2 SP 000/111 [1 N/P RD - Up] [2 N/S RD - Up] [3 N/S IB - Up]");
+        VERIFY_IS_FALSE(BackgroundManager::IsQuiescent(*failoverUnit));
+
+        // Replica down
+        failoverUnit = CreateCommittedFailoverUnit(L"3 2 SP 000/111 [1 N/P RD - Up] [2 N/S RD - Up] [3 N/S SB - Down]");
+        VERIFY_IS_FALSE(BackgroundManager::IsQuiescent(*failoverUnit));
+
+        // Reconfiguration in progress
+        failoverUnit = CreateCommittedFailoverUnit(L"3 2 SP 111/222 [1 S/P RD - Up] [2 P/S RD - Up] [3 S/S RD - Up]");
+        VERIFY_IS_FALSE(BackgroundManager::IsQuiescent(*failoverUnit));
+
+        // Marked for deletion
+        failoverUnit = CreateCommittedFailoverUnit(L"3 2 SP 000/111 [1 N/P RD - Up] [2 N/S RD - Up] [3 N/S RD - Up]");
+        failoverUnit->SetToBeDeleted();
+        VERIFY_IS_FALSE(BackgroundManager::IsQuiescent(*failoverUnit));
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    FailoverUnitUPtr BackgroundManagerTest::CreateCommittedFailoverUnit(wstring const& failoverUnitStr)
+    {
+        FailoverUnitUPtr failoverUnit = TestHelper::FailoverUnitFromString(failoverUnitStr);
+
+        failoverUnit->PostUpdate(DateTime::Now());
+        failoverUnit->PostCommit(failoverUnit->OperationLSN + 1);
+        failoverUnit->UpdateHealthState();
+
+        return failoverUnit;
+    }
+
+    bool BackgroundManagerTest::ClassSetup()
+    {
+        FailoverConfig::Test_Reset();
+        FailoverConfig & failoverConfig = FailoverConfig::GetConfig();
+        failoverConfig.IsTestMode = true;
+        failoverConfig.DummyPLBEnabled = true;
+        failoverConfig.PeriodicStateScanInterval = TimeSpan::MaxValue;
+
+        Reliability::LoadBalancingComponent::PLBConfig::Test_Reset();
+        auto & plbConfig = Reliability::LoadBalancingComponent::PLBConfig::GetConfig();
+        plbConfig.IsTestMode = true;
+        plbConfig.DummyPLBEnabled = true;
+        plbConfig.PLBRefreshInterval = (TimeSpan::MaxValue);
+        plbConfig.ProcessPendingUpdatesInterval = (TimeSpan::MaxValue);
+
+        root_ = make_shared<ComponentRoot>();
+        fm_ = TestHelper::CreateFauxFM(*root_);
+
+        return true;
+    }
+
+    bool BackgroundManagerTest::ClassCleanup()
+    {
+        fm_->Close(true /* isStoreCloseNeeded */);
+
+        FailoverConfig::Test_Reset();
+        Reliability::LoadBalancingComponent::PLBConfig::Test_Reset();
+
+        return true;
+    }
+}
@@ -26,6 +26,7 @@ void BackgroundManager::EnumerationContext::Reset(std::vector<BackgroundThreadCo
 {
     threadContexts_ = std::move(threadContexts);
     unprocessedFailoverUnits_.clear();
+    pendingFailoverUnits_.clear();
     count_ = 0;
     asyncCommitCount_ = 0;
 }
@@ -39,6 +40,11 @@ BackgroundManager::BackgroundManager(FailoverManager & fm, Common::ComponentRoot
     activeThreadCount_(0),
     enumerationAborted_(false),
     enumerationCompleted_(true),
+    isFullScan_(true),
+    failoverUnitCount_(0),
+    lastFullScanTime_(DateTime::Zero),
+    lastCacheEntryCommitCount_(0),
+    lastInvalidatedHealthSequence_(0),
     isThrottled_(false),
     actionCount_(0),
     asyncCommitCount_(0),
@@ -165,8 +171,14 @@ void BackgroundManager::CreateThreadContexts()
     // Add ThreadContext for FailoverUnit health report.
     fm_.FailoverUnitCacheObj.AddThreadContexts();
 
+    // Thread contexts need to see every FailoverUnit, so they can only be processed by a full scan.
+    if (!currentContexts_.empty())
+    {
+        isFullScan_ = true;
+    }
+
     // Add ThreadContext for performance counters.
-    if (!(fm_.IsMaster))
+    if (isFullScan_ && !(fm_.IsMaster))
     {
         AddThreadContext(make_unique<FailoverUnitCountsContext>());
     }
@@ -251,8 +263,30 @@ void BackgroundManager::RunPeriodicTask()
 
     fm_.TraceQueueCounts();
 
+    LONG64 cacheEntryCommitCount = CacheEntryCommitCounter::GetValue();
+    FABRIC_SEQUENCE_NUMBER invalidatedHealthSequence = fm_.FailoverUnitCacheObj.InvalidatedHealthSequence;
+    isFullScan_ = IsFullScanNeeded(now, cacheEntryCommitCount, invalidatedHealthSequence);
+
     CreateThreadContexts();
 
+    if (isFullScan_)
+    {
+        // Changed FailoverUnits are visited by the full scan as well.
+        set<FailoverUnitId> changedFailoverUnits;
+        fm_.FailoverUnitCacheObj.TakeChangedFailoverUnits(changedFailoverUnits);
+        pendingFailoverUnits_.clear();
+
+        // Changes are not tracked while the interval is zero, so the first run after it is set must be a full scan too.
+        lastFullScanTime_ = FailoverConfig::GetConfig().PeriodicStateFullScanInterval > TimeSpan::Zero ? now : DateTime::Zero;
+        lastCacheEntryCommitCount_ = cacheEntryCommitCount;
+        lastInvalidatedHealthSequence_ = invalidatedHealthSequence;
+    }
+    else
+    {
+        pendingFailoverUnits_.insert(unprocessedFailoverUnits_.begin(), unprocessedFailoverUnits_.end());
+        fm_.FailoverUnitCacheObj.TakeChangedFailoverUnits(pendingFailoverUnits_);
+    }
+
     enumeratedCount_ = 0;
     actionCount_ = 0;
     asyncCommitCount_ = 0;
@@ -270,7 +304,23 @@ void BackgroundManager::RunPeriodicTask()
         activeThreadCount_ = Environment::GetNumberOfProcessors();
     }
 
-    visitor_ = fm_.FailoverUnitCacheObj.CreateVisitor(true, TimeSpan::Zero, true);
+    failoverUnitCount_ = fm_.FailoverUnitCacheObj.Count;
+
+    // The background thread's own visits do not mark FailoverUnits as changed. FailoverUnits
+    // that still have work to do are tracked in pendingFailoverUnits_ instead.
+    if (isFullScan_)
+    {
+        visitor_ = fm_.FailoverUnitCacheObj.CreateVisitor(true, TimeSpan::Zero, true, false);
+    }
+    else
+    {
+        vector<FailoverUnitId> failoverUnitIds(pendingFailoverUnits_.begin(), pendingFailoverUnits_.end());
+        pendingFailoverUnits_.clear();
+
+        random_shuffle(failoverUnitIds.begin(), failoverUnitIds.end());
+
+        visitor_ = fm_.FailoverUnitCacheObj.CreateVisitor(move(failoverUnitIds), TimeSpan::Zero, true, false);
+    }
 
     // This thread itself will be performing the task as well.
     int threadsToInvoke = activeThreadCount_ - 1;
@@ -288,6 +338,8 @@ void BackgroundManager::OnPeriodicTaskEnd()
 {
     fm_.FailoverUnitCounters->NumberOfUnprocessedFailoverUnits.Value = static_cast<PerformanceCounterValue>(unprocessedFailoverUnits_.size());
     fm_.FailoverUnitCounters->NumberOfFailoverUnitActions.Value = static_cast<PerformanceCounterValue>(actionCount_);
+    fm_.FailoverUnitCounters->NumberOfVisitedFailoverUnits.Value = static_cast<PerformanceCounterValue>(enumeratedCount_);
+    fm_.FailoverUnitCounters->NumberOfBackgroundFailoverUnits.Value = static_cast<PerformanceCounterValue>(failoverUnitCount_);
 
     visitor_ = nullptr;
 
@@ -332,7 +384,7 @@ void BackgroundManager::OnPeriodicTaskEnd()
     }
 
     TimeSpan duration = Stopwatch::Now() - iterationStartTime_;
-    fm_.Events.FTPeriodicTaskEnd(Id, enumerationAborted_, unprocessedFailoverUnits_.size(), actionCount_, duration.TotalMilliseconds());
+    fm_.Events.FTPeriodicTaskEnd(Id, enumerationAborted_, unprocessedFailoverUnits_.size(), actionCount_, duration.TotalMilliseconds(), isFullScan_, enumeratedCount_, failoverUnitCount_);
 
     ScheduleNextRun();
 }
@@ -362,6 +414,46 @@ void BackgroundManager::ScheduleNextRun()
     RunPeriodicTask();
 }
 
+bool BackgroundManager::IsFullScanNeeded(DateTime now, LONG64 cacheEntryCommitCount, FABRIC_SEQUENCE_NUMBER invalidatedHealthSequence) const
+{
+    TimeSpan fullScanInterval = FailoverConfig::GetConfig().PeriodicStateFullScanInterval;
+
+    // A node, service, service type or application change can affect any FailoverUnit.
+    // If the last run was aborted, the FailoverUnits it did not reach are not tracked.
+    return (fullScanInterval <= TimeSpan::Zero ||
+        lastFullScanTime_ == DateTime::Zero ||
+        (now - lastFullScanTime_) > fullScanInterval ||
+        cacheEntryCommitCount != lastCacheEntryCommitCount_ ||
+        invalidatedHealthSequence != lastInvalidatedHealthSequence_ ||
+        enumerationAborted_);
+}
+
+bool BackgroundManager::IsQuiescent(FailoverUnit const& failoverUnit)
+{
+    if (!failoverUnit.IsStable ||
+        failoverUnit.IsUnhealthy ||
+        failoverUnit.IsToBeDeleted ||
+        failoverUnit.IsOrphaned ||
+        failoverUnit.IsUpgrading ||
+        failoverUnit.IsSwappingPrimary ||
+        failoverUnit.IsPersistencePending ||
+        failoverUnit.PersistenceState != PersistenceState::NoChange ||
+        failoverUnit.CurrentHealthState != FailoverUnitHealthState::Healthy)
+    {
+        return false;
+    }
+
+    for (auto replica = failoverUnit.BeginIterator; replica != failoverUnit.EndIterator; ++replica)
+    {
+        if (!replica->IsStable || replica->IsPendingRemove || replica->IsToBePromoted)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void BackgroundManager::CleanupLoadMetrics()
 {
     vector<FailoverUnitId> failoverUnitIds;
@@ -469,6 +561,11 @@ bool BackgroundManager::Process(EnumerationContext & enumerationContext, bool is
                     (*it)->Process(fm_, *failoverUnit);
                 }
 
+                if (!IsQuiescent(*failoverUnit))
+                {
+                    enumerationContext.pendingFailoverUnits_.push_back(failoverUnitId);
+                }
+
                 if (!failoverUnit.Release(false, true))
                 {
                     // Theoretically we should loop if this again returns true,
@@ -482,6 +579,7 @@ bool BackgroundManager::Process(EnumerationContext & enumerationContext, bool is
             {
                 asyncCommit = true;
                 enumerationContext.asyncCommitCount_++;
+                enumerationContext.pendingFailoverUnits_.push_back(failoverUnitId);
                 if (isThrottled_)
                 {
                     break;
@@ -523,6 +621,7 @@ bool BackgroundManager::Process(EnumerationContext & enumerationContext, bool is
         AcquireExclusiveLock lock(fm_.CommitQueue.GetLockObject());
 
         unprocessedFailoverUnits_.insert(enumerationContext.unprocessedFailoverUnits_.begin(), enumerationContext.unprocessedFailoverUnits_.end());
+        pendingFailoverUnits_.insert(enumerationContext.pendingFailoverUnits_.begin(), enumerationContext.pendingFailoverUnits_.end());
 
         for (size_t i = 0; i < enumerationContext.threadContexts_.size(); i++)
         {
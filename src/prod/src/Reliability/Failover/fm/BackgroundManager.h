@@ -53,6 +53,26 @@ namespace Reliability
 
             void ProcessThreadContexts(FailoverUnit const & failoverUnit, bool isSuccess);
 
+            // Whether the run starting at the given time must visit all FailoverUnits rather than
+            // only the changed and pending ones.
+            bool IsFullScanNeeded(Common::DateTime now, LONG64 cacheEntryCommitCount, FABRIC_SEQUENCE_NUMBER invalidatedHealthSequence) const;
+
+            // Whether the FailoverUnit is stable with no outstanding work, so that the background
+            // thread does not need to visit it again until it is changed.
+            static bool IsQuiescent(FailoverUnit const& failoverUnit);
+
+            void Test_SetLastFullScan(
+                Common::DateTime time,
+                LONG64 cacheEntryCommitCount,
+                FABRIC_SEQUENCE_NUMBER invalidatedHealthSequence,
+                bool enumerationAborted)
+            {
+                lastFullScanTime_ = time;
+                lastCacheEntryCommitCount_ = cacheEntryCommitCount;
+                lastInvalidatedHealthSequence_ = invalidatedHealthSequence;
+                enumerationAborted_ = enumerationAborted;
+            }
+
         private:
             struct EnumerationContext
             {
@@ -63,6 +83,7 @@ namespace Reliability
 
                 std::vector<BackgroundThreadContextUPtr> threadContexts_;
                 std::vector<FailoverUnitId> unprocessedFailoverUnits_;
+                std::vector<FailoverUnitId> pendingFailoverUnits_;
                 int count_;
                 int asyncCommitCount_;
             };
@@ -93,6 +114,17 @@ namespace Reliability
             bool enumerationCompleted_;
             std::set<FailoverUnitId> unprocessedFailoverUnits_;
 
+            // Whether the current run visits all FailoverUnits. Otherwise only the FailoverUnits
+            // that changed or were not quiescent at their last visit are visited.
+            bool isFullScan_;
+            size_t failoverUnitCount_;
+            Common::DateTime lastFullScanTime_;
+            LONG64 lastCacheEntryCommitCount_;
+            FABRIC_SEQUENCE_NUMBER lastInvalidatedHealthSequence_;
+
+            // FailoverUnits that need to be visited again in the next run.
+            std::set<FailoverUnitId> pendingFailoverUnits_;
+
             // The state machine tasks for stateless services and stateful services
             std::vector<StateMachineTaskUPtr> statelessTasks_;
             std::vector<StateMachineTaskUPtr> statefulTasks_;
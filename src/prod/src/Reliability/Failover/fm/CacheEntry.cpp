@@ -10,6 +10,8 @@ using namespace Common;
 using namespace Reliability;
 using namespace Reliability::FailoverManagerComponent;
 
+LONG64 CacheEntryCommitCounter::value_ = 0;
+
 template <class T>
 CacheEntry<T>::CacheEntry(shared_ptr<T> && entry)
     : entry_(move(entry)),
@@ -99,6 +101,8 @@ void CacheEntry<T>::Commit(shared_ptr<T> && entry)
 
         entry_ = move(entry);
 
+        CacheEntryCommitCounter::Increment();
+
         if (waitCount_ > 0)
         {
             waiting = true;
@@ -9,6 +9,18 @@ namespace Reliability
 {
     namespace FailoverManagerComponent
     {
+        // Counts the commits of node, service, service type and application entries in this process.
+        // Such a commit can change the state of every FailoverUnit that refers to the entry.
+        class CacheEntryCommitCounter
+        {
+        public:
+            static LONG64 GetValue() { return value_; }
+            static void Increment() { InterlockedIncrement64(&value_); }
+
+        private:
+            static LONG64 value_;
+        };
+
         template <class T>
         class CacheEntry;
 
@@ -0,0 +1,176 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace FailoverManagerUnitTest
+{
+    using namespace Common;
+    using namespace std;
+    using namespace Federation;
+    using namespace Reliability;
+    using namespace Reliability::FailoverManagerComponent;
+
+    StringLiteral const FMPerfTestSource("FMPerfTestSource");
+
+    class FailoverManagerPerfTest
+    {
+    protected:
+
+        FailoverManagerPerfTest() { BOOST_REQUIRE(MethodSetup()); }
+        TEST_METHOD_SETUP(MethodSetup);
+
+        ~FailoverManagerPerfTest() { BOOST_REQUIRE(MethodCleanup()); }
+        TEST_METHOD_CLEANUP(MethodCleanup);
+
+        void WaitForProcessingQueue(FailoverManager & fm);
+
+        ComponentRootSPtr root_;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(FailoverManagerPerfTestSuite, FailoverManagerPerfTest)
+
+    BOOST_AUTO_TEST_CASE(MassNodeDownPerfTest)
+    {
+        // Every down node reports all the replicas it hosted with a ReplicaDown message, which the FM
+        // processes through the FailoverUnit cache and the processing queue. The FM is backed by a
+        // FauxLocalStore, so the time measured is FM processing and not the store commits.
+        int const nodeCount = 100;
+        int const failoverUnitCount = 10000;
+        int const downNodeCount = 10;
+
+        int configuredShardCount = FailoverConfig::GetConfig().FailoverUnitCacheShardCount;
+
+        vector<int> shardCounts;
+        shardCounts.push_back(1);
+        shardCounts.push_back(configuredShardCount);
+
+        for (int shardCount : shardCounts)
+        {
+            FailoverConfig::GetConfig().FailoverUnitCacheShardCount = shardCount;
+
+            FailoverManagerSPtr fm = TestHelper::CreateFauxFM(*root_);
+
+            for (int nodeId = 1; nodeId <= nodeCount; nodeId++)
+            {
+                NodeInfoSPtr nodeInfo = TestHelper::CreateNodeInfo(TestHelper::CreateNodeInstance(nodeId, 1));
+                fm->NodeCacheObj.NodeUp(move(nodeInfo));
+            }
+
+            // Down nodes are spread evenly, so that a FailoverUnit loses at most one replica
+            map<int, map<FailoverUnitId, ReplicaDescription>> downReplicas;
+            for (int i = 0; i < downNodeCount; i++)
+            {
+                downReplicas[i * (nodeCount / downNodeCount) + 1];
+            }
+
+            for (int i = 0; i < failoverUnitCount; i++)
+            {
+                FailoverUnitUPtr failoverUnit = TestHelper::FailoverUnitFromString(wformatString(
+                    "3 2 SP 000/111 [{0} N/P RD - Up] [{1} N/S RD - Up] [{2} N/S RD - Up]",
+                    i % nodeCount + 1,
+                    (i + 1) % nodeCount + 1,
+                    (i + 2) % nodeCount + 1));
+
+                failoverUnit->ForEachReplica([&downReplicas, &failoverUnit](Replica const& replica)
+                {
+                    auto it = downReplicas.find(static_cast<int>(replica.FederationNodeId.IdValue.Low));
+                    if (it != downReplicas.end())
+                    {
+                        it->second.insert(make_pair(failoverUnit->Id, replica.ReplicaDescription));
+                    }
+                });
+
+                fm->FailoverUnitCacheObj.InsertFailoverUnitInCache(move(failoverUnit));
+            }
+
+            map<int, map<FailoverUnitId, ReplicaDescription>> expectedDownReplicas = downReplicas;
+
+            Stopwatch stopwatch;
+            stopwatch.Start();
+
+            size_t replicaCount = 0;
+            for (auto & pair : downReplicas)
+            {
+                NodeInstance nodeInstance = TestHelper::CreateNodeInstance(pair.first, 1);
+                fm->NodeCacheObj.NodeDown(nodeInstance);
+
+                replicaCount += pair.second.size();
+
+                ReplicaDownOperationSPtr operation = make_shared<ReplicaDownOperation>(*fm, nodeInstance);
+                operation->Start(operation, *fm, ReplicaListMessageBody(move(pair.second)));
+            }
+
+            WaitForProcessingQueue(*fm);
+
+            stopwatch.Stop();
+
+            for (auto const& pair : expectedDownReplicas)
+            {
+                for (auto const& replica : pair.second)
+                {
+                    LockedFailoverUnitPtr failoverUnit;
+                    VERIFY_IS_TRUE(fm->FailoverUnitCacheObj.TryGetLockedFailoverUnit(replica.first, failoverUnit));
+                    VERIFY_IS_FALSE(failoverUnit->GetReplica(replica.second.FederationNodeId)->IsUp);
+                }
+            }
+
+            Trace.WriteInfo(
+                FMPerfTestSource,
+                "{0} shards: {1} replicas of {2} nodes down in {3}ms ({4} replicas/s)",
+                shardCount,
+                replicaCount,
+                downNodeCount,
+                stopwatch.ElapsedMilliseconds,
+                static_cast<int64>(replicaCount * 1000 / max<int64>(stopwatch.ElapsedMilliseconds, 1)));
+
+            fm->Close(true /* isStoreCloseNeeded */);
+        }
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    void FailoverManagerPerfTest::WaitForProcessingQueue(FailoverManager & fm)
+    {
+        while (fm.ProcessingQueue.GetQueueLength() > 0 || fm.ProcessingQueue.GetActiveThreads() > 0)
+        {
+            Sleep(10);
+        }
+    }
+
+    bool FailoverManagerPerfTest::MethodSetup()
+    {
+        FailoverConfig::Test_Reset();
+        FailoverConfig & failoverConfig = FailoverConfig::GetConfig();
+        failoverConfig.IsTestMode = true;
+        failoverConfig.DummyPLBEnabled = true;
+        failoverConfig.PeriodicStateScanInterval = TimeSpan::MaxValue;
+
+        // The processing queue has to hold a job for every replica reported down
+        failoverConfig.ProcessingQueueSize = numeric_limits<int>::max();
+
+        Reliability::LoadBalancingComponent::PLBConfig::Test_Reset();
+        auto & plbConfig = Reliability::LoadBalancingComponent::PLBConfig::GetConfig();
+        plbConfig.IsTestMode = true;
+        plbConfig.DummyPLBEnabled = true;
+        plbConfig.PLBRefreshInterval = (TimeSpan::MaxValue);
+        plbConfig.ProcessPendingUpdatesInterval = (TimeSpan::MaxValue);
+
+        root_ = make_shared<ComponentRoot>();
+
+        return true;
+    }
+
+    bool FailoverManagerPerfTest::MethodCleanup()
+    {
+        FailoverConfig::Test_Reset();
+        Reliability::LoadBalancingComponent::PLBConfig::Test_Reset();
+
+        return true;
+    }
+}
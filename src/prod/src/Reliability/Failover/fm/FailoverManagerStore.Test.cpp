@@ -32,6 +32,19 @@ namespace FailoverManagerUnitTest
         static wstring const FMStoreFileExtension;
         bool TestSetup(wstring storetype);
         void BasicFailoverManagerStoreTest(const wstring StoreType);
+        void AsyncUpdateDataTest();
+        void AsyncStoreOperationsTest();
+        void TStoreOperationLsnIndexTest();
+        void TStoreOperationLsnIndexDisabledTest();
+        void TStoreOperationLsnIndexIncompleteTest();
+
+        template <class T>
+        ErrorCode UpdateDataAsync(FailoverManagerStore & store, T & data);
+
+        Store::IReplicatedStoreUPtr CreateTStoreForUnitTests(
+            Common::ComponentRoot const & root,
+            bool enableOperationLsnIndex = false,
+            bool deleteExistingStore = true);
         shared_ptr<FailoverManagerStore> InitializeStore(
             wstring ownerId,
             bool shouldPass,
@@ -60,6 +73,31 @@ namespace FailoverManagerUnitTest
 #endif
     }
 
+    BOOST_AUTO_TEST_CASE(AsyncUpdateDataTestCase)
+    {
+        AsyncUpdateDataTest();
+    }
+
+    BOOST_AUTO_TEST_CASE(AsyncStoreOperationsTestCase)
+    {
+        AsyncStoreOperationsTest();
+    }
+
+    BOOST_AUTO_TEST_CASE(TStoreOperationLsnIndexTestCase)
+    {
+        TStoreOperationLsnIndexTest();
+    }
+
+    BOOST_AUTO_TEST_CASE(TStoreOperationLsnIndexDisabledTestCase)
+    {
+        TStoreOperationLsnIndexDisabledTest();
+    }
+
+    BOOST_AUTO_TEST_CASE(TStoreOperationLsnIndexIncompleteTestCase)
+    {
+        TStoreOperationLsnIndexIncompleteTest();
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
 
     wstring const FailoverManagerStoreTest::testStoreType(L"ESENT");
@@ -335,4 +373,450 @@ namespace FailoverManagerUnitTest
         VERIFY_ARE_EQUAL(ErrorCodeValue::FMStoreNotUsable, (newStoreSPtr->UpdateData(*failoverunit, commitDuration)).ReadValue(), L"UpdateFailoverUnit did not return FailoverManagerStoreDisposed");
         VERIFY_ARE_EQUAL(ErrorCodeValue::FMStoreNotUsable, (newStoreSPtr->UpdateData(*nodeInfo, commitDuration)).ReadValue(), L"UpdateNode did not return FailoverManagerStoreDisposed");
     }
+
+    template <class T>
+    ErrorCode FailoverManagerStoreTest::UpdateDataAsync(FailoverManagerStore & store, T & data)
+    {
+        ManualResetEvent completedEvent;
+        ErrorCode error;
+
+        store.BeginUpdateData(
+            data,
+            [&](AsyncOperationSPtr const & operation)
+            {
+                int64 commitDuration;
+                error = store.EndUpdateData(data, operation, commitDuration);
+                completedEvent.Set();
+            },
+            AsyncOperationSPtr());
+
+        completedEvent.WaitOne();
+
+        return error;
+    }
+
+    Store::IReplicatedStoreUPtr FailoverManagerStoreTest::CreateTStoreForUnitTests(
+        Common::ComponentRoot const & root,
+        bool enableOperationLsnIndex,
+        bool deleteExistingStore)
+    {
+        // The TStore unit test store implements the asynchronous store operations natively
+        bool enableTStore = Store::StoreConfig::GetConfig().EnableTStore;
+        Store::StoreConfig::GetConfig().EnableTStore = true;
+
+        bool enableIndex = Store::StoreConfig::GetConfig().EnableTStoreOperationLsnIndex;
+        Store::StoreConfig::GetConfig().EnableTStoreOperationLsnIndex = enableOperationLsnIndex;
+
+        if (deleteExistingStore)
+        {
+            DeleteStoreFiles();
+            Directory::Create(GetEseDirectory());
+        }
+
+        auto replicatedStore = Store::KeyValueStoreReplica::CreateForUnitTests(
+            Guid::NewGuid(),
+            0,
+            Store::EseLocalStoreSettings(GetEseFilename(), GetEseDirectory()),
+            root);
+
+        Store::StoreConfig::GetConfig().EnableTStore = enableTStore;
+
+        // The index configuration is read when the local store is initialized
+        ErrorCode error = replicatedStore->InitializeLocalStoreForUnittests(false);
+        Store::StoreConfig::GetConfig().EnableTStoreOperationLsnIndex = enableIndex;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"InitializeLocalStoreForUnittests did not return success");
+
+        return replicatedStore;
+    }
+
+    void FailoverManagerStoreTest::AsyncUpdateDataTest()
+    {
+        shared_ptr<ComponentRoot> componentRoot = make_shared<ComponentRoot>();
+        FailoverManagerStore store(CreateTStoreForUnitTests(*componentRoot));
+
+        NodeInfoSPtr nodeInfo = CreateNodeInfo(100);
+        vector<NodeInfoSPtr> nodes;
+
+        // Insert
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, UpdateDataAsync(store, *nodeInfo).ReadValue(), L"Insert did not return success");
+        VERIFY_ARE_EQUAL(PersistenceState::NoChange, nodeInfo->PersistenceState);
+        int64 insertLsn = nodeInfo->OperationLSN;
+        VERIFY_IS_TRUE(insertLsn > 0);
+
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, store.LoadAll(nodes).ReadValue(), L"LoadAll did not return success");
+        VERIFY_ARE_EQUAL(1u, nodes.size());
+        VERIFY_ARE_EQUAL(insertLsn, nodes[0]->OperationLSN);
+
+        // Update
+        nodeInfo->PersistenceState = PersistenceState::ToBeUpdated;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, UpdateDataAsync(store, *nodeInfo).ReadValue(), L"Update did not return success");
+        int64 updateLsn = nodeInfo->OperationLSN;
+        VERIFY_IS_TRUE(updateLsn > insertLsn);
+
+        // An update with a stale sequence number fails and is rolled back
+        nodeInfo->PostRead(insertLsn);
+        nodeInfo->PersistenceState = PersistenceState::ToBeUpdated;
+        VERIFY_IS_FALSE(UpdateDataAsync(store, *nodeInfo).IsSuccess(), L"Update with a stale sequence number succeeded");
+        VERIFY_ARE_EQUAL(PersistenceState::ToBeUpdated, nodeInfo->PersistenceState);
+
+        nodes.clear();
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, store.LoadAll(nodes).ReadValue(), L"LoadAll did not return success");
+        VERIFY_ARE_EQUAL(1u, nodes.size());
+        VERIFY_ARE_EQUAL(updateLsn, nodes[0]->OperationLSN);
+
+        // Delete
+        nodeInfo->PostRead(updateLsn);
+        nodeInfo->PersistenceState = PersistenceState::ToBeDeleted;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, UpdateDataAsync(store, *nodeInfo).ReadValue(), L"Delete did not return success");
+
+        nodes.clear();
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, store.LoadAll(nodes).ReadValue(), L"LoadAll did not return success");
+        VERIFY_ARE_EQUAL(0u, nodes.size());
+
+        // A disposed store completes the operation with an error
+        store.Dispose(true /* isStoreCloseNeeded */);
+        nodeInfo->PersistenceState = PersistenceState::ToBeInserted;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::FMStoreNotUsable, UpdateDataAsync(store, *nodeInfo).ReadValue(), L"Insert did not return FMStoreNotUsable");
+    }
+
+    void FailoverManagerStoreTest::AsyncStoreOperationsTest()
+    {
+        shared_ptr<ComponentRoot> componentRoot = make_shared<ComponentRoot>();
+        auto replicatedStore = CreateTStoreForUnitTests(*componentRoot);
+
+        wstring const type(L"AsyncType");
+        wstring const key(L"AsyncKey");
+        vector<byte> value(3, 7);
+        vector<byte> newValue(5, 9);
+
+        auto write = [&](function<AsyncOperationSPtr(Store::IStoreBase::TransactionSPtr const &, AsyncCallback const &)> const & beginWrite)
+        {
+            Store::IStoreBase::TransactionSPtr tx;
+            ErrorCode error = replicatedStore->CreateTransaction(tx);
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"CreateTransaction did not return success");
+
+            ManualResetEvent completedEvent;
+            beginWrite(tx, [&](AsyncOperationSPtr const & operation)
+            {
+                error = replicatedStore->EndWrite(operation);
+                completedEvent.Set();
+            });
+            completedEvent.WaitOne();
+
+            if (error.IsSuccess())
+            {
+                error = tx->Commit();
+            }
+            else
+            {
+                tx->Rollback();
+            }
+
+            return error;
+        };
+
+        auto read = [&](vector<byte> & readValue, __int64 & operationLsn)
+        {
+            Store::IStoreBase::TransactionSPtr tx;
+            ErrorCode error = replicatedStore->CreateTransaction(tx);
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"CreateTransaction did not return success");
+
+            ManualResetEvent completedEvent;
+            replicatedStore->BeginReadExact(
+                tx,
+                type,
+                key,
+                [&](AsyncOperationSPtr const & operation)
+                {
+                    error = replicatedStore->EndReadExact(operation, readValue, operationLsn);
+                    completedEvent.Set();
+                },
+                AsyncOperationSPtr());
+            completedEvent.WaitOne();
+
+            tx->Rollback();
+
+            return error;
+        };
+
+        vector<byte> readValue;
+        __int64 operationLsn = 0;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::NotFound, read(readValue, operationLsn).ReadValue(), L"ReadExact of a missing key did not return NotFound");
+
+        ErrorCode error = write([&](Store::IStoreBase::TransactionSPtr const & tx, AsyncCallback const & callback)
+        {
+            return replicatedStore->BeginInsert(tx, type, key, value.data(), value.size(), callback, AsyncOperationSPtr());
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"Insert did not return success");
+
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, read(readValue, operationLsn).ReadValue(), L"ReadExact did not return success");
+        VERIFY_IS_TRUE(readValue == value);
+        __int64 insertLsn = operationLsn;
+
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx, AsyncCallback const & callback)
+        {
+            return replicatedStore->BeginInsert(tx, type, key, value.data(), value.size(), callback, AsyncOperationSPtr());
+        });
+        VERIFY_IS_FALSE(error.IsSuccess(), L"Duplicate insert succeeded");
+
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx, AsyncCallback const & callback)
+        {
+            return replicatedStore->BeginUpdate(tx, type, key, insertLsn, key, newValue.data(), newValue.size(), callback, AsyncOperationSPtr());
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"Update did not return success");
+
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, read(readValue, operationLsn).ReadValue(), L"ReadExact did not return success");
+        VERIFY_IS_TRUE(readValue == newValue);
+        VERIFY_IS_TRUE(operationLsn > insertLsn);
+
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx, AsyncCallback const & callback)
+        {
+            return replicatedStore->BeginDelete(tx, type, key, insertLsn, callback, AsyncOperationSPtr());
+        });
+        VERIFY_IS_FALSE(error.IsSuccess(), L"Delete with a stale sequence number succeeded");
+
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx, AsyncCallback const & callback)
+        {
+            return replicatedStore->BeginDelete(tx, type, key, operationLsn, callback, AsyncOperationSPtr());
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"Delete did not return success");
+
+        VERIFY_ARE_EQUAL(ErrorCodeValue::NotFound, read(readValue, operationLsn).ReadValue(), L"ReadExact of a deleted key did not return NotFound");
+
+        replicatedStore->Abort();
+    }
+
+    // Returns the (key, operation LSN) pairs of an enumeration by operation LSN
+    vector<pair<wstring, int64>> EnumerateByOperationLSN(Store::ILocalStore & localStore, int64 fromOperationLSN)
+    {
+        Store::IStoreBase::TransactionSPtr tx;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore.CreateTransaction(tx).ReadValue(), L"CreateTransaction did not return success");
+
+        Store::IStoreBase::EnumerationSPtr enumeration;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore.CreateEnumerationByOperationLSN(tx, fromOperationLSN, enumeration).ReadValue(), L"CreateEnumerationByOperationLSN did not return success");
+
+        vector<pair<wstring, int64>> result;
+        ErrorCode error;
+        while ((error = enumeration->MoveNext()).IsSuccess())
+        {
+            wstring key;
+            int64 operationLSN;
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, enumeration->CurrentKey(key).ReadValue());
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, enumeration->CurrentOperationLSN(operationLSN).ReadValue());
+            result.push_back(make_pair(key, operationLSN));
+        }
+
+        VERIFY_ARE_EQUAL(ErrorCodeValue::EnumerationCompleted, error.ReadValue());
+
+        tx->Rollback();
+
+        return result;
+    }
+
+    // Returns the number of rows of the given type visible through an enumeration by type and key
+    size_t CountRows(Store::ILocalStore & localStore, wstring const & type)
+    {
+        Store::IStoreBase::TransactionSPtr tx;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore.CreateTransaction(tx).ReadValue(), L"CreateTransaction did not return success");
+
+        Store::IStoreBase::EnumerationSPtr enumeration;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore.CreateEnumerationByTypeAndKey(tx, type, L"", enumeration).ReadValue(), L"CreateEnumerationByTypeAndKey did not return success");
+
+        size_t count = 0;
+        while (enumeration->MoveNext().IsSuccess())
+        {
+            ++count;
+        }
+
+        tx->Rollback();
+
+        return count;
+    }
+
+    int64 GetLastChangeOperationLSN(Store::ILocalStore & localStore, __out ErrorCode & error)
+    {
+        Store::IStoreBase::TransactionSPtr tx;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore.CreateTransaction(tx).ReadValue(), L"CreateTransaction did not return success");
+
+        ::FABRIC_SEQUENCE_NUMBER operationLSN = 0;
+        error = localStore.GetLastChangeOperationLSN(tx, operationLSN);
+
+        tx->Rollback();
+
+        return operationLSN;
+    }
+
+    void FailoverManagerStoreTest::TStoreOperationLsnIndexTest()
+    {
+        shared_ptr<ComponentRoot> componentRoot = make_shared<ComponentRoot>();
+        auto replicatedStore = CreateTStoreForUnitTests(*componentRoot, true /* enableOperationLsnIndex */);
+        auto localStore = replicatedStore->Test_GetLocalStore();
+        VERIFY_IS_TRUE(localStore.get() != nullptr);
+
+        wstring const type(L"IndexType");
+        vector<byte> value(3, 7);
+
+        auto write = [&](function<ErrorCode(Store::IStoreBase::TransactionSPtr const &)> const & operation)
+        {
+            Store::IStoreBase::TransactionSPtr tx;
+            ErrorCode error = localStore->CreateTransaction(tx);
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"CreateTransaction did not return success");
+
+            error = operation(tx);
+            if (error.IsSuccess())
+            {
+                error = tx->Commit();
+            }
+            else
+            {
+                tx->Rollback();
+            }
+
+            return error;
+        };
+
+        ErrorCode error;
+        VERIFY_ARE_EQUAL(0, GetLastChangeOperationLSN(*localStore, error));
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"GetLastChangeOperationLSN on an empty store did not return success");
+
+        // Rows inserted without an operation number are indexed at LSN 0
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx)
+        {
+            auto innerError = localStore->Insert(tx, type, L"A", value.data(), value.size(), 10);
+            if (innerError.IsSuccess()) { innerError = localStore->Insert(tx, type, L"B", value.data(), value.size(), 11); }
+            if (innerError.IsSuccess()) { innerError = localStore->Insert(tx, type, L"C", value.data(), value.size()); }
+            return innerError;
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"Insert did not return success");
+
+        VERIFY_ARE_EQUAL(11, GetLastChangeOperationLSN(*localStore, error));
+        VERIFY_IS_TRUE(EnumerateByOperationLSN(*localStore, 0) == (vector<pair<wstring, int64>> { { L"C", 0 }, { L"A", 10 }, { L"B", 11 } }));
+        VERIFY_IS_TRUE(EnumerateByOperationLSN(*localStore, 11) == (vector<pair<wstring, int64>> { { L"B", 11 } }));
+
+        // Updates move the index entry and check the indexed LSN
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx)
+        {
+            return localStore->Update(tx, type, L"A", 9, L"A", value.data(), value.size(), 12);
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::StoreWriteConflict, error.ReadValue(), L"Update with a stale operation number did not fail");
+
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx)
+        {
+            return localStore->Update(tx, type, L"A", 10, L"A", value.data(), value.size(), 12);
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"Update did not return success");
+
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx)
+        {
+            return localStore->UpdateOperationLSN(tx, type, L"C", 13);
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"UpdateOperationLSN did not return success");
+
+        VERIFY_ARE_EQUAL(13, GetLastChangeOperationLSN(*localStore, error));
+        VERIFY_IS_TRUE(EnumerateByOperationLSN(*localStore, 0) == (vector<pair<wstring, int64>> { { L"B", 11 }, { L"A", 12 }, { L"C", 13 } }));
+
+        // Deletes remove the index entry
+        error = write([&](Store::IStoreBase::TransactionSPtr const & tx)
+        {
+            return localStore->Delete(tx, type, L"C", 13);
+        });
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, error.ReadValue(), L"Delete did not return success");
+
+        VERIFY_ARE_EQUAL(12, GetLastChangeOperationLSN(*localStore, error));
+        VERIFY_IS_TRUE(EnumerateByOperationLSN(*localStore, 0) == (vector<pair<wstring, int64>> { { L"B", 11 }, { L"A", 12 } }));
+
+        // The index is not visible through enumerations by type and key, which
+        // report the indexed LSNs of user rows
+        VERIFY_ARE_EQUAL(2u, CountRows(*localStore, type));
+        VERIFY_ARE_EQUAL(0u, CountRows(*localStore, L"TSOperationLsnIndex"));
+        VERIFY_ARE_EQUAL(0u, CountRows(*localStore, L"TSOperationLsnByKey"));
+        VERIFY_ARE_EQUAL(0u, CountRows(*localStore, L"TSOperationLsnIndexState"));
+
+        Store::IStoreBase::TransactionSPtr tx;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->CreateTransaction(tx).ReadValue());
+        Store::IStoreBase::EnumerationSPtr enumeration;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->CreateEnumerationByTypeAndKey(tx, type, L"B", enumeration).ReadValue());
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, enumeration->MoveNext().ReadValue());
+        int64 operationLSN = 0;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, enumeration->CurrentOperationLSN(operationLSN).ReadValue());
+        VERIFY_ARE_EQUAL(11, operationLSN);
+        tx->Rollback();
+
+        replicatedStore->Abort();
+    }
+
+    void FailoverManagerStoreTest::TStoreOperationLsnIndexDisabledTest()
+    {
+        shared_ptr<ComponentRoot> componentRoot = make_shared<ComponentRoot>();
+        auto replicatedStore = CreateTStoreForUnitTests(*componentRoot);
+        auto localStore = replicatedStore->Test_GetLocalStore();
+        VERIFY_IS_TRUE(localStore.get() != nullptr);
+
+        vector<byte> value(3, 7);
+
+        Store::IStoreBase::TransactionSPtr tx;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->CreateTransaction(tx).ReadValue());
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->Insert(tx, L"IndexType", L"A", value.data(), value.size(), 10).ReadValue());
+        VERIFY_ARE_EQUAL(ErrorCodeValue::NotImplemented, localStore->UpdateOperationLSN(tx, L"IndexType", L"A", 11).ReadValue());
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, tx->Commit().ReadValue());
+
+        // Writes are not indexed and enumeration by operation LSN is not supported
+        ErrorCode error;
+        GetLastChangeOperationLSN(*localStore, error);
+        VERIFY_ARE_EQUAL(ErrorCodeValue::NotImplemented, error.ReadValue());
+
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->CreateTransaction(tx).ReadValue());
+        Store::IStoreBase::EnumerationSPtr enumeration;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::NotImplemented, localStore->CreateEnumerationByOperationLSN(tx, 0, enumeration).ReadValue());
+        tx->Rollback();
+
+        VERIFY_ARE_EQUAL(1u, CountRows(*localStore, L"IndexType"));
+        VERIFY_ARE_EQUAL(0u, CountRows(*localStore, L"TSOperationLsnIndex"));
+        VERIFY_ARE_EQUAL(0u, CountRows(*localStore, L"TSOperationLsnByKey"));
+
+        replicatedStore->Abort();
+    }
+
+    void FailoverManagerStoreTest::TStoreOperationLsnIndexIncompleteTest()
+    {
+        shared_ptr<ComponentRoot> componentRoot = make_shared<ComponentRoot>();
+        vector<byte> value(3, 7);
+
+        // Write a row before the index is enabled
+        {
+            auto replicatedStore = CreateTStoreForUnitTests(*componentRoot);
+            auto localStore = replicatedStore->Test_GetLocalStore();
+
+            Store::IStoreBase::TransactionSPtr tx;
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->CreateTransaction(tx).ReadValue());
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->Insert(tx, L"IndexType", L"A", value.data(), value.size(), 10).ReadValue());
+            VERIFY_ARE_EQUAL(ErrorCodeValue::Success, tx->Commit().ReadValue());
+
+            replicatedStore->Abort();
+        }
+
+        auto replicatedStore = CreateTStoreForUnitTests(*componentRoot, true /* enableOperationLsnIndex */, false /* deleteExistingStore */);
+        auto localStore = replicatedStore->Test_GetLocalStore();
+
+        // New writes are indexed, but the index misses the existing row so
+        // enumeration by operation LSN stays unsupported
+        Store::IStoreBase::TransactionSPtr tx;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->CreateTransaction(tx).ReadValue());
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->Insert(tx, L"IndexType", L"B", value.data(), value.size(), 11).ReadValue());
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->Update(tx, L"IndexType", L"A", 0, L"A", value.data(), value.size(), 12).ReadValue());
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, tx->Commit().ReadValue());
+
+        ErrorCode error;
+        GetLastChangeOperationLSN(*localStore, error);
+        VERIFY_ARE_EQUAL(ErrorCodeValue::NotImplemented, error.ReadValue());
+
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, localStore->CreateTransaction(tx).ReadValue());
+        Store::IStoreBase::EnumerationSPtr enumeration;
+        VERIFY_ARE_EQUAL(ErrorCodeValue::NotImplemented, localStore->CreateEnumerationByOperationLSN(tx, 0, enumeration).ReadValue());
+        tx->Rollback();
+
+        VERIFY_ARE_EQUAL(2u, CountRows(*localStore, L"IndexType"));
+
+        replicatedStore->Abort();
+    }
 }
@@ -64,6 +64,198 @@ namespace FailoverManagerUnitTest
         cache.ServiceLookupTable.Dispose();
     }
 
+    BOOST_AUTO_TEST_CASE(ChangedFailoverUnitsTest)
+    {
+        FailoverUnitCache cache(*fm_, failoverUnits_, 0, *root_);
+        TimeSpan timeout = FailoverConfig::GetConfig().LockAcquireTimeout;
+
+        // Nothing is tracked while every background run is a full scan
+        FailoverConfig::GetConfig().PeriodicStateFullScanInterval = TimeSpan::Zero;
+        {
+            FailoverUnitCache::VisitorSPtr markingVisitor = cache.CreateVisitor(false, timeout);
+            while (auto failoverUnit = markingVisitor->MoveNext())
+            {
+            }
+        }
+
+        {
+            set<FailoverUnitId> untrackedFailoverUnits;
+            cache.TakeChangedFailoverUnits(untrackedFailoverUnits);
+            VERIFY_IS_TRUE(untrackedFailoverUnits.empty());
+        }
+
+        FailoverConfig::GetConfig().PeriodicStateFullScanInterval = TimeSpan::FromMinutes(1);
+
+        // Visitors that do not mark changes leave the changed set empty
+        vector<FailoverUnitId> failoverUnitIds;
+        FailoverUnitCache::VisitorSPtr visitor = cache.CreateVisitor(false, timeout, false, false);
+        while (auto failoverUnit = visitor->MoveNext())
+        {
+            failoverUnitIds.push_back(failoverUnit->Id);
+        }
+
+        VERIFY_ARE_EQUAL(30u, failoverUnitIds.size());
+
+        set<FailoverUnitId> changedFailoverUnits;
+        cache.TakeChangedFailoverUnits(changedFailoverUnits);
+        VERIFY_IS_TRUE(changedFailoverUnits.empty());
+
+        // Repeated changes of a FailoverUnit are recorded once until they are taken
+        for (int i = 0; i < 2; i++)
+        {
+            LockedFailoverUnitPtr failoverUnit;
+            VERIFY_IS_TRUE(cache.TryGetLockedFailoverUnit(failoverUnitIds[0], failoverUnit));
+            VERIFY_IS_TRUE(static_cast<bool>(failoverUnit));
+        }
+
+        cache.TakeChangedFailoverUnits(changedFailoverUnits);
+        VERIFY_ARE_EQUAL(1u, changedFailoverUnits.size());
+        VERIFY_IS_TRUE(*changedFailoverUnits.begin() == failoverUnitIds[0]);
+
+        // Taking the changes clears them, so the next change is recorded again
+        {
+            LockedFailoverUnitPtr failoverUnit;
+            VERIFY_IS_TRUE(cache.TryGetLockedFailoverUnit(failoverUnitIds[0], failoverUnit));
+        }
+
+        changedFailoverUnits.clear();
+        cache.TakeChangedFailoverUnits(changedFailoverUnits);
+        VERIFY_ARE_EQUAL(1u, changedFailoverUnits.size());
+
+        // A FailoverUnit is only marked once it is locked, so a failed attempt does not mark it
+        {
+            LockedFailoverUnitPtr lockedFailoverUnit;
+            VERIFY_IS_TRUE(cache.TryGetLockedFailoverUnit(failoverUnitIds[1], lockedFailoverUnit));
+
+            changedFailoverUnits.clear();
+            cache.TakeChangedFailoverUnits(changedFailoverUnits);
+            VERIFY_ARE_EQUAL(1u, changedFailoverUnits.size());
+
+            LockedFailoverUnitPtr failoverUnit;
+            VERIFY_IS_FALSE(cache.TryGetLockedFailoverUnit(failoverUnitIds[1], failoverUnit, TimeSpan::Zero, false));
+
+            changedFailoverUnits.clear();
+            cache.TakeChangedFailoverUnits(changedFailoverUnits);
+            VERIFY_IS_TRUE(changedFailoverUnits.empty());
+        }
+
+        // Only the given FailoverUnits are visited and unknown ones are skipped
+        vector<FailoverUnitId> visitIds;
+        visitIds.push_back(failoverUnitIds[0]);
+        visitIds.push_back(FailoverUnitId(Guid::NewGuid()));
+
+        set<FailoverUnitId> fuSet;
+        visitor = cache.CreateVisitor(move(visitIds), timeout, false, false);
+        while (auto failoverUnit = visitor->MoveNext())
+        {
+            fuSet.insert(failoverUnit->Id);
+        }
+
+        VERIFY_ARE_EQUAL(1u, fuSet.size());
+
+        changedFailoverUnits.clear();
+        cache.TakeChangedFailoverUnits(changedFailoverUnits);
+        VERIFY_IS_TRUE(changedFailoverUnits.empty());
+
+        cache.ServiceLookupTable.Dispose();
+    }
+
+    BOOST_AUTO_TEST_CASE(ShardedConcurrentLookupTest)
+    {
+        // Concurrent lookups with either a single shard or the configured number of shards, with change
+        // tracking either off or on. Every lookup must succeed and the FailoverUnits they changed must be
+        // recorded exactly once. Throughput of FM message processing is measured by FM.Perf.
+        int configuredShardCount = FailoverConfig::GetConfig().FailoverUnitCacheShardCount;
+
+        vector<int> shardCounts;
+        shardCounts.push_back(1);
+        shardCounts.push_back(configuredShardCount);
+
+        for (int shardCount : shardCounts)
+        {
+            for (int trackChanges = 0; trackChanges < 2; trackChanges++)
+            {
+                FailoverConfig::GetConfig().FailoverUnitCacheShardCount = shardCount;
+                FailoverConfig::GetConfig().PeriodicStateFullScanInterval = trackChanges ? TimeSpan::FromMinutes(1) : TimeSpan::Zero;
+
+                vector<FailoverUnitUPtr> failoverUnits;
+                for (int i = 0; i < 100; i++)
+                {
+                    CreateFailoverUnitsFromService(services_[i % services_.size()], failoverUnits);
+                }
+
+                FailoverUnitCache cache(*fm_, failoverUnits, 0, *root_);
+                VERIFY_ARE_EQUAL(1000u, cache.Count);
+
+                vector<FailoverUnitId> failoverUnitIds;
+                FailoverUnitCache::VisitorSPtr visitor = cache.CreateVisitor(false, FailoverConfig::GetConfig().LockAcquireTimeout, false, false);
+                while (auto failoverUnit = visitor->MoveNext())
+                {
+                    failoverUnitIds.push_back(failoverUnit->Id);
+                }
+
+                // Drop the changes recorded when the cache was loaded
+                set<FailoverUnitId> changedFailoverUnits;
+                cache.TakeChangedFailoverUnits(changedFailoverUnits);
+
+                AutoResetEvent wait(false);
+
+                int64 maxThreadCount = 8;
+                int64 activeThreadCount = maxThreadCount;
+                int64 lookupCount = 0;
+                int lookupsPerThread = 20000;
+
+                for (int i = 0; i < maxThreadCount; i++)
+                {
+                    auto root = root_;
+                    Threadpool::Post([&cache, &failoverUnitIds, &activeThreadCount, &lookupCount, &wait, i, lookupsPerThread, root]()
+                    {
+                        Random random(i);
+                        for (int j = 0; j < lookupsPerThread; j++)
+                        {
+                            FailoverUnitId const& failoverUnitId = failoverUnitIds[random.Next(static_cast<int>(failoverUnitIds.size()))];
+
+                            LockedFailoverUnitPtr failoverUnit;
+                            if (cache.TryGetLockedFailoverUnit(failoverUnitId, failoverUnit) && cache.IsFailoverUnitValid(failoverUnitId))
+                            {
+                                InterlockedIncrement64(&lookupCount);
+                            }
+                        }
+
+                        if (InterlockedDecrement64(&activeThreadCount) == 0)
+                        {
+                            wait.Set();
+                        }
+                    });
+                }
+
+                wait.WaitOne();
+
+                VERIFY_ARE_EQUAL(maxThreadCount * lookupsPerThread, lookupCount);
+
+                // Replay the lookups of every thread to find the FailoverUnits they changed
+                set<FailoverUnitId> expectedChangedFailoverUnits;
+                if (trackChanges)
+                {
+                    for (int i = 0; i < maxThreadCount; i++)
+                    {
+                        Random random(i);
+                        for (int j = 0; j < lookupsPerThread; j++)
+                        {
+                            expectedChangedFailoverUnits.insert(failoverUnitIds[random.Next(static_cast<int>(failoverUnitIds.size()))]);
+                        }
+                    }
+                }
+
+                changedFailoverUnits.clear();
+                cache.TakeChangedFailoverUnits(changedFailoverUnits);
+                VERIFY_IS_TRUE(changedFailoverUnits == expectedChangedFailoverUnits);
+
+                cache.ServiceLookupTable.Dispose();
+            }
+        }
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
 
     void TestFailoverUnitCache::CreateFailoverUnitsFromService(ServiceInfoSPtr const& serviceInfo, vector<FailoverUnitUPtr> & failoverUnits)
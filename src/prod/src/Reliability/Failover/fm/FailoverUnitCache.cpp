@@ -66,18 +66,29 @@ private:
 FailoverUnitCache::Visitor::Visitor(FailoverUnitCache const& cache, 
                                     bool randomAccess,
                                     TimeSpan timeout,
-                                    bool executeStateMachine)
-    : cache_(cache), index_(-1), timeout_(timeout), executeStateMachine_(executeStateMachine)
+                                    bool executeStateMachine,
+                                    bool markChanged)
+    : cache_(cache), index_(-1), timeout_(timeout), executeStateMachine_(executeStateMachine), markChanged_(markChanged)
 {
-    for (auto it = cache.failoverUnits_.begin(); it != cache.failoverUnits_.end(); it++)
-    {
-        shuffleTable_.push_back(it->first);
-    }
+    cache.GetFailoverUnitIds(shuffleTable_);
 
     if (randomAccess)
     {
         random_shuffle(shuffleTable_.begin(), shuffleTable_.end());
     }
+    else
+    {
+        sort(shuffleTable_.begin(), shuffleTable_.end());
+    }
+}
+
+FailoverUnitCache::Visitor::Visitor(FailoverUnitCache const& cache,
+                                    vector<FailoverUnitId> && failoverUnitIds,
+                                    TimeSpan timeout,
+                                    bool executeStateMachine,
+                                    bool markChanged)
+    : cache_(cache), shuffleTable_(move(failoverUnitIds)), index_(-1), timeout_(timeout), executeStateMachine_(executeStateMachine), markChanged_(markChanged)
+{
 }
 
 LockedFailoverUnitPtr FailoverUnitCache::Visitor::MoveNext()
@@ -102,7 +113,7 @@ LockedFailoverUnitPtr FailoverUnitCache::Visitor::MoveNext(__out bool & result,
         failoverUnitId = shuffleTable_[index];
 
         LockedFailoverUnitPtr failoverUnit;
-        if (cache_.TryGetLockedFailoverUnit(failoverUnitId, failoverUnit, timeout_, executeStateMachine_))
+        if (cache_.TryGetLockedFailoverUnit(failoverUnitId, failoverUnit, timeout_, executeStateMachine_, markChanged_))
         {
             if (failoverUnit)
             {
@@ -141,6 +152,8 @@ FailoverUnitCache::FailoverUnitCache(
     nodeCache_(fm.NodeCacheObj),
     serviceCache_(fm.ServiceCacheObj),
     loadCache_(fm.LoadCacheObj),
+    shards_(),
+    count_(0),
     serviceLookupTable_(fm, failoverUnits, savedLookupVersion, root),
     savedLookupVersion_(savedLookupVersion),
     healthSequence_(0),
@@ -149,6 +162,12 @@ FailoverUnitCache::FailoverUnitCache(
     invalidateSequence_(0),
     healthInitialized_(false)
 {
+    int shardCount = max(FailoverConfig::GetConfig().FailoverUnitCacheShardCount, 1);
+    for (int i = 0; i < shardCount; i++)
+    {
+        shards_.push_back(make_unique<Shard>());
+    }
+
     int64 plbElapsedMilliseconds;
     for (size_t i = 0; i < failoverUnits.size(); i++)
     {
@@ -163,7 +182,10 @@ FailoverUnitCache::FailoverUnitCache(
         }
 
         FailoverUnitId failoverUnitId = failoverUnits[i]->Id;
-        failoverUnits_.insert(make_pair(failoverUnitId, make_shared<FailoverUnitCacheEntry>(fm_, move(failoverUnits[i]))));
+        if (GetShard(failoverUnitId).Insert(failoverUnitId, make_shared<FailoverUnitCacheEntry>(fm_, move(failoverUnits[i]))))
+        {
+            count_++;
+        }
     }
 
     fm_.InBuildFailoverUnitCacheObj.InitializeHealthSequence(healthSequence_);
@@ -179,10 +201,123 @@ FailoverUnitCache::FailoverUnitCache(
     }
 }
 
-size_t FailoverUnitCache::get_Count() const
+FailoverUnitCache::Shard::Shard()
+{
+}
+
+FailoverUnitCacheEntrySPtr FailoverUnitCache::Shard::Find(FailoverUnitId const& failoverUnitId) const
 {
     AcquireReadLock grab(lock_);
-    return failoverUnits_.size(); 
+
+    auto it = failoverUnits_.find(failoverUnitId);
+    if (it == failoverUnits_.end())
+    {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+bool FailoverUnitCache::Shard::Insert(FailoverUnitId const& failoverUnitId, FailoverUnitCacheEntrySPtr const& entry)
+{
+    AcquireWriteLock grab(lock_);
+    return failoverUnits_.insert(make_pair(failoverUnitId, entry)).second;
+}
+
+FailoverUnitCacheEntrySPtr FailoverUnitCache::Shard::Erase(FailoverUnitId const& failoverUnitId)
+{
+    FailoverUnitCacheEntrySPtr entry;
+
+    AcquireWriteLock grab(lock_);
+
+    auto it = failoverUnits_.find(failoverUnitId);
+    if (it != failoverUnits_.end())
+    {
+        entry = move(it->second);
+        failoverUnits_.erase(it);
+    }
+
+    return entry;
+}
+
+void FailoverUnitCache::Shard::GetFailoverUnitIds(vector<FailoverUnitId> & failoverUnitIds) const
+{
+    AcquireReadLock grab(lock_);
+
+    for (auto it = failoverUnits_.begin(); it != failoverUnits_.end(); ++it)
+    {
+        failoverUnitIds.push_back(it->first);
+    }
+}
+
+void FailoverUnitCache::Shard::AddChanged(FailoverUnitId const& failoverUnitId, FailoverUnitCacheEntrySPtr const& entry)
+{
+    AcquireExclusiveLock grab(changedEntriesLock_);
+    changedEntries_.push_back(make_pair(failoverUnitId, entry));
+}
+
+void FailoverUnitCache::Shard::TakeChanged(set<FailoverUnitId> & failoverUnitIds)
+{
+    vector<pair<FailoverUnitId, FailoverUnitCacheEntrySPtr>> changedEntries;
+
+    {
+        AcquireExclusiveLock grab(changedEntriesLock_);
+        swap(changedEntries, changedEntries_);
+    }
+
+    // Entries are marked while their FailoverUnit is locked or after a task is queued on it.
+    // A change marked after the flag is cleared is recorded again. A change whose mark is
+    // taken here is either complete, so the visit that follows sees it, or still holds the
+    // lock, so the visit fails to lock the FailoverUnit and the background manager carries
+    // it over as unprocessed to the next run.
+    for (auto it = changedEntries.begin(); it != changedEntries.end(); ++it)
+    {
+        it->second->ClearChanged();
+        failoverUnitIds.insert(it->first);
+    }
+}
+
+FailoverUnitCache::Shard & FailoverUnitCache::GetShard(FailoverUnitId const& failoverUnitId) const
+{
+    size_t hash = static_cast<size_t>(static_cast<uint>(failoverUnitId.Guid.GetHashCode()));
+    return *shards_[hash % shards_.size()];
+}
+
+FailoverUnitCacheEntrySPtr FailoverUnitCache::GetEntry(FailoverUnitId const& failoverUnitId) const
+{
+    return GetShard(failoverUnitId).Find(failoverUnitId);
+}
+
+void FailoverUnitCache::EraseFailoverUnit(FailoverUnit const& failoverUnit)
+{
+    // The caller holds lock_, which serializes inserts and erases with the lookup table
+    auto entry = GetShard(failoverUnit.Id).Erase(failoverUnit.Id);
+
+    if (entry)
+    {
+        entry->IsDeleted = true;
+        InterlockedDecrement(&count_);
+        serviceLookupTable_.RemoveEntry(failoverUnit);
+    }
+    else
+    {
+        fm_.FTEvents.FTUpdateFailureBecauseAlreadyDeleted(failoverUnit.Id.Guid);
+    }
+}
+
+void FailoverUnitCache::GetFailoverUnitIds(vector<FailoverUnitId> & failoverUnitIds) const
+{
+    failoverUnitIds.reserve(Count);
+
+    for (auto const& shard : shards_)
+    {
+        shard->GetFailoverUnitIds(failoverUnitIds);
+    }
+}
+
+size_t FailoverUnitCache::get_Count() const
+{
+    return static_cast<size_t>(count_);
 }
 
 void FailoverUnitCache::InsertFailoverUnitInCache(FailoverUnitUPtr && failoverUnit)
@@ -190,8 +325,9 @@ void FailoverUnitCache::InsertFailoverUnitInCache(FailoverUnitUPtr && failoverUn
     AcquireWriteLock grab(lock_);
 
     FailoverUnitId failoverUnitId = failoverUnit->Id;
+    Shard & shard = GetShard(failoverUnitId);
 
-    if (failoverUnits_.find(failoverUnitId) != failoverUnits_.end())
+    if (shard.Find(failoverUnitId))
     {
         fm_.WriteError(TraceFTCache, failoverUnit->IdString,
             "Cannot insert FailoverUnit. A FailoverUnit with the same ID already exists: {0}", failoverUnitId);
@@ -199,9 +335,12 @@ void FailoverUnitCache::InsertFailoverUnitInCache(FailoverUnitUPtr && failoverUn
     }
 
     auto failoverUnitCacheEntry = make_shared<FailoverUnitCacheEntry>(fm_, move(failoverUnit));
-    auto result = failoverUnits_.insert(make_pair(failoverUnitId, failoverUnitCacheEntry));
+    shard.Insert(failoverUnitId, failoverUnitCacheEntry);
+    InterlockedIncrement(&count_);
 
-    FailoverUnit & insertedFailoverUnit = *(result.first->second->FailoverUnit);
+    MarkChanged(failoverUnitId, failoverUnitCacheEntry);
+
+    FailoverUnit & insertedFailoverUnit = *(failoverUnitCacheEntry->FailoverUnit);
 
     // Update ServiceLookupTable
     serviceLookupTable_.Update(insertedFailoverUnit);
@@ -359,19 +498,7 @@ ErrorCode FailoverUnitCache::PostUpdateFailoverUnit(
         if (persistenceState == PersistenceState::ToBeDeleted)
         {
             AcquireWriteLock grab(lock_);
-
-            auto it = failoverUnits_.find(failoverUnit->Id);
-
-            if (it != failoverUnits_.end())
-            {
-                it->second->IsDeleted = true;
-                failoverUnits_.erase(it);
-                serviceLookupTable_.RemoveEntry(*failoverUnit);
-            }
-            else
-            {
-                fm_.FTEvents.FTUpdateFailureBecauseAlreadyDeleted(failoverUnit->Id.Guid);
-            }
+            EraseFailoverUnit(*failoverUnit);
 
             fm_.FTEvents.PartitionDeleted(failoverUnit->IdString, failoverUnit->CurrentConfigurationVersion);
         }
@@ -474,19 +601,7 @@ ErrorCode FailoverUnitCache::PostUpdateFailoverUnit(
                 if (error.ReadValue() == ErrorCodeValue::FMFailoverUnitNotFound)
                 {
                     AcquireWriteLock grab(lock_);
-
-                    auto it = failoverUnits_.find(failoverUnit->Id);
-
-                    if (it != failoverUnits_.end())
-                    {
-                        it->second->IsDeleted = true;
-                        failoverUnits_.erase(it);
-                        serviceLookupTable_.RemoveEntry(*failoverUnit);
-                    }
-                    else
-                    {
-                        fm_.FTEvents.FTUpdateFailureBecauseAlreadyDeleted(failoverUnit->Id.Guid);
-                    }
+                    EraseFailoverUnit(*failoverUnit);
 
                     fm_.FTEvents.PartitionDeleted(failoverUnit->IdString, failoverUnit->CurrentConfigurationVersion);
                 }
@@ -584,30 +699,52 @@ FailoverUnitCache::VisitorSPtr FailoverUnitCache::CreateVisitor(bool randomAcces
     return CreateVisitor(randomAccess, FailoverConfig::GetConfig().LockAcquireTimeout);
 }
 
-FailoverUnitCache::VisitorSPtr FailoverUnitCache::CreateVisitor(bool randomAccess, TimeSpan timeout, bool executeStateMachine) const
+FailoverUnitCache::VisitorSPtr FailoverUnitCache::CreateVisitor(bool randomAccess, TimeSpan timeout, bool executeStateMachine, bool markChanged) const
 {
-    AcquireReadLock grab(lock_);
-    return make_shared<Visitor>(*this, randomAccess, timeout, executeStateMachine);
+    return make_shared<Visitor>(*this, randomAccess, timeout, executeStateMachine, markChanged);
 }
 
-bool FailoverUnitCache::TryProcessTaskAsync(FailoverUnitId failoverUnitId, DynamicStateMachineTaskUPtr & task, Federation::NodeInstance const & from, bool const isFromPLB) const
+FailoverUnitCache::VisitorSPtr FailoverUnitCache::CreateVisitor(vector<FailoverUnitId> && failoverUnitIds, TimeSpan timeout, bool executeStateMachine, bool markChanged) const
 {
-    FailoverUnitCacheEntrySPtr entry;
+    return make_shared<Visitor>(*this, move(failoverUnitIds), timeout, executeStateMachine, markChanged);
+}
+
+void FailoverUnitCache::TakeChangedFailoverUnits(set<FailoverUnitId> & failoverUnitIds)
+{
+    for (auto const& shard : shards_)
+    {
+        shard->TakeChanged(failoverUnitIds);
+    }
+}
 
+void FailoverUnitCache::MarkChanged(FailoverUnitId const& failoverUnitId, FailoverUnitCacheEntrySPtr const& entry) const
+{
+    // Changes are only used by background runs between full scans
+    if (FailoverConfig::GetConfig().PeriodicStateFullScanInterval <= TimeSpan::Zero)
     {
-        AcquireReadLock grab(lock_);
+        return;
+    }
 
-        auto it = failoverUnits_.find(failoverUnitId);
-        if (it == failoverUnits_.end())
-        {
-            return false;
-        }
+    // Only the first change since the last TakeChangedFailoverUnits takes the shard's lock
+    if (entry->TryMarkChanged())
+    {
+        GetShard(failoverUnitId).AddChanged(failoverUnitId, entry);
+    }
+}
 
-        entry = it->second;
+bool FailoverUnitCache::TryProcessTaskAsync(FailoverUnitId failoverUnitId, DynamicStateMachineTaskUPtr & task, Federation::NodeInstance const & from, bool const isFromPLB) const
+{
+    FailoverUnitCacheEntrySPtr entry = GetEntry(failoverUnitId);
+    if (!entry)
+    {
+        return false;
     }
 
     entry->ProcessTaskAsync(move(task), from, isFromPLB);
 
+    // Marked once the task is pending, so a background run that takes the mark finds it
+    MarkChanged(failoverUnitId, entry);
+
     return true;
 }
 
@@ -624,18 +761,20 @@ bool FailoverUnitCache::TryGetLockedFailoverUnit(
     TimeSpan timeout,
     bool executeStateMachine) const
 {
-    FailoverUnitCacheEntrySPtr entry;
+    return TryGetLockedFailoverUnit(failoverUnitId, failoverUnit, timeout, executeStateMachine, true);
+}
 
+bool FailoverUnitCache::TryGetLockedFailoverUnit(
+    FailoverUnitId const& failoverUnitId,
+    __out LockedFailoverUnitPtr & failoverUnit,
+    TimeSpan timeout,
+    bool executeStateMachine,
+    bool markChanged) const
+{
+    FailoverUnitCacheEntrySPtr entry = GetEntry(failoverUnitId);
+    if (!entry)
     {
-        AcquireReadLock grab(lock_);
-
-        auto it = failoverUnits_.find(failoverUnitId);
-        if (it == failoverUnits_.end())
-        {
-            return true;
-        }
-
-        entry = it->second;
+        return true;
     }
 
     bool isDeleted;
@@ -643,6 +782,13 @@ bool FailoverUnitCache::TryGetLockedFailoverUnit(
     {
         if (!isDeleted)
         {
+            // Marked while the lock is held, so a background visit that takes the mark
+            // cannot lock the FailoverUnit until the change is complete
+            if (markChanged)
+            {
+                MarkChanged(failoverUnitId, entry);
+            }
+
             failoverUnit = LockedFailoverUnitPtr(entry);
         }
 
@@ -655,17 +801,13 @@ bool FailoverUnitCache::TryGetLockedFailoverUnit(
 
 bool FailoverUnitCache::IsFailoverUnitValid(FailoverUnitId const& failoverUnitId) const
 {
-    AcquireReadLock grab(lock_);
-
-    auto it = failoverUnits_.find(failoverUnitId);
-    return (it != failoverUnits_.end() && !it->second->FailoverUnit->IsToBeDeleted);
+    FailoverUnitCacheEntrySPtr entry = GetEntry(failoverUnitId);
+    return (entry && !entry->FailoverUnit->IsToBeDeleted);
 }
 
 bool FailoverUnitCache::FailoverUnitExists(FailoverUnitId const& failoverUnitId) const
 {
-    AcquireReadLock grab(lock_);
-    auto it = failoverUnits_.find(failoverUnitId);
-    return (it != failoverUnits_.end());
+    return (GetEntry(failoverUnitId) != nullptr);
 }
 
 bool FailoverUnitCache::IsSafeToRemove(FailoverUnit const& failoverUnit) const
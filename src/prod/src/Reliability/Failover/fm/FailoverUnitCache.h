@@ -32,7 +32,8 @@ namespace Reliability
                 DENY_COPY(Visitor);
 
             public:
-                Visitor(FailoverUnitCache const& cache, bool randomAccess, Common::TimeSpan timeout, bool executeStateMachine);
+                Visitor(FailoverUnitCache const& cache, bool randomAccess, Common::TimeSpan timeout, bool executeStateMachine, bool markChanged);
+                Visitor(FailoverUnitCache const& cache, std::vector<FailoverUnitId> && failoverUnitIds, Common::TimeSpan timeout, bool executeStateMachine, bool markChanged);
 
                 LockedFailoverUnitPtr MoveNext();
                 LockedFailoverUnitPtr MoveNext(__out bool & result, FailoverUnitId & failoverUnitId);
@@ -45,6 +46,7 @@ namespace Reliability
                 LONG index_;
                 Common::TimeSpan timeout_;
                 bool executeStateMachine_;
+                bool markChanged_;
             };
 
             typedef std::shared_ptr<FailoverUnitCache::Visitor> VisitorSPtr;
@@ -82,9 +84,17 @@ namespace Reliability
 
             void InsertFailoverUnitInCache(FailoverUnitUPtr&& failoverUnit);
 
-            VisitorSPtr CreateVisitor(bool randomAccess, Common::TimeSpan timeout, bool executeStateMachine = false) const;
+            VisitorSPtr CreateVisitor(bool randomAccess, Common::TimeSpan timeout, bool executeStateMachine = false, bool markChanged = true) const;
             VisitorSPtr CreateVisitor(bool randomAccess = false) const;
 
+            // Creates a visitor for the given FailoverUnits only. FailoverUnits that no longer exist are skipped.
+            VisitorSPtr CreateVisitor(std::vector<FailoverUnitId> && failoverUnitIds, Common::TimeSpan timeout, bool executeStateMachine = false, bool markChanged = true) const;
+
+            // Moves the FailoverUnits that were locked or inserted since the last call into the given set.
+            // Locks taken by visitors created with markChanged set to false are not tracked, and nothing
+            // is tracked while PeriodicStateFullScanInterval is zero, because every background run is a full scan.
+            void TakeChangedFailoverUnits(__inout std::set<FailoverUnitId> & failoverUnitIds);
+
             bool TryProcessTaskAsync(FailoverUnitId failoverUnitId, DynamicStateMachineTaskUPtr & task, Federation::NodeInstance const & from, bool const isFromPLB = false) const;
 
             bool TryGetLockedFailoverUnit(
@@ -131,6 +141,53 @@ namespace Reliability
 
             void UpdatePlacementAndLoadBalancer(LockedFailoverUnitPtr & failoverUnit, PersistenceState::Enum pstate, __out int64 & plbDuration) const;
 
+            bool TryGetLockedFailoverUnit(
+                FailoverUnitId const& failoverUnitId,
+                __out LockedFailoverUnitPtr & failoverUnit,
+                Common::TimeSpan timeout,
+                bool executeStateMachine,
+                bool markChanged) const;
+
+            void MarkChanged(FailoverUnitId const& failoverUnitId, FailoverUnitCacheEntrySPtr const& entry) const;
+
+            // FailoverUnits are split into shards by the hash of their id. Lookups only take the
+            // read lock of their shard, so they do not contend with lookups in other shards or with
+            // the cache-wide lock_ that protects the lookup table and health sequences.
+            // Changed FailoverUnits are recorded per shard as well.
+            class Shard
+            {
+                DENY_COPY(Shard);
+
+            public:
+                Shard();
+
+                FailoverUnitCacheEntrySPtr Find(FailoverUnitId const& failoverUnitId) const;
+                bool Insert(FailoverUnitId const& failoverUnitId, FailoverUnitCacheEntrySPtr const& entry);
+                FailoverUnitCacheEntrySPtr Erase(FailoverUnitId const& failoverUnitId);
+                void GetFailoverUnitIds(__inout std::vector<FailoverUnitId> & failoverUnitIds) const;
+
+                // Called once per entry until the changes are taken, see FailoverUnitCacheEntry::TryMarkChanged.
+                void AddChanged(FailoverUnitId const& failoverUnitId, FailoverUnitCacheEntrySPtr const& entry);
+                void TakeChanged(__inout std::set<FailoverUnitId> & failoverUnitIds);
+
+            private:
+                std::map<FailoverUnitId, FailoverUnitCacheEntrySPtr> failoverUnits_;
+
+                MUTABLE_RWLOCK(FM.FailoverUnitCacheShard, lock_);
+
+                // FailoverUnits of this shard changed since the background manager last took them.
+                std::vector<std::pair<FailoverUnitId, FailoverUnitCacheEntrySPtr>> changedEntries_;
+                Common::ExclusiveLock changedEntriesLock_;
+            };
+
+            Shard & GetShard(FailoverUnitId const& failoverUnitId) const;
+
+            FailoverUnitCacheEntrySPtr GetEntry(FailoverUnitId const& failoverUnitId) const;
+
+            void EraseFailoverUnit(FailoverUnit const& failoverUnit);
+
+            void GetFailoverUnitIds(__out std::vector<FailoverUnitId> & failoverUnitIds) const;
+
             FailoverManager& fm_;
             FailoverManagerStore& fmStore_;
             InstrumentedPLB & plb_;
@@ -139,7 +196,8 @@ namespace Reliability
             ServiceCache & serviceCache_;
             LoadCache & loadCache_;
 
-            std::map<FailoverUnitId, FailoverUnitCacheEntrySPtr> failoverUnits_;
+            std::vector<std::unique_ptr<Shard>> shards_;
+            LONG count_;
 
             FMServiceLookupTable serviceLookupTable_;
             int64 savedLookupVersion_;
@@ -17,7 +17,8 @@ FailoverUnitCacheEntry::FailoverUnitCacheEntry(FailoverManager& fm, FailoverUnit
         wait_(lock_),
         waitCount_(0),
         isFree_(true),
-        isDeleted_(false)
+        isDeleted_(false),
+        isChanged_(0)
 {
 }
 
@@ -31,6 +31,10 @@ namespace Reliability
             bool Lock(Common::TimeSpan timeout, bool executeStateMachine, bool & isDeleted);
             bool Release(bool restoreExecutingTask, bool processPendingTask);
 
+            // Returns true if the entry was not already marked as changed, in which case the caller records the change.
+            bool TryMarkChanged() { return InterlockedExchange(&isChanged_, 1) == 0; }
+            void ClearChanged() { InterlockedExchange(&isChanged_, 0); }
+
         private:
             FailoverManager& fm_;
             FailoverUnitUPtr failoverUnit_;
@@ -45,6 +49,7 @@ namespace Reliability
             int waitCount_;
             bool isFree_;
             bool isDeleted_;
+            LONG isChanged_;
         };
     }
 }
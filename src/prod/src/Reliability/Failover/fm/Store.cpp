@@ -87,6 +87,164 @@ private:
     IReplicatedStoreUPtr replicatedStore_;
 };
 
+// Writes one item and commits its transaction using the asynchronous store operations,
+// so that the calling thread is not blocked while the store waits on locks or I/O.
+class FailoverManagerStore::UpdateDataAsyncOperation : public AsyncOperation
+{
+    DENY_COPY(UpdateDataAsyncOperation);
+
+public:
+    UpdateDataAsyncOperation(
+        ErrorCode const & error,
+        Stopwatch const & stopwatch,
+        AsyncCallback const & callback,
+        AsyncOperationSPtr const & parent)
+        : AsyncOperation(callback, parent)
+        , error_(error)
+        , store_()
+        , tx_()
+        , persistenceState_(PersistenceState::NoChange)
+        , type_()
+        , key_()
+        , currentSequenceNumber_(0)
+        , buffer_()
+        , stopwatch_(stopwatch)
+        , operationLSN_(0)
+    {
+    }
+
+    UpdateDataAsyncOperation(
+        RootedStore const & store,
+        IStoreBase::TransactionSPtr && tx,
+        PersistenceState::Enum persistenceState,
+        wstring const & type,
+        wstring const & key,
+        int64 currentSequenceNumber,
+        vector<byte> && buffer,
+        Stopwatch const & stopwatch,
+        AsyncCallback const & callback,
+        AsyncOperationSPtr const & parent)
+        : AsyncOperation(callback, parent)
+        , error_(ErrorCodeValue::Success)
+        , store_(store)
+        , tx_(move(tx))
+        , persistenceState_(persistenceState)
+        , type_(type)
+        , key_(key)
+        , currentSequenceNumber_(currentSequenceNumber)
+        , buffer_(move(buffer))
+        , stopwatch_(stopwatch)
+        , operationLSN_(0)
+    {
+    }
+
+    static ErrorCode End(AsyncOperationSPtr const & operation, __out int64 & operationLSN, __out int64 & commitDuration)
+    {
+        auto casted = AsyncOperation::End<UpdateDataAsyncOperation>(operation);
+
+        operationLSN = casted->operationLSN_;
+        commitDuration = casted->stopwatch_.ElapsedMilliseconds;
+
+        return casted->Error;
+    }
+
+protected:
+    void OnStart(AsyncOperationSPtr const & thisSPtr) override
+    {
+        if (!error_.IsSuccess())
+        {
+            Complete(thisSPtr, error_);
+            return;
+        }
+
+        AsyncOperationSPtr operation;
+
+        if (persistenceState_ == PersistenceState::ToBeInserted)
+        {
+            operation = store_->BeginInsert(
+                tx_,
+                type_,
+                key_,
+                buffer_.data(),
+                buffer_.size(),
+                [this](AsyncOperationSPtr const & operation) { this->OnWriteCompleted(operation, false); },
+                thisSPtr);
+        }
+        else if (persistenceState_ == PersistenceState::ToBeUpdated)
+        {
+            operation = store_->BeginUpdate(
+                tx_,
+                type_,
+                key_,
+                currentSequenceNumber_,
+                key_,
+                buffer_.data(),
+                buffer_.size(),
+                [this](AsyncOperationSPtr const & operation) { this->OnWriteCompleted(operation, false); },
+                thisSPtr);
+        }
+        else
+        {
+            operation = store_->BeginDelete(
+                tx_,
+                type_,
+                key_,
+                currentSequenceNumber_,
+                [this](AsyncOperationSPtr const & operation) { this->OnWriteCompleted(operation, false); },
+                thisSPtr);
+        }
+
+        this->OnWriteCompleted(operation, true);
+    }
+
+private:
+    void OnWriteCompleted(AsyncOperationSPtr const & operation, bool expectedCompletedSynchronously)
+    {
+        if (operation->CompletedSynchronously != expectedCompletedSynchronously) { return; }
+
+        auto error = store_->EndWrite(operation);
+        if (!error.IsSuccess())
+        {
+            tx_->Rollback();
+            Complete(operation->Parent, error);
+            return;
+        }
+
+        auto commitOperation = tx_->BeginCommit(
+            TimeSpan::MaxValue,
+            [this](AsyncOperationSPtr const & operation) { this->OnCommitCompleted(operation, false); },
+            operation->Parent);
+
+        this->OnCommitCompleted(commitOperation, true);
+    }
+
+    void OnCommitCompleted(AsyncOperationSPtr const & operation, bool expectedCompletedSynchronously)
+    {
+        if (operation->CompletedSynchronously != expectedCompletedSynchronously) { return; }
+
+        auto error = tx_->EndCommit(operation, operationLSN_);
+
+        Complete(operation->Parent, error);
+    }
+
+    void Complete(AsyncOperationSPtr const & thisSPtr, ErrorCode const & error)
+    {
+        stopwatch_.Stop();
+        this->TryComplete(thisSPtr, error);
+    }
+
+    ErrorCode error_;
+    RootedStore store_;
+    IStoreBase::TransactionSPtr tx_;
+    PersistenceState::Enum persistenceState_;
+    wstring type_;
+    wstring key_;
+    int64 currentSequenceNumber_;
+    vector<byte> buffer_;
+    Stopwatch stopwatch_;
+    int64 operationLSN_;
+};
+
 FailoverManagerStore::FailoverManagerStore(RootedObjectPointer<IReplicatedStore> && replicatedStore)
     : storeSPtr_(make_shared<RootedStore>(move(replicatedStore)))
     , storeWPtr_(storeSPtr_)
@@ -249,48 +407,73 @@ AsyncOperationSPtr FailoverManagerStore::BeginUpdateData(
     Stopwatch stopwatch;
     stopwatch.Start();
 
+    RootedStoreSPtr rootedStoreSPtr;
+    auto error = this->TryGetStore(rootedStoreSPtr);
+    if (!error.IsSuccess())
+    {
+        return AsyncOperation::CreateAndStart<UpdateDataAsyncOperation>(error, stopwatch, callback, state);
+    }
+
     IStoreBase::TransactionSPtr tx;
-    ErrorCode error = BeginSimpleTransaction(tx);
-    
-    if (error.IsSuccess())
+    error = BeginSimpleTransaction(tx);
+    if (!error.IsSuccess())
     {
-        ASSERT_IF(tx.get() == nullptr, "Transaction is null.");
+        return AsyncOperation::CreateAndStart<UpdateDataAsyncOperation>(error, stopwatch, callback, state);
+    }
 
-        error = UpdateData(tx, data);
-        if (error.IsSuccess())
+    ASSERT_IF(tx.get() == nullptr, "Transaction is null.");
+
+    __if_exists(TData::PostUpdate)
+    {
+        data.PostUpdate(DateTime::Now());
+    }
+
+    PersistenceState::Enum persistenceState = data.PersistenceState;
+    ASSERT_IF(
+        persistenceState != PersistenceState::ToBeInserted &&
+        persistenceState != PersistenceState::ToBeUpdated &&
+        persistenceState != PersistenceState::ToBeDeleted,
+        "Invalid PersistenceState: {0}", persistenceState);
+
+    vector<byte> buffer;
+    if (persistenceState != PersistenceState::ToBeDeleted)
+    {
+        buffer.reserve(StoreDataBufferSize);
+
+        error = FabricSerializer::Serialize(&data, buffer);
+        if (!error.IsSuccess())
         {
-            auto transaction = tx.get();
-            return transaction->BeginCommit(TimeSpan::MaxValue, OperationContextCallback<pair<IStoreBase::TransactionSPtr, Stopwatch>>(callback, make_pair(move(tx), stopwatch)), state);
+            tx->Rollback();
+            return AsyncOperation::CreateAndStart<UpdateDataAsyncOperation>(error, stopwatch, callback, state);
         }
-
-        tx->Rollback();
     }
 
-    return AsyncOperation::CreateAndStart<CompletedAsyncOperation>(error, callback, state);
+    return AsyncOperation::CreateAndStart<UpdateDataAsyncOperation>(
+        *rootedStoreSPtr,
+        move(tx),
+        persistenceState,
+        TData::GetStoreType(),
+        data.GetStoreKey(),
+        data.OperationLSN,
+        move(buffer),
+        stopwatch,
+        callback,
+        state);
 }
 
 template <typename TData>
 ErrorCode FailoverManagerStore::EndUpdateData(TData & data, AsyncOperationSPtr const& updateOperation, __out int64 & commitDuration) const
 {
-    unique_ptr<OperationContext<pair<IStoreBase::TransactionSPtr, Stopwatch>>> context = updateOperation->PopOperationContext<pair<IStoreBase::TransactionSPtr, Stopwatch>>();
-    if (context)
-    {
-        int64 operationLSN = 0;
-
-        ErrorCode error = context->Context.first->EndCommit(updateOperation, operationLSN);
-
-        if (error.IsSuccess())
-        {
-            data.PostCommit(operationLSN);
-        }
+    int64 operationLSN = 0;
 
-        context->Context.second.Stop();
-        commitDuration = context->Context.second.ElapsedMilliseconds;
+    ErrorCode error = UpdateDataAsyncOperation::End(updateOperation, operationLSN, commitDuration);
 
-        return error;
+    if (error.IsSuccess())
+    {
+        data.PostCommit(operationLSN);
     }
-    
-    return CompletedAsyncOperation::End(updateOperation);
+
+    return error;
 }
 
 ErrorCode FailoverManagerStore::GetKeyValues(__out map<wstring, wstring>& keyValues) const
@@ -100,6 +100,7 @@ namespace Reliability
 
         private:
             class IReplicatedStoreHolder;
+            class UpdateDataAsyncOperation;
 
             typedef Common::RootedObjectPointer<Store::IReplicatedStore> RootedStore;
             typedef std::shared_ptr<RootedStore> RootedStoreSPtr;
@@ -14,11 +14,15 @@ namespace Reliability
             class CommitEntityPerformanceData
             {
             public:
-                CommitEntityPerformanceData() : wasReported_(false) {}
+                CommitEntityPerformanceData() : wasReported_(false), batchSize_(0) {}
 
                 __declspec(property(get = get_CommitDuration)) Common::TimeSpan CommitDuration;
                 Common::TimeSpan get_CommitDuration() const { return stopwatch_.Elapsed; }
 
+                // The number of entity commits persisted in the same store transaction as this commit
+                __declspec(property(get = get_BatchSize)) size_t BatchSize;
+                size_t get_BatchSize() const { return batchSize_; }
+
                 void OnStoreCommitStart(Infrastructure::IClock & clock)
                 {
                     wasReported_ = true;
@@ -26,8 +30,14 @@ namespace Reliability
                 }
 
                 void OnStoreCommitEnd(Infrastructure::IClock & clock)
+                {
+                    OnStoreCommitEnd(clock, 1);
+                }
+
+                void OnStoreCommitEnd(Infrastructure::IClock & clock, size_t batchSize)
                 {
                     stopwatch_.Stop(clock);
+                    batchSize_ = batchSize;
                 }
 
                 void ReportPerformanceData(RAPerformanceCounters & perfCounters) const
@@ -47,22 +57,25 @@ namespace Reliability
                 {
                     size_t index = 0;
                     traceEvent.AddEventField<int64>("commitDuration", index);
+                    traceEvent.AddEventField<uint64>("batchSize", index);
 
-                    return "CommitDuration: {0}ms";
+                    return "CommitDuration: {0}ms BatchSize: {1}";
                 }
 
                 void FillEventData(Common::TraceEventContext & context) const
                 {
                     context.WriteCopy<int64>(CommitDuration.TotalMilliseconds());
+                    context.WriteCopy<uint64>(static_cast<uint64>(batchSize_));
                 }
 
                 void WriteTo(Common::TextWriter& w, Common::FormatOptions const &) const
                 {
-                    w << Common::wformatString("CommitDuration: {0}ms", CommitDuration.TotalMilliseconds());
+                    w << Common::wformatString("CommitDuration: {0}ms BatchSize: {1}", CommitDuration.TotalMilliseconds(), batchSize_);
                 }
 
             private:
                 bool wasReported_;
+                size_t batchSize_;
                 Infrastructure::RAStopwatch stopwatch_;
             };
         }
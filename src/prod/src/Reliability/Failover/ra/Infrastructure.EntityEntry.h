@@ -154,9 +154,11 @@ namespace Reliability
                         parent);
                 }
 
-                Common::ErrorCode EndCommit(Common::AsyncOperationSPtr const & operation)
+                Common::ErrorCode EndCommit(
+                    Common::AsyncOperationSPtr const & operation,
+                    __out size_t & batchSize) override
                 {
-                    return store_->EndStoreOperation(operation);
+                    return store_->EndStoreOperation(operation, batchSize);
                 }
 
             private:
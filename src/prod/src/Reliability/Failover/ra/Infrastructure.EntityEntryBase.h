@@ -52,7 +52,9 @@ namespace Reliability
                     Common::AsyncCallback const & callback,
                     Common::AsyncOperationSPtr const & parent) = 0;
 
-                virtual Common::ErrorCode EndCommit(Common::AsyncOperationSPtr const & operation) = 0;
+                virtual Common::ErrorCode EndCommit(
+                    Common::AsyncOperationSPtr const & operation,
+                    __out size_t & batchSize) = 0;
 
                 template < typename T >
                 T & As()
@@ -270,10 +270,11 @@ namespace Reliability
                     void FinishStoreOperation(
                         Common::AsyncOperationSPtr const & storeOperation)
                     {
-                        auto error = entry_->EndCommit(storeOperation);
+                        size_t batchSize = 1;
+                        auto error = entry_->EndCommit(storeOperation, batchSize);
                         AssertOnInconsistency(storeOperation->Parent, error);
 
-                        commitPerfData_.OnStoreCommitEnd(entityMap_.clock_);
+                        commitPerfData_.OnStoreCommitEnd(entityMap_.clock_, batchSize);
 
                         if (!error.IsSuccess())
                         {
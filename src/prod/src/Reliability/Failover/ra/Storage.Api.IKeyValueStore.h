@@ -54,6 +54,18 @@ namespace Reliability
 
                     virtual Common::ErrorCode EndStoreOperation(Common::AsyncOperationSPtr const & operation) = 0;
 
+                    /*
+                        Same as above and also returns the number of operations that were persisted
+                        in the same store transaction as this operation (including itself)
+                    */
+                    virtual Common::ErrorCode EndStoreOperation(
+                        Common::AsyncOperationSPtr const & operation,
+                        __out size_t & batchSize)
+                    {
+                        batchSize = 1;
+                        return EndStoreOperation(operation);
+                    }
+
                     virtual void Close() = 0;
                 };
             }
@@ -32,11 +32,15 @@ public:
         id_(id),
         bytes_(move(bytes)),
         timeout_(timeout),
+        batchSize_(1),
         AsyncOperation(callback, parent)
     {
     }
 
 public:
+    __declspec(property(get = get_BatchSize)) size_t BatchSize;
+    size_t get_BatchSize() const { return batchSize_; }
+
     void FinishAsync(AsyncOperationSPtr const & thisSPtr)
     {
         ASSERT_IF(!isAsync_, "Trying to finish non async");
@@ -64,7 +68,7 @@ protected:
             timeout_,
             [this](AsyncOperationSPtr op)
             {
-                auto result = innerStore_->EndStoreOperation(op);
+                auto result = innerStore_->EndStoreOperation(op, batchSize_);
 
                 // If the adapter is in async mode
                 // then thisSPtr must be completed by explicitly
@@ -97,6 +101,7 @@ private:
     RowIdentifier id_;
     RowData bytes_;
     TimeSpan timeout_;
+    size_t batchSize_;
 };
 
 FaultInjectionAdapter::FaultInjectionAdapter(IKeyValueStoreSPtr const & inner) :
@@ -178,6 +183,13 @@ ErrorCode FaultInjectionAdapter::EndStoreOperation(AsyncOperationSPtr const & op
     return AsyncOperation::End(operation);
 }
 
+ErrorCode FaultInjectionAdapter::EndStoreOperation(AsyncOperationSPtr const & operation, __out size_t & batchSize)
+{
+    auto casted = AsyncOperation::End<FaultInjectionAsyncOperation>(operation);
+    batchSize = casted->BatchSize;
+    return casted->Error;
+}
+
 void FaultInjectionAdapter::Close()
 {
     inner_->Close();
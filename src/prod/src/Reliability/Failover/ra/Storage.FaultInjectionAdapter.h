@@ -71,6 +71,10 @@ namespace Reliability
 
                 Common::ErrorCode EndStoreOperation(Common::AsyncOperationSPtr const & operation) override;
 
+                Common::ErrorCode EndStoreOperation(
+                    Common::AsyncOperationSPtr const & operation,
+                    __out size_t & batchSize) override;
+
                 void Close() override;
 
             private:
@@ -90,13 +90,48 @@ public:
         operationType_(operationType),
         bytes_(std::move(bytes)),
         timeout_(timeout),
-        txnHolder_(store)
+        txnHolder_(store),
+        batchSize_(1)
+    {
+    }
+
+    __declspec(property(get = get_Id)) RowIdentifier const & Id;
+    RowIdentifier const & get_Id() const { return id_; }
+
+    __declspec(property(get = get_OperationType)) OperationType::Enum OperationType;
+    OperationType::Enum get_OperationType() const { return operationType_; }
+
+    __declspec(property(get = get_Bytes)) RowData const & Bytes;
+    RowData const & get_Bytes() const { return bytes_; }
+
+    __declspec(property(get = get_Timeout)) Common::TimeSpan Timeout;
+    Common::TimeSpan get_Timeout() const { return timeout_; }
+
+    __declspec(property(get = get_BatchSize)) size_t BatchSize;
+    size_t get_BatchSize() const { return batchSize_; }
+
+    void OnBatchCommitted(Common::AsyncOperationSPtr const & thisSPtr, Common::ErrorCode const & error, size_t batchSize)
     {
+        batchSize_ = batchSize;
+        ScheduleCompletion(thisSPtr, error);
+    }
+
+    void OnBatchFailed(Common::AsyncOperationSPtr const & thisSPtr, Common::ErrorCode const & error)
+    {
+        // Completed on the commit callback queue like a committed operation so that its callback
+        // does not run on the thread that is starting the batch
+        ScheduleCompletion(thisSPtr, error);
     }
 
 protected:
     void OnStart(Common::AsyncOperationSPtr const & thisSPtr) override
     {
+        if (store_.IsCommitBatchingEnabled())
+        {
+            store_.EnqueueCommit(std::static_pointer_cast<CommitAsyncOperation>(thisSPtr));
+            return;
+        }
+
         RowData bytes = std::move(bytes_);
         auto error = CreateTransaction();
         if (!error.IsSuccess())
@@ -133,7 +168,11 @@ private:
     void FinishCommit(Common::AsyncOperationSPtr const & txPtrCommitOperation)
     {
         auto error = EndCommit(txPtrCommitOperation);
+        ScheduleCompletion(txPtrCommitOperation->Parent, error);
+    }
 
+    void ScheduleCompletion(Common::AsyncOperationSPtr const & thisSPtr, Common::ErrorCode const & error)
+    {
         /*
             Release ESE callback threads immediately -> otherwise ESE callbacks will be delayed further
         */
@@ -145,7 +184,7 @@ private:
                     FinishScheduleCommitCallback(scheduleCommitOp, error);
                 }
             },
-            txPtrCommitOperation->Parent);
+            thisSPtr);
 
         if (op->CompletedSynchronously)
         {
@@ -186,9 +225,114 @@ private:
     OperationType::Enum operationType_;
     Common::TimeSpan timeout_;
     TransactionHolder txnHolder_;
+    size_t batchSize_;
+
+    // kept by value as the operation may be queued for a batch commit
+    RowIdentifier id_;
+};
+
+/*
+    Persists a batch of queued store operations in a single transaction
+
+    If an operation fails it is completed with the error and the transaction is rolled back.
+    The remaining operations in the batch are put back at the head of the queue for the next batch.
+    This keeps the per operation error semantics of the non batched path as a batch has at most one operation per row.
+*/
+class LocalStoreAdapter::BatchCommitAsyncOperation : public Common::AsyncOperation
+{
+    DENY_COPY(BatchCommitAsyncOperation);
+public:
+    BatchCommitAsyncOperation(
+        LocalStoreAdapter & store,
+        std::vector<CommitAsyncOperationSPtr> && operations,
+        Common::TimeSpan const timeout,
+        Common::AsyncCallback const & callback,
+        Common::AsyncOperationSPtr const & parent) :
+        AsyncOperation(callback, parent),
+        store_(store),
+        operations_(std::move(operations)),
+        timeout_(timeout),
+        txnHolder_(store)
+    {
+    }
+
+protected:
+    void OnStart(Common::AsyncOperationSPtr const & thisSPtr) override
+    {
+        auto error = store_.CreateTransaction(txnHolder_);
+        if (!error.IsSuccess())
+        {
+            for (auto const & it : operations_)
+            {
+                it->OnBatchFailed(it, error);
+            }
+
+            TryComplete(thisSPtr, error);
+            return;
+        }
+
+        for (size_t i = 0; i < operations_.size(); i++)
+        {
+            auto const & operation = *operations_[i];
+            error = store_.PerformOperationInternal(txnHolder_.Transaction, operation.OperationType, operation.Id, operation.Bytes);
+            if (!error.IsSuccess())
+            {
+                OnOperationFailed(thisSPtr, i, error);
+                return;
+            }
+        }
+
+        store_.GetPerfCounters().NumberOfStoreCommitsPerSecond.Increment();
+        store_.GetPerfCounters().NumberOfCommittingStoreTransactions.Increment();
+
+        auto op = txnHolder_.Transaction->BeginCommit(
+            timeout_,
+            [this](Common::AsyncOperationSPtr const & innerOp)
+            {
+                if (!innerOp->CompletedSynchronously)
+                {
+                    FinishCommit(innerOp);
+                }
+            },
+            thisSPtr);
+
+        if (op->CompletedSynchronously)
+        {
+            FinishCommit(op);
+        }
+    }
+
+private:
+    void OnOperationFailed(Common::AsyncOperationSPtr const & thisSPtr, size_t index, Common::ErrorCode const & error)
+    {
+        txnHolder_.Transaction->Rollback();
+
+        auto failedOperation = std::move(operations_[index]);
+        operations_.erase(operations_.begin() + index);
+        store_.RequeueCommits(std::move(operations_));
+
+        failedOperation->OnBatchFailed(failedOperation, error);
+
+        TryComplete(thisSPtr, error);
+    }
+
+    void FinishCommit(Common::AsyncOperationSPtr const & commitOp)
+    {
+        store_.GetPerfCounters().NumberOfCommittingStoreTransactions.Decrement();
+        auto error = txnHolder_.Transaction->EndCommit(commitOp);
+
+        for (auto const & it : operations_)
+        {
+            it->OnBatchCommitted(it, error, operations_.size());
+        }
 
-    // only used in the sync part of this API so safe to keep as const ref
-    RowIdentifier const & id_;
+        TryComplete(commitOp->Parent, error);
+    }
+
+    LocalStoreAdapter & store_;
+    std::vector<CommitAsyncOperationSPtr> operations_;
+    Common::TimeSpan timeout_;
+    TransactionHolder txnHolder_;
 };
 
 // Constructor
@@ -197,7 +341,8 @@ LocalStoreAdapter::LocalStoreAdapter(
     ReconfigurationAgent & ra) : 
     storeFactory_(storeFactory),
     ra_(ra),
-    isOpen_(false)
+    isOpen_(false),
+    isBatchCommitInProgress_(false)
 {
     ASSERT_IF(storeFactory == nullptr, "Factory can't be null");
 }
@@ -394,6 +539,137 @@ Common::ErrorCode LocalStoreAdapter::EndStoreOperation(Common::AsyncOperationSPt
     return Common::AsyncOperation::End<Common::AsyncOperation>(operation)->Error;
 }
 
+Common::ErrorCode LocalStoreAdapter::EndStoreOperation(
+    Common::AsyncOperationSPtr const & operation,
+    __out size_t & batchSize)
+{
+    auto casted = Common::AsyncOperation::End<CommitAsyncOperation>(operation);
+    batchSize = casted->BatchSize;
+    return casted->Error;
+}
+
+bool LocalStoreAdapter::IsCommitBatchingEnabled()
+{
+    return ra_.Config.MaxStoreCommitBatchSize > 1;
+}
+
+void LocalStoreAdapter::EnqueueCommit(CommitAsyncOperationSPtr && operation)
+{
+    {
+        AcquireExclusiveLock grab(batchLock_);
+        pendingCommits_.push_back(std::move(operation));
+
+        // The operation will be picked up once the batch that is committing completes
+        if (isBatchCommitInProgress_)
+        {
+            return;
+        }
+
+        isBatchCommitInProgress_ = true;
+    }
+
+    StartBatchCommits();
+}
+
+void LocalStoreAdapter::RequeueCommits(std::vector<CommitAsyncOperationSPtr> && operations)
+{
+    AcquireExclusiveLock grab(batchLock_);
+    pendingCommits_.insert(pendingCommits_.begin(), operations.begin(), operations.end());
+}
+
+void LocalStoreAdapter::StartBatchCommits()
+{
+    std::vector<CommitAsyncOperationSPtr> operations;
+    TimeSpan timeout = TimeSpan::MaxValue;
+
+    {
+        AcquireExclusiveLock grab(batchLock_);
+
+        size_t maxBatchSize = static_cast<size_t>(max(ra_.Config.MaxStoreCommitBatchSize, 1));
+        std::set<RowIdentifier> ids;
+        while (!pendingCommits_.empty() && operations.size() < maxBatchSize)
+        {
+            // Operations on the same row must be persisted in the order in which they were issued
+            if (!ids.insert(pendingCommits_.front()->Id).second)
+            {
+                break;
+            }
+
+            // The batch must not outlive any of its operations
+            timeout = min(timeout, pendingCommits_.front()->Timeout);
+
+            operations.push_back(std::move(pendingCommits_.front()));
+            pendingCommits_.pop_front();
+        }
+
+        if (operations.empty())
+        {
+            isBatchCommitInProgress_ = false;
+            return;
+        }
+    }
+
+    auto op = Common::AsyncOperation::CreateAndStart<BatchCommitAsyncOperation>(
+        *this,
+        std::move(operations),
+        timeout,
+        [this](Common::AsyncOperationSPtr const & batchOp)
+        {
+            if (!batchOp->CompletedSynchronously)
+            {
+                ScheduleBatchCommits(batchOp);
+            }
+        },
+        Common::AsyncOperationSPtr());
+
+    if (op->CompletedSynchronously)
+    {
+        ScheduleBatchCommits(op);
+    }
+}
+
+void LocalStoreAdapter::ScheduleBatchCommits(Common::AsyncOperationSPtr const & batchOp)
+{
+    {
+        AcquireExclusiveLock grab(batchLock_);
+        if (pendingCommits_.empty())
+        {
+            isBatchCommitInProgress_ = false;
+            return;
+        }
+    }
+
+    /*
+        Start the next batch on the commit callback queue
+        - A batch that completed asynchronously did so on an ESE callback thread which must be released immediately
+        - A batch that completed synchronously (e.g. a failed batch) is running on the thread that started it
+          which may be the thread that issued an operation. Starting the next batch in place would keep that
+          thread committing for as long as other threads keep issuing operations
+    */
+    auto op = GetThreadpool().BeginScheduleCommitCallback(
+        [this](Common::AsyncOperationSPtr const & scheduleOp)
+        {
+            if (!scheduleOp->CompletedSynchronously)
+            {
+                FinishScheduleBatchCommits(scheduleOp);
+            }
+        },
+        batchOp);
+
+    if (op->CompletedSynchronously)
+    {
+        FinishScheduleBatchCommits(op);
+    }
+}
+
+void LocalStoreAdapter::FinishScheduleBatchCommits(Common::AsyncOperationSPtr const & scheduleOp)
+{
+    auto error = GetThreadpool().EndScheduleCommitCallback(scheduleOp);
+    ASSERT_IF(!error.IsSuccess(), "Schedule commit must succeed");
+
+    StartBatchCommits();
+}
+
 Common::ErrorCode LocalStoreAdapter::PerformOperationInternal(
     Store::IStoreBase::TransactionSPtr const & txPtr,
     OperationType::Enum operationType,
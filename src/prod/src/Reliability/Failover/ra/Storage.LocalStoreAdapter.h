@@ -11,6 +11,20 @@ namespace Reliability
     {
         namespace Storage
         {
+            /*
+                Translates the RA store operations into local store transactions
+
+                Concurrent store operations are grouped into a single transaction (group commit)
+                - Operations are queued in the order in which they are issued
+                - At most one batch transaction is committing at any time. Operations issued while it is committing
+                  wait for it to complete and are then committed together in the next batch
+                - A batch never contains two operations for the same row so that operations on a row are
+                  persisted in the order they were issued
+                - The batch size is limited by MaxStoreCommitBatchSize. A value of 1 disables batching
+                - The batch transaction uses the smallest timeout of its operations
+                - The next batch is always started on the commit callback queue so that neither an ESE callback thread
+                  nor the thread that started the previous batch commits the batches that follow
+            */
             class LocalStoreAdapter : public Storage::Api::IKeyValueStore
             {
                 DENY_COPY(LocalStoreAdapter);
@@ -42,6 +56,10 @@ namespace Reliability
 
                 Common::ErrorCode EndStoreOperation(Common::AsyncOperationSPtr const & operation);
 
+                Common::ErrorCode EndStoreOperation(
+                    Common::AsyncOperationSPtr const & operation,
+                    __out size_t & batchSize) override;
+
             private:
                 typedef Store::IStoreBase::TransactionSPtr TransactionSPtr;
 
@@ -51,8 +69,22 @@ namespace Reliability
                 ReconfigurationAgent & ra_;
 
                 class CommitAsyncOperation;
+                class BatchCommitAsyncOperation;
                 class TransactionHolder;
 
+                typedef std::shared_ptr<CommitAsyncOperation> CommitAsyncOperationSPtr;
+
+                Common::ExclusiveLock batchLock_;
+                std::deque<CommitAsyncOperationSPtr> pendingCommits_;
+                bool isBatchCommitInProgress_;
+
+                bool IsCommitBatchingEnabled();
+                void EnqueueCommit(CommitAsyncOperationSPtr && operation);
+                void RequeueCommits(std::vector<CommitAsyncOperationSPtr> && operations);
+                void StartBatchCommits();
+                void ScheduleBatchCommits(Common::AsyncOperationSPtr const & batchOp);
+                void FinishScheduleBatchCommits(Common::AsyncOperationSPtr const & scheduleOp);
+
                 Infrastructure::IThreadpool & GetThreadpool();
                 Diagnostics::RAPerformanceCounters & GetPerfCounters();
 
@@ -96,6 +96,30 @@ protected:
     void DeleteForExistingKeyPasses();
     void UpdateForExistingKeyUpdates();
     void UpdateForNonExistingKeyFails();
+    void ConcurrentCommitsArePersisted();
+    void OperationsOnSameRowArePersistedInOrder();
+    void FailedOperationDoesNotFailOtherOperations();
+    void BatchSizeOfOneCommitsEachOperationSeparately();
+    void FailedBatchesCompleteAndStartNextBatch();
+
+    struct StoreOperation
+    {
+        OperationType::Enum Type;
+        wstring Key;
+        int PersistedState;
+    };
+
+    struct StoreOperationResult
+    {
+        ErrorCode Error;
+        size_t BatchSize;
+    };
+
+    // Issues all the operations before waiting for any of them so that they can be committed together
+    vector<StoreOperationResult> PerformStoreOperations(vector<StoreOperation> const & operations);
+
+    void VerifyStoreValues(map<wstring, int> const & expected);
+    void VerifyBatchSizes(vector<StoreOperationResult> const & results);
 
     unique_ptr<InfrastructureTestUtility> infrastructureUtility_;
     UnitTestContextUPtr utContext_;
@@ -217,6 +241,241 @@ void TestRAStore::UpdateForNonExistingKeyFails()
     infrastructureUtility_->VerifyStoreIsEmpty();
 }
 
+void TestRAStore::ConcurrentCommitsArePersisted()
+{
+    if (FailoverConfig::GetConfig().EnableLocalTStore || Store::StoreConfig::GetConfig().EnableTStore) { return ; }
+
+    int const threadCount = 8;
+    int const operationsPerThread = 20;
+
+    ManualResetEvent ev;
+    LONG pendingThreadCount = threadCount;
+    vector<vector<StoreOperationResult>> results(threadCount);
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        Common::Threadpool::Post([this, i, &results, &pendingThreadCount, &ev]
+        {
+            vector<StoreOperation> operations;
+            for (int j = 0; j < operationsPerThread; j++)
+            {
+                operations.push_back(StoreOperation { OperationType::Insert, wformatString("{0}_{1}", i, j), j });
+            }
+
+            results[i] = PerformStoreOperations(operations);
+
+            if (InterlockedDecrement(&pendingThreadCount) == 0)
+            {
+                ev.Set();
+            }
+        });
+    }
+
+    ev.WaitOne();
+
+    map<wstring, int> expected;
+    for (int i = 0; i < threadCount; i++)
+    {
+        for (int j = 0; j < operationsPerThread; j++)
+        {
+            Verify::IsTrue(results[i][j].Error.IsSuccess(), wformatString("Expected op {0}_{1} to succeed {2}", i, j, results[i][j].Error));
+            expected[wformatString("{0}_{1}", i, j)] = j;
+        }
+
+        VerifyBatchSizes(results[i]);
+    }
+
+    VerifyStoreValues(expected);
+}
+
+void TestRAStore::OperationsOnSameRowArePersistedInOrder()
+{
+    if (FailoverConfig::GetConfig().EnableLocalTStore || Store::StoreConfig::GetConfig().EnableTStore) { return ; }
+
+    // Each operation depends on the previous one for the same row so they fail if they are reordered or merged into one transaction
+    vector<StoreOperation> operations;
+    operations.push_back(StoreOperation { OperationType::Insert, L"a", 1 });
+    operations.push_back(StoreOperation { OperationType::Insert, L"b", 1 });
+    operations.push_back(StoreOperation { OperationType::Update, L"a", 2 });
+    operations.push_back(StoreOperation { OperationType::Delete, L"a", 0 });
+    operations.push_back(StoreOperation { OperationType::Update, L"b", 2 });
+    operations.push_back(StoreOperation { OperationType::Insert, L"a", 3 });
+    operations.push_back(StoreOperation { OperationType::Update, L"a", 4 });
+
+    auto results = PerformStoreOperations(operations);
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        Verify::IsTrue(results[i].Error.IsSuccess(), wformatString("Expected op {0} to succeed {1}", i, results[i].Error));
+    }
+
+    VerifyBatchSizes(results);
+
+    map<wstring, int> expected;
+    expected[L"a"] = 4;
+    expected[L"b"] = 2;
+    VerifyStoreValues(expected);
+}
+
+void TestRAStore::FailedOperationDoesNotFailOtherOperations()
+{
+    if (FailoverConfig::GetConfig().EnableLocalTStore || Store::StoreConfig::GetConfig().EnableTStore) { return ; }
+
+    auto error = PerformStoreOperations(vector<StoreOperation>(1, StoreOperation { OperationType::Insert, L"b", 1 }))[0].Error;
+    Verify::IsTrue(error.IsSuccess(), wformatString("Expected op to succeed {0}", error));
+
+    // The first operation is committing while the rest are queued, so the duplicate insert fails inside a batch
+    // The transaction is rolled back and the operations after it are committed in the next batch
+    vector<StoreOperation> operations;
+    operations.push_back(StoreOperation { OperationType::Insert, L"a", 1 });
+    operations.push_back(StoreOperation { OperationType::Insert, L"c", 1 });
+    operations.push_back(StoreOperation { OperationType::Insert, L"b", 2 });
+    operations.push_back(StoreOperation { OperationType::Insert, L"d", 1 });
+    operations.push_back(StoreOperation { OperationType::Update, L"a", 2 });
+
+    auto results = PerformStoreOperations(operations);
+
+    Verify::IsTrue(results[0].Error.IsSuccess(), wformatString("Insert a {0}", results[0].Error));
+    Verify::IsTrue(results[1].Error.IsSuccess(), wformatString("Insert c {0}", results[1].Error));
+    Verify::AreEqual(ErrorCodeValue::StoreWriteConflict, results[2].Error.ReadValue(), L"Insert+Insert");
+    Verify::IsTrue(results[3].Error.IsSuccess(), wformatString("Insert d {0}", results[3].Error));
+    Verify::IsTrue(results[4].Error.IsSuccess(), wformatString("Update a {0}", results[4].Error));
+
+    map<wstring, int> expected;
+    expected[L"a"] = 2;
+    expected[L"b"] = 1;
+    expected[L"c"] = 1;
+    expected[L"d"] = 1;
+    VerifyStoreValues(expected);
+}
+
+void TestRAStore::BatchSizeOfOneCommitsEachOperationSeparately()
+{
+    if (FailoverConfig::GetConfig().EnableLocalTStore || Store::StoreConfig::GetConfig().EnableTStore) { return ; }
+
+    utContext_->Config.MaxStoreCommitBatchSize = 1;
+
+    vector<StoreOperation> operations;
+    map<wstring, int> expected;
+    for (int i = 0; i < 10; i++)
+    {
+        auto key = wformatString("{0}", i);
+        operations.push_back(StoreOperation { OperationType::Insert, key, i });
+        expected[key] = i;
+    }
+
+    auto results = PerformStoreOperations(operations);
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        Verify::IsTrue(results[i].Error.IsSuccess(), wformatString("Expected op {0} to succeed {1}", i, results[i].Error));
+        Verify::AreEqual(1, results[i].BatchSize, L"BatchSize");
+    }
+
+    VerifyStoreValues(expected);
+}
+
+void TestRAStore::FailedBatchesCompleteAndStartNextBatch()
+{
+    if (FailoverConfig::GetConfig().EnableLocalTStore || Store::StoreConfig::GetConfig().EnableTStore) { return ; }
+
+    // Each batch fails on its first operation before it commits so it completes synchronously
+    // The failed operation must still be completed and the rest of the batch must be started in the next batch
+    int const failedCount = 100;
+    vector<StoreOperation> operations;
+    for (int i = 0; i < failedCount; i++)
+    {
+        operations.push_back(StoreOperation { OperationType::Update, wformatString("{0}", i), i });
+    }
+
+    operations.push_back(StoreOperation { OperationType::Insert, L"a", 1 });
+
+    auto results = PerformStoreOperations(operations);
+
+    for (int i = 0; i < failedCount; i++)
+    {
+        Verify::AreEqual(ErrorCodeValue::StoreRecordNotFound, results[i].Error.ReadValue(), wformatString("Update {0}", i));
+    }
+
+    Verify::IsTrue(results[failedCount].Error.IsSuccess(), wformatString("Insert a {0}", results[failedCount].Error));
+
+    map<wstring, int> expected;
+    expected[L"a"] = 1;
+    VerifyStoreValues(expected);
+}
+
+vector<TestRAStore::StoreOperationResult> TestRAStore::PerformStoreOperations(vector<StoreOperation> const & operations)
+{
+    auto & store = *utContext_->RA.LfumStore;
+
+    ManualResetEvent ev;
+    LONG pendingCount = static_cast<LONG>(operations.size());
+    vector<AsyncOperationSPtr> ops;
+
+    for (auto const & it : operations)
+    {
+        vector<byte> bytes;
+        if (it.Type != OperationType::Delete)
+        {
+            TestEntity entity(it.Key, it.PersistedState, 0);
+            auto error = FabricSerializer::Serialize(&entity, bytes);
+            ASSERT_IF(!error.IsSuccess(), "Expect this to succeed");
+        }
+
+        ops.push_back(store.BeginStoreOperation(
+            it.Type,
+            RowIdentifier(RowType::Test, it.Key),
+            move(bytes),
+            TimeSpan::MaxValue,
+            [&pendingCount, &ev](AsyncOperationSPtr const &)
+            {
+                if (InterlockedDecrement(&pendingCount) == 0)
+                {
+                    ev.Set();
+                }
+            },
+            AsyncOperationSPtr()));
+    }
+
+    ev.WaitOne();
+
+    vector<StoreOperationResult> results;
+    for (auto const & it : ops)
+    {
+        StoreOperationResult result;
+        result.Error = store.EndStoreOperation(it, result.BatchSize);
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+void TestRAStore::VerifyStoreValues(map<wstring, int> const & expected)
+{
+    map<wstring, int> actual;
+    for (auto const & it : infrastructureUtility_->GetAllEntitiesFromStore())
+    {
+        actual[it->Key] = it->PersistedData;
+    }
+
+    Verify::AreEqual(expected.size(), actual.size(), L"Store item count");
+    for (auto const & it : expected)
+    {
+        auto actualIt = actual.find(it.first);
+        Verify::IsTrue(actualIt != actual.end(), wformatString("Store should have {0}", it.first));
+        Verify::AreEqual(it.second, actualIt->second, wformatString("Value of {0}", it.first));
+    }
+}
+
+void TestRAStore::VerifyBatchSizes(vector<StoreOperationResult> const & results)
+{
+    size_t maxBatchSize = static_cast<size_t>(max(utContext_->Config.MaxStoreCommitBatchSize, 1));
+    for (auto const & it : results)
+    {
+        Verify::IsTrue(it.BatchSize >= 1 && it.BatchSize <= maxBatchSize, wformatString("Unexpected batch size {0}", it.BatchSize));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(Unit)
 
 BOOST_FIXTURE_TEST_SUITE(TestRAStoreSuite_InMemoryStore, TestRAStoreImpl<false>)
@@ -228,6 +487,11 @@ STORE_TEST_CASE(DeleteForNonExistantKeyFails)
 STORE_TEST_CASE(DeleteForExistingKeyPasses);
 STORE_TEST_CASE(UpdateForExistingKeyUpdates);
 STORE_TEST_CASE(UpdateForNonExistingKeyFails);
+STORE_TEST_CASE(ConcurrentCommitsArePersisted);
+STORE_TEST_CASE(OperationsOnSameRowArePersistedInOrder);
+STORE_TEST_CASE(FailedOperationDoesNotFailOtherOperations);
+STORE_TEST_CASE(BatchSizeOfOneCommitsEachOperationSeparately);
+STORE_TEST_CASE(FailedBatchesCompleteAndStartNextBatch);
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -253,6 +517,11 @@ STORE_TEST_CASE(DeleteForNonExistantKeyFails)
 STORE_TEST_CASE(DeleteForExistingKeyPasses);
 STORE_TEST_CASE(UpdateForExistingKeyUpdates);
 STORE_TEST_CASE(UpdateForNonExistingKeyFails);
+STORE_TEST_CASE(ConcurrentCommitsArePersisted);
+STORE_TEST_CASE(OperationsOnSameRowArePersistedInOrder);
+STORE_TEST_CASE(FailedOperationDoesNotFailOtherOperations);
+STORE_TEST_CASE(BatchSizeOfOneCommitsEachOperationSeparately);
+STORE_TEST_CASE(FailedBatchesCompleteAndStartNextBatch);
 
 BOOST_AUTO_TEST_SUITE_END()
 
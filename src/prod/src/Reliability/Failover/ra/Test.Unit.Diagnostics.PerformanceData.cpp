@@ -126,6 +126,21 @@ BOOST_AUTO_TEST_CASE(CommitPerfCountersAreReported)
     Verify::AreEqual(duration, commitPerfData_.CommitDuration.TotalSeconds(), L"Commit time");
 }
 
+BOOST_AUTO_TEST_CASE(CommitBatchSizeIsRecorded)
+{
+    int duration = 2;
+    size_t batchSize = 17;
+
+    commitPerfData_.OnStoreCommitStart(clock_);
+
+    AdvanceTime(duration);
+
+    commitPerfData_.OnStoreCommitEnd(clock_, batchSize);
+
+    Verify::AreEqual(batchSize, commitPerfData_.BatchSize, L"Batch size");
+    Verify::AreEqual(duration, commitPerfData_.CommitDuration.TotalSeconds(), L"Commit time");
+}
+
 BOOST_AUTO_TEST_CASE(NoCommitPerfCountersAreReportedIfNoCommitHappens)
 {
     commitPerfData_.ReportPerformanceData(*perfCounters_);
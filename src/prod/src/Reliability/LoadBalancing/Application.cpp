@@ -5,6 +5,7 @@
 
 #include "stdafx.h"
 #include "Application.h" 
+#include "MetricIdTable.h"
 
 using namespace std;
 using namespace Common;
@@ -13,12 +14,15 @@ using namespace Reliability::LoadBalancingComponent;
 GlobalWString const Application::FormatHeader = make_global<wstring>(L"ApplicationName");
 
 Application::Application(ApplicationDescription && desc)
-: applicationDesc_(move(desc))
+: applicationDesc_(move(desc)),
+  capacityMetricIds_()
 {
+    UpdateCapacityMetricIds();
 }
 
 Application::Application(Application && other)
-: applicationDesc_(move(other.applicationDesc_))
+: applicationDesc_(move(other.applicationDesc_)),
+  capacityMetricIds_(move(other.capacityMetricIds_))
 {
 }
 
@@ -27,6 +31,7 @@ bool Application::UpdateDescription(ApplicationDescription && desc)
     if (applicationDesc_ != desc)
     {
         applicationDesc_ = move(desc);
+        UpdateCapacityMetricIds();
         return true;
     }
     else
@@ -57,6 +62,17 @@ int64 Application::GetReservedCapacity(std::wstring const& metricName) const
     return totalReservedCapacity;
 }
 
+void Application::UpdateCapacityMetricIds()
+{
+    capacityMetricIds_.clear();
+    capacityMetricIds_.reserve(applicationDesc_.AppCapacities.size());
+
+    for (auto it = applicationDesc_.AppCapacities.begin(); it != applicationDesc_.AppCapacities.end(); ++it)
+    {
+        capacityMetricIds_.push_back(MetricIdTable::GetTable().GetId(it->first));
+    }
+}
+
 void Application::GetChangedServicePackages(ApplicationDescription const & newDescription, std::set<ServiceModel::ServicePackageIdentifier>& deletedSPs, std::set<ServiceModel::ServicePackageIdentifier>& updatedSPs)
 {
     auto const& newSPDescriptions = newDescription.ServicePackages;
@@ -31,6 +31,10 @@ namespace Reliability
             __declspec (property(get = get_Services)) std::set<std::wstring> const& Services;
             std::set<std::wstring> const& get_Services() const { return services_; }
 
+            // Interned ids of the metrics in ApplicationDesc.AppCapacities, in the same order
+            __declspec (property(get = get_CapacityMetricIds)) std::vector<uint> const& CapacityMetricIds;
+            std::vector<uint> const& get_CapacityMetricIds() const { return capacityMetricIds_; }
+
             __declspec (property(get = get_UpgradeInProgess)) bool UpgradeInProgess;
             bool get_UpgradeInProgess() const { return ApplicationDesc.UpgradeInProgess; }
 
@@ -54,7 +58,11 @@ namespace Reliability
             void WriteTo(Common::TextWriter&, Common::FormatOptions const &) const;
 
         private:
+            void UpdateCapacityMetricIds();
+
             ApplicationDescription applicationDesc_;
+
+            std::vector<uint> capacityMetricIds_;
             //It is important that this be an ordered set. The order is useful while adding metric connections.
             std::set<std::wstring> services_;
 
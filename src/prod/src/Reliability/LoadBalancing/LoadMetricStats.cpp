@@ -7,17 +7,20 @@
 #include "LoadMetricStats.h"
 #include "PLBConfig.h"
 #include "Constants.h"
+#include "MetricIdTable.h"
 
 using namespace std;
 using namespace Common;
 using namespace Reliability::LoadBalancingComponent;
 
 LoadMetricStats::LoadMetricStats()
+    : metricId_(MetricIdTable::InvalidId)
 {
 }
 
 LoadMetricStats::LoadMetricStats(std::wstring && name, uint value, StopwatchTime timestamp)
     : name_(move(name)), 
+    metricId_(MetricIdTable::InvalidId),
     lastReportValue_(value), 
     lastReportTime_(timestamp),
     count_(1),
@@ -28,6 +31,7 @@ LoadMetricStats::LoadMetricStats(std::wstring && name, uint value, StopwatchTime
 
 LoadMetricStats::LoadMetricStats(LoadMetricStats && other)
     : name_(move(other.name_)), 
+    metricId_(other.metricId_),
     lastReportValue_(other.lastReportValue_), 
     lastReportTime_(other.lastReportTime_),
     count_(other.count_),
@@ -38,6 +42,7 @@ LoadMetricStats::LoadMetricStats(LoadMetricStats && other)
 
 LoadMetricStats::LoadMetricStats(LoadMetricStats const& other)
     : name_(other.name_), 
+    metricId_(other.metricId_),
     lastReportValue_(other.lastReportValue_), 
     lastReportTime_(other.lastReportTime_),
     count_(other.count_),
@@ -51,6 +56,7 @@ LoadMetricStats & LoadMetricStats::operator = (LoadMetricStats const & other)
     if (this != &other)
     {
         name_ = move(other.name_);
+        metricId_ = other.metricId_;
         lastReportValue_ = other.lastReportValue_;
         lastReportTime_ = other.lastReportTime_;
         count_ = other.count_;
@@ -66,6 +72,7 @@ LoadMetricStats & LoadMetricStats::operator = (LoadMetricStats && other)
     if (this != &other) 
     {
         name_ = move(other.name_);
+        metricId_ = other.metricId_;
         lastReportValue_ = other.lastReportValue_;
         lastReportTime_ = other.lastReportTime_;
         count_ = other.count_;
@@ -35,6 +35,12 @@ namespace Reliability
             __declspec (property(get=get_Value)) uint Value;
             uint get_Value() const;
 
+            // Interned id of the metric (see MetricIdTable), resolved when the report enters PLB.
+            // Not serialized: MetricIdTable::InvalidId until resolved.
+            __declspec (property(get=get_MetricId, put=put_MetricId)) uint MetricId;
+            uint get_MetricId() const { return metricId_; }
+            void put_MetricId(uint metricId) { metricId_ = metricId; }
+
             void AdjustTimestamp(Common::TimeSpan diff);
 
             bool Update(uint value, Common::StopwatchTime timestamp);
@@ -50,6 +56,7 @@ namespace Reliability
             void ValidateValues() const;
 
             std::wstring name_;
+            uint metricId_;
             uint lastReportValue_;
             Common::StopwatchTime lastReportTime_;
             uint count_;
@@ -17,6 +17,9 @@ namespace Reliability
         class LoadOrMoveCostDescription : public Serialization::FabricSerializable
         {
             DEFAULT_COPY_CONSTRUCTOR(LoadOrMoveCostDescription)
+
+            friend class MetricIdTable;
+
         public:
             static std::wstring const& GetStoreType();
 
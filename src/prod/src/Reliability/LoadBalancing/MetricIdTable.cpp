@@ -0,0 +1,110 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+#include "Constants.h"
+#include "MetricIdTable.h"
+#include "LoadOrMoveCostDescription.h"
+
+using namespace std;
+using namespace Common;
+using namespace Reliability::LoadBalancingComponent;
+
+MetricIdTable::MetricIdTable()
+    : lock_(),
+    ids_(),
+    names_()
+{
+    uint moveCostId = AddCallerHoldsLock(*Constants::MoveCostMetricName);
+    uint cpuCoresId = AddCallerHoldsLock(*ServiceModel::Constants::SystemMetricNameCpuCores);
+    uint memoryInMBId = AddCallerHoldsLock(*ServiceModel::Constants::SystemMetricNameMemoryInMB);
+
+    ASSERT_IFNOT(moveCostId == MoveCostId && cpuCoresId == CpuCoresId && memoryInMBId == MemoryInMBId,
+        "Unexpected ids of well known metrics: {0} {1} {2}", moveCostId, cpuCoresId, memoryInMBId);
+}
+
+MetricIdTable & MetricIdTable::GetTable()
+{
+    static MetricIdTable table;
+
+    return table;
+}
+
+uint MetricIdTable::GetId(wstring const& metricName)
+{
+    {
+        AcquireReadLock grab(lock_);
+
+        auto it = ids_.find(metricName);
+        if (it != ids_.end())
+        {
+            return it->second;
+        }
+    }
+
+    AcquireWriteLock grab(lock_);
+
+    return AddCallerHoldsLock(metricName);
+}
+
+uint MetricIdTable::FindId(wstring const& metricName) const
+{
+    AcquireReadLock grab(lock_);
+
+    auto it = ids_.find(metricName);
+
+    return it != ids_.end() ? it->second : InvalidId;
+}
+
+void MetricIdTable::ResolveIds(LoadOrMoveCostDescription & loadOrMoveCost) const
+{
+    AcquireReadLock grab(lock_);
+
+    ResolveIdsCallerHoldsLock(loadOrMoveCost.primaryEntries_);
+    ResolveIdsCallerHoldsLock(loadOrMoveCost.secondaryEntries_);
+
+    for (auto it = loadOrMoveCost.secondaryEntriesMap_.begin(); it != loadOrMoveCost.secondaryEntriesMap_.end(); ++it)
+    {
+        ResolveIdsCallerHoldsLock(it->second);
+    }
+}
+
+wstring const& MetricIdTable::GetName(uint metricId) const
+{
+    AcquireReadLock grab(lock_);
+
+    ASSERT_IF(metricId >= names_.size(), "Metric id {0} doesn't exist", metricId);
+
+    return *(names_[metricId]);
+}
+
+size_t MetricIdTable::get_Count() const
+{
+    AcquireReadLock grab(lock_);
+
+    return names_.size();
+}
+
+uint MetricIdTable::AddCallerHoldsLock(wstring const& metricName)
+{
+    // Another thread may have added the metric before we acquired the write lock
+    auto it = ids_.find(metricName);
+    if (it == ids_.end())
+    {
+        it = ids_.insert(make_pair(metricName, static_cast<uint>(names_.size()))).first;
+        names_.push_back(&(it->first));
+    }
+
+    return it->second;
+}
+
+void MetricIdTable::ResolveIdsCallerHoldsLock(vector<LoadMetricStats> & entries) const
+{
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        auto itId = ids_.find(it->Name);
+        it->MetricId = itId != ids_.end() ? itId->second : InvalidId;
+    }
+}
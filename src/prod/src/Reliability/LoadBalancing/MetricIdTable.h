@@ -0,0 +1,66 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Reliability
+{
+    namespace LoadBalancingComponent
+    {
+        class LoadMetricStats;
+        class LoadOrMoveCostDescription;
+
+        /// <summary>
+        /// Process-wide table of interned metric names. Each metric name gets a dense integer id when it first
+        /// enters PLB with a service description, so that internal structures can compare and
+        /// index metrics by id instead of hashing and comparing wide strings. Ids are never reused.
+        /// </summary>
+        class MetricIdTable
+        {
+            DENY_COPY(MetricIdTable);
+
+        public:
+            // Well known metrics have fixed ids
+            static uint const MoveCostId = 0;
+            static uint const CpuCoresId = 1;
+            static uint const MemoryInMBId = 2;
+
+            // Returned by FindId for metrics that were never added to the table
+            static uint const InvalidId = UINT_MAX;
+
+            static MetricIdTable & GetTable();
+
+            // Returns the id of the metric, adding the metric to the table if needed
+            uint GetId(std::wstring const& metricName);
+
+            // Returns the id of the metric or InvalidId, without adding the metric to the table.
+            // Used for load reports so that reports for unknown metrics don't grow the table.
+            uint FindId(std::wstring const& metricName) const;
+
+            // Sets the MetricId of every entry of a load report, taking the lock once per report.
+            // Entries for metrics that are not in the table get InvalidId.
+            void ResolveIds(LoadOrMoveCostDescription & loadOrMoveCost) const;
+
+            std::wstring const& GetName(uint metricId) const;
+
+            __declspec (property(get=get_Count)) size_t Count;
+            size_t get_Count() const;
+
+        private:
+            MetricIdTable();
+
+            uint AddCallerHoldsLock(std::wstring const& metricName);
+
+            void ResolveIdsCallerHoldsLock(std::vector<LoadMetricStats> & entries) const;
+
+            mutable Common::RwLock lock_;
+
+            std::unordered_map<std::wstring, uint> ids_;
+
+            // Points to the keys of ids_, which are not moved on rehash
+            std::vector<std::wstring const*> names_;
+        };
+    }
+}
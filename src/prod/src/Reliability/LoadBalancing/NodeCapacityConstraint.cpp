@@ -154,25 +154,33 @@ bool NodeCapacitySubspace::FilterByNodeCapacity(
     ASSERT_IFNOT(tempSolution.OriginalPlacement->TotalMetricCount == tempLoads.Length &&
         tempSolution.OriginalPlacement->TotalMetricCount == baseLoads.Length, "Invalid temp loads or base loads");
 
-    int64 capacity = useNodeBufferCapacity ? node->TotalCapacities.Values[capacityIndex] : node->BufferedCapacities.Values[capacityIndex];
+    NodeLoadMatrix const& nodeLoads = tempSolution.OriginalPlacement->NodeLoads;
 
-    if (capacity >= 0)
+    // Free capacity already has the load that was on the node before the beginning of the run
+    // and the dissapearing load (not counted in reservation) subtracted.
+    int64 freeCapacity = nodeLoads.GetFreeCapacity(capacityIndex, node->NodeIndex, useNodeBufferCapacity);
+
+    if (freeCapacity != NodeLoadMatrix::UnlimitedCapacity)
     {
+        int64 capacity = nodeLoads.GetCapacity(capacityIndex, node->NodeIndex, useNodeBufferCapacity);
+
         if (relaxed_)
         {
             int64 loadInBaseSolution = node->Loads.Values[globalMetricIndex] +
                 baseLoads.Values[globalMetricIndex] +
                 tempSolution.GetBaseApplicationReservedLoad(node, capacityIndex);
-            capacity = max(capacity, loadInBaseSolution);
+            if (loadInBaseSolution > capacity)
+            {
+                freeCapacity += loadInBaseSolution - capacity;
+                capacity = loadInBaseSolution;
+            }
         }
 
-        int64 totalLoad = node->Loads.Values[globalMetricIndex] +   // This was on the node before the beginning of the run.
-            shouldDisappearLoads.Values[globalMetricIndex] +        // Dissapearing load (not counted in reservation)
-            tempLoads.Values[globalMetricIndex] +                   // Changes in the temp solution
+        int64 tempLoad = tempLoads.Values[globalMetricIndex] +     // Changes in the temp solution
             tempSolution.GetApplicationReservedLoad(node, capacityIndex);  // Reserved load in the temp solution.
 
         if (replicaLoadValue > 0 &&
-            totalLoad + replicaLoadValue > capacity)
+            tempLoad + replicaLoadValue > freeCapacity)
         {
             //Nullcheck here in case the overloads are called by people who don't want diagnostics
             //Since we return in this block anyways, there's no real perf hit from the additional nullcheck
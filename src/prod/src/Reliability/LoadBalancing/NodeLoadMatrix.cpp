@@ -0,0 +1,84 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+#include "NodeLoadMatrix.h"
+
+using namespace std;
+using namespace Common;
+using namespace Reliability::LoadBalancingComponent;
+
+NodeLoadMatrix::NodeLoadMatrix(vector<NodeEntry> const& nodes, size_t globalMetricCount, size_t totalMetricCount)
+    : nodeCount_(nodes.size()),
+    metricCount_(globalMetricCount),
+    bufferedCapacities_(globalMetricCount * nodes.size(), -1),
+    totalCapacities_(globalMetricCount * nodes.size(), -1),
+    freeBufferedCapacities_(globalMetricCount * nodes.size(), UnlimitedCapacity),
+    freeTotalCapacities_(globalMetricCount * nodes.size(), UnlimitedCapacity)
+{
+    ASSERT_IFNOT(totalMetricCount >= globalMetricCount, "Invalid metric count");
+    size_t globalMetricStartIndex = totalMetricCount - globalMetricCount;
+
+    vector<int64> committedLoads(globalMetricCount * nodeCount_, 0);
+
+    // Transpose node-major entries into metric-major rows
+    for (NodeEntry const& node : nodes)
+    {
+        size_t nodeIndex = static_cast<size_t>(node.NodeIndex);
+        ASSERT_IFNOT(nodeIndex < nodeCount_, "Invalid node index {0}", nodeIndex);
+
+        for (size_t capacityIndex = 0; capacityIndex < globalMetricCount; ++capacityIndex)
+        {
+            size_t offset = capacityIndex * nodeCount_ + nodeIndex;
+            size_t totalIndex = globalMetricStartIndex + capacityIndex;
+
+            committedLoads[offset] = node.Loads.Values[totalIndex] + node.ShouldDisappearLoads.Values[totalIndex];
+            bufferedCapacities_[offset] = node.BufferedCapacities.Values[capacityIndex];
+            totalCapacities_[offset] = node.TotalCapacities.Values[capacityIndex];
+        }
+    }
+
+    ComputeFreeCapacities(bufferedCapacities_.data(), committedLoads.data(), freeBufferedCapacities_.data(), committedLoads.size());
+    ComputeFreeCapacities(totalCapacities_.data(), committedLoads.data(), freeTotalCapacities_.data(), committedLoads.size());
+}
+
+NodeLoadMatrix::NodeLoadMatrix(NodeLoadMatrix && other)
+    : nodeCount_(other.nodeCount_),
+    metricCount_(other.metricCount_),
+    bufferedCapacities_(move(other.bufferedCapacities_)),
+    totalCapacities_(move(other.totalCapacities_)),
+    freeBufferedCapacities_(move(other.freeBufferedCapacities_)),
+    freeTotalCapacities_(move(other.freeTotalCapacities_))
+{
+}
+
+NodeLoadMatrix & NodeLoadMatrix::operator = (NodeLoadMatrix && other)
+{
+    if (this != &other)
+    {
+        nodeCount_ = other.nodeCount_;
+        metricCount_ = other.metricCount_;
+        bufferedCapacities_ = move(other.bufferedCapacities_);
+        totalCapacities_ = move(other.totalCapacities_);
+        freeBufferedCapacities_ = move(other.freeBufferedCapacities_);
+        freeTotalCapacities_ = move(other.freeTotalCapacities_);
+    }
+
+    return *this;
+}
+
+void NodeLoadMatrix::ComputeFreeCapacities(
+    int64 const* capacities,
+    int64 const* committedLoads,
+    int64 * freeCapacities,
+    size_t count)
+{
+    // Single pass over all rows when the placement is created
+    for (size_t i = 0; i < count; ++i)
+    {
+        int64 capacity = capacities[i];
+        freeCapacities[i] = capacity < 0 ? UnlimitedCapacity : capacity - committedLoads[i];
+    }
+}
@@ -0,0 +1,82 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+#include "NodeEntry.h"
+
+namespace Reliability
+{
+    namespace LoadBalancingComponent
+    {
+        /// <summary>
+        /// Static capacities and free capacities (capacity minus the load that was on the node before
+        /// the beginning of the run, including load that should disappear) of global metrics.
+        /// Values are computed once per placement and stored metric-major, with one row per metric
+        /// indexed by node index, so that capacity checks read a single precomputed value per node
+        /// instead of summing the node-major load entries for every candidate node.
+        ///
+        /// Candidate nodes are still filtered one node at a time rather than a row at a time. The rest of
+        /// the check depends on per node state of the temp solution: node changes and moving in changes
+        /// (maps keyed by node), application reservations, relaxed capacities, nodes the application or
+        /// service package is moving away from, and diagnostics. A row-wide vector compare would have to
+        /// gather all of that per node first, which costs more than the compare saves. The precomputed rows
+        /// are what such a filter would read if temp solution loads were stored metric-major too.
+        /// PlacementWithCapacityOnSyntheticClusterPerfTest in LoadBalancing.Perf measures this path.
+        /// </summary>
+        class NodeLoadMatrix
+        {
+            DENY_COPY(NodeLoadMatrix);
+
+        public:
+            // Free capacity of nodes that have no capacity defined for the metric
+            static int64 const UnlimitedCapacity = INT64_MAX;
+
+            NodeLoadMatrix(std::vector<NodeEntry> const& nodes, size_t globalMetricCount, size_t totalMetricCount);
+
+            NodeLoadMatrix(NodeLoadMatrix && other);
+
+            NodeLoadMatrix & operator = (NodeLoadMatrix && other);
+
+            // Capacity of the node (negative if not defined)
+            int64 GetCapacity(size_t capacityIndex, int nodeIndex, bool useTotalCapacity) const
+            {
+                return useTotalCapacity ?
+                    totalCapacities_[Offset(capacityIndex, nodeIndex)] :
+                    bufferedCapacities_[Offset(capacityIndex, nodeIndex)];
+            }
+
+            // Capacity minus committed load, or UnlimitedCapacity if the node has no capacity for the metric
+            int64 GetFreeCapacity(size_t capacityIndex, int nodeIndex, bool useTotalCapacity) const
+            {
+                return useTotalCapacity ?
+                    freeTotalCapacities_[Offset(capacityIndex, nodeIndex)] :
+                    freeBufferedCapacities_[Offset(capacityIndex, nodeIndex)];
+            }
+
+        private:
+            size_t Offset(size_t capacityIndex, int nodeIndex) const
+            {
+                ASSERT_IFNOT(capacityIndex < metricCount_ && static_cast<size_t>(nodeIndex) < nodeCount_,
+                    "Invalid index in node load matrix: metric {0} node {1}", capacityIndex, nodeIndex);
+                return capacityIndex * nodeCount_ + static_cast<size_t>(nodeIndex);
+            }
+
+            static void ComputeFreeCapacities(
+                int64 const* capacities,
+                int64 const* committedLoads,
+                int64 * freeCapacities,
+                size_t count);
+
+            size_t nodeCount_;
+            size_t metricCount_;
+
+            std::vector<int64> bufferedCapacities_;
+            std::vector<int64> totalCapacities_;
+            std::vector<int64> freeBufferedCapacities_;
+            std::vector<int64> freeTotalCapacities_;
+        };
+    }
+}
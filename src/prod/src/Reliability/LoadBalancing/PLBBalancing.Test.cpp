@@ -140,6 +140,74 @@ namespace PlacementAndLoadBalancingUnitTest
         VERIFY_ARE_EQUAL(static_cast<uint64>(plb.GetServiceDomains().size()), fm_->numberOfUpdatesFromPLB);
     }
 
+    BOOST_AUTO_TEST_CASE(BalancingMultipleServiceDomainsParallelSearchTest)
+    {
+        Trace.WriteInfo("PLBBalancingTestSource", "BalancingMultipleServiceDomainsParallelSearchTest");
+        PlacementAndLoadBalancing & plb = fm_->PLB;
+        PLBConfigScopeChange(SearcherDomainParallelism, int, 4);
+
+        for (int i = 0; i < 4; i++)
+        {
+            plb.UpdateNode(CreateNodeDescriptionWithCapacity(i, L"MyMetric1/50,MyMetric2/50,MyMetric3/50"));
+        }
+
+        // Force processing of pending updates so that service can be created.
+        plb.ProcessPendingUpdatesPeriodicTask();
+
+        plb.UpdateServiceType(ServiceTypeDescription(wstring(L"TestType1"), set<NodeId>()));
+
+        plb.UpdateService(CreateServiceDescription(L"TestService1", L"TestType1", false, CreateMetrics(L"MyMetric1/1.0/10/10")));
+        plb.UpdateService(CreateServiceDescription(L"TestService2", L"TestType1", false, CreateMetrics(L"MyMetric2/1.0/10/10")));
+        plb.UpdateService(CreateServiceDescription(L"TestService3", L"TestType1", false, CreateMetrics(L"MyMetric3/1.0/10/10")));
+
+        int fuId = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(fuId++), wstring(L"TestService1"), 0, CreateReplicas(L"I/0"), 0));
+            plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(fuId++), wstring(L"TestService2"), 0, CreateReplicas(L"I/1"), 0));
+            plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(fuId++), wstring(L"TestService3"), 0, CreateReplicas(L"I/2"), 0));
+        }
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        vector<wstring> actionList = GetActionListString(fm_->MoveActions);
+
+        // Every domain is imbalanced and generates its own movements
+        VERIFY_IS_TRUE(actionList.size() >= 3u);
+        VERIFY_ARE_EQUAL(static_cast<uint64>(plb.GetServiceDomains().size()), fm_->numberOfUpdatesFromPLB);
+    }
+
+    BOOST_AUTO_TEST_CASE(BalancingWithIncrementalScoreVerificationTest)
+    {
+        Trace.WriteInfo("PLBBalancingTestSource", "BalancingWithIncrementalScoreVerificationTest");
+        PLBConfigScopeChange(VerifyIncrementalScore, bool, true);
+        PlacementAndLoadBalancing & plb = fm_->PLB;
+
+        for (int i = 0; i < 4; i++)
+        {
+            plb.UpdateNode(CreateNodeDescriptionWithCapacity(i, L"MyMetric1/100,MyMetric2/100"));
+        }
+
+        // Force processing of pending updates so that service can be created.
+        plb.ProcessPendingUpdatesPeriodicTask();
+
+        plb.UpdateServiceType(ServiceTypeDescription(wstring(L"TestType1"), set<NodeId>()));
+
+        plb.UpdateService(CreateServiceDescription(L"TestService1", L"TestType1", true, CreateMetrics(L"MyMetric1/1.0/10/5,MyMetric2/0.5/5/5")));
+        plb.UpdateService(CreateServiceDescription(L"TestService2", L"TestType1", false, CreateMetrics(L"MyMetric2/1.0/10/10")));
+
+        int fuId = 0;
+        for (int i = 0; i < 6; i++)
+        {
+            plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(fuId++), wstring(L"TestService1"), 0, CreateReplicas(L"P/0,S/1"), 0));
+            plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(fuId++), wstring(L"TestService2"), 0, CreateReplicas(L"I/0"), 0));
+        }
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        // Every incremental score calculation during the search is verified against a full recalculation
+        vector<wstring> actionList = GetActionListString(fm_->MoveActions);
+        VERIFY_IS_TRUE(actionList.size() > 0u);
+    }
+
     BOOST_AUTO_TEST_CASE(BalancingPreferredPrimary)
     {
         Trace.WriteInfo("PLBBalancingTestSource", " BalancingPreferredPrimary ");
@@ -250,6 +318,36 @@ namespace PlacementAndLoadBalancingUnitTest
         VERIFY_ARE_EQUAL(25, CountIf(actionList, ActionMatch(L"* move instance 1=>0", value)));
     }
 
+    BOOST_AUTO_TEST_CASE(BalancingWithParallelSimulatedAnnealingTest)
+    {
+        Trace.WriteInfo("PLBBalancingTestSource", "BalancingWithParallelSimulatedAnnealingTest");
+        PLBConfigScopeChange(SimulatedAnnealingParallelism, int, 4);
+        PLBConfigScopeChange(SimulatedAnnealingExchangeRounds, int, 1);
+        PlacementAndLoadBalancing & plb = fm_->PLB;
+
+        plb.UpdateNode(CreateNodeDescriptionWithCapacity(0, L"Count/25"));
+        plb.UpdateNode(CreateNodeDescription(1));
+
+        // Force processing of pending updates so that service can be created.
+        plb.ProcessPendingUpdatesPeriodicTask();
+
+        plb.UpdateServiceType(ServiceTypeDescription(wstring(L"TestType"), set<NodeId>()));
+        plb.UpdateService(CreateServiceDescription(L"TestService", L"TestType", false));
+
+        for (int i = 0; i < 100; i++)
+        {
+            plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(i), wstring(L"TestService"), 0, CreateReplicas(L"I/1"), 0));
+        }
+
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        vector<wstring> actionList = GetActionListString(fm_->MoveActions);
+
+        // Chains running on separate threads must not violate capacity of node0
+        VERIFY_ARE_EQUAL(25u, actionList.size());
+        VERIFY_ARE_EQUAL(25, CountIf(actionList, ActionMatch(L"* move instance 1=>0", value)));
+    }
+
     BOOST_AUTO_TEST_CASE(BalancingWithCustomMetricTest)
     {
         Trace.WriteInfo("PLBBalancingTestSource", "BalancingWithCustomMetricTest");
@@ -189,6 +189,9 @@ namespace Reliability
             //Setting which determines if the LB is in test mode, which results in additional tracing and validity checking
             TEST_CONFIG_ENTRY(bool, L"PlacementAndLoadBalancing", IsTestMode, false, Common::ConfigEntryUpgradePolicy::Dynamic);
 
+            //Recalculate the score of every metric after each incremental score calculation and assert that the results are the same
+            TEST_CONFIG_ENTRY(bool, L"PlacementAndLoadBalancing", VerifyIncrementalScore, false, Common::ConfigEntryUpgradePolicy::Dynamic);
+
             //The percentage of difference in score when doing load balancing
             TEST_CONFIG_ENTRY(double, L"PlacementAndLoadBalancing", AllowedBalancingScoreDifference, 0.1, Common::ConfigEntryUpgradePolicy::Dynamic);
 
@@ -200,6 +203,16 @@ namespace Reliability
 
             TEST_CONFIG_ENTRY(bool, L"PlacementAndLoadBalancing", PrintRefreshTimers, false, Common::ConfigEntryUpgradePolicy::Dynamic);
 
+            //Cluster snapshot file replayed by the LoadBalancing.Perf benchmark. If empty, the benchmark generates
+            //a cluster with PerfTestNumberOfNodes nodes and PerfTestNumberOfPartitions partitions
+            TEST_CONFIG_ENTRY(std::wstring, L"PlacementAndLoadBalancing", PerfTestReplayFile, L"", Common::ConfigEntryUpgradePolicy::Dynamic);
+
+            //Number of refreshes run by the LoadBalancing.Perf benchmark, each one with InitialRandomSeed + iteration as the seed
+            TEST_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", PerfTestReplayIterations, 10, Common::ConfigEntryUpgradePolicy::Dynamic);
+
+            //File to which the LoadBalancing.Perf benchmark writes one CSV line per iteration. If empty, results are only traced
+            TEST_CONFIG_ENTRY(std::wstring, L"PlacementAndLoadBalancing", PerfTestReplayResultFile, L"", Common::ConfigEntryUpgradePolicy::Dynamic);
+
             //Enable or disable fault domain in PLB
             INTERNAL_CONFIG_ENTRY(bool, L"PlacementAndLoadBalancing", FaultDomainEnabled, true, Common::ConfigEntryUpgradePolicy::Dynamic);
 
@@ -219,6 +232,11 @@ namespace Reliability
             //When searching for a balanced solution, every 10ms the LB search thread will sleep for this amount of time
             INTERNAL_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", YieldDurationPer10ms, 7, Common::ConfigEntryUpgradePolicy::Dynamic);
 
+            //Maximum number of service domains whose balancing searches run concurrently in one PLB run.
+            //Searches are only run concurrently when no balancing movement throttle applies, and the resulting movements
+            //are passed to FM in the same order as with sequential searches. The default value of 1 disables concurrent searches.
+            INTERNAL_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", SearcherDomainParallelism, 1, Common::ConfigEntryUpgradePolicy::Dynamic);
+
             //Initial random seed
             INTERNAL_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", InitialRandomSeed, -1, Common::ConfigEntryUpgradePolicy::Static);
 
@@ -396,6 +414,14 @@ namespace Reliability
             //Number of iterations per round during simulated annealing
             INTERNAL_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", SimulatedAnnealingIterationsPerRound, 1000, Common::ConfigEntryUpgradePolicy::Dynamic);
 
+            //Number of threads that run the simulated annealing chains of one balancing search. Each thread runs its chains with
+            //its own random sequence, and the chains are synchronized after every round. The default value of 1 runs all chains on the search thread.
+            INTERNAL_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", SimulatedAnnealingParallelism, 1, Common::ConfigEntryUpgradePolicy::Dynamic);
+
+            //When simulated annealing chains run in parallel, number of rounds after which a chain that did not find a new best solution
+            //continues from the best solution found by any chain
+            INTERNAL_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", SimulatedAnnealingExchangeRounds, 10, Common::ConfigEntryUpgradePolicy::Dynamic);
+
             //Number of iterations per round during placement search
             INTERNAL_CONFIG_ENTRY(int, L"PlacementAndLoadBalancing", PlacementSearchIterationsPerRound, 100, Common::ConfigEntryUpgradePolicy::Dynamic);
 
@@ -595,6 +621,12 @@ namespace Reliability
 
             // Determines how often statistics are traced out.
             INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"PlacementAndLoadBalancing", StatisticsTracingInterval, Common::TimeSpan::FromSeconds(60.0), Common::ConfigEntryUpgradePolicy::Dynamic);
+
+            // Determines whether the snapshot of a service domain is reused when the domain did not change since the previous snapshot.
+            INTERNAL_CONFIG_ENTRY(bool, L"PlacementAndLoadBalancing", IncrementalSnapshotEnabled, true, Common::ConfigEntryUpgradePolicy::Dynamic);
+
+            // Maximum age of a reused service domain snapshot. Older snapshots are taken again even if the domain did not change.
+            INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"PlacementAndLoadBalancing", IncrementalSnapshotMaxAge, Common::TimeSpan::FromSeconds(60.0), Common::ConfigEntryUpgradePolicy::Dynamic);
         };
     }
 }
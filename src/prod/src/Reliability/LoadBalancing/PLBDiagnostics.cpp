@@ -302,6 +302,8 @@ void PLBDiagnostics::TrackBalancingFailure(CandidateSolution & oldSolution, Cand
             timeSpan,
             move(attributeList));
 
+        // Balancing searches of different service domains may run concurrently
+        AcquireWriteLock grab(balancingDiagnosticsLock_);
         balancingViolationHealthReports_.push_back(move(balancingFailureHealthReport));
     }
 }
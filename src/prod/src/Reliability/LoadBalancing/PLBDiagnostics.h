@@ -150,6 +150,7 @@ namespace Reliability
             Common::RwLock upgradeSwapDiagnosticsTableLock_;
             Common::RwLock droppedMovementTableLock_;
             Common::RwLock queryLock_;
+            Common::RwLock balancingDiagnosticsLock_;
 
             std::wstring ConstraintDetails(IConstraint::Enum type, PlacementReplica const* r, std::shared_ptr<IConstraintDiagnosticsData> diagnosticsDataSPtr);
 
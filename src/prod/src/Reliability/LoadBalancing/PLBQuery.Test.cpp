@@ -105,6 +105,141 @@ namespace PlacementAndLoadBalancingUnitTest
         VerifyNodeLoadQuery(plb, 2, L"Metric2", 10);
     }
 
+    BOOST_AUTO_TEST_CASE(LoadQueriesWithIncrementalSnapshotTest)
+    {
+        wstring testName = L"LoadQueriesWithIncrementalSnapshotTest";
+        Trace.WriteInfo("PLBQueryTestSource", "{0}", testName);
+
+        PLBConfigScopeChange(IncrementalSnapshotEnabled, bool, true);
+
+        PlacementAndLoadBalancing & plb = fm_->PLB;
+
+        plb.UpdateNode(CreateNodeDescriptionWithCapacity(0, L"Metric1/100,Metric2/100"));
+        plb.UpdateNode(CreateNodeDescriptionWithCapacity(1, L"Metric1/100,Metric2/100"));
+        plb.UpdateNode(CreateNodeDescriptionWithCapacity(2, L"Metric1/100,Metric2/100"));
+
+        wstring testType = wformatString("{0}Type", testName);
+        plb.UpdateServiceType(ServiceTypeDescription(wstring(testType), set<NodeId>()));
+
+        // Services do not share metrics, so they are in different service domains
+        wstring serviceName1 = wformatString("{0}_1", testName);
+        plb.UpdateService(CreateServiceDescription(serviceName1, testType, true, CreateMetrics(L"Metric1/1.0/100/50")));
+        plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(0), wstring(serviceName1), 0, CreateReplicas(L"P/0,S/1,S/2"), 0));
+
+        wstring serviceName2 = wformatString("{0}_2", testName);
+        plb.UpdateService(CreateServiceDescription(serviceName2, testType, true, CreateMetrics(L"Metric2/1.0/20/10")));
+        plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(1), wstring(serviceName2), 0, CreateReplicas(L"P/1,S/0,S/2"), 0));
+
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        ServiceModel::ClusterLoadInformationQueryResult queryResult;
+        ErrorCode result = plb.GetClusterLoadInformationQueryResult(queryResult);
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, result.ReadValue());
+
+        VerifyLoad(queryResult, L"Metric1", 200, false);
+        VerifyLoad(queryResult, L"Metric2", 40, false);
+
+        PlacementAndLoadBalancingTestHelper const& plbTestHelper = fm_->PLBTestHelper;
+        ServiceDomain::DomainDataSPtr domain1Snapshot = plbTestHelper.GetLatestDomainSnapshot(L"Metric1");
+        ServiceDomain::DomainDataSPtr domain2Snapshot = plbTestHelper.GetLatestDomainSnapshot(L"Metric2");
+        VERIFY_IS_TRUE(domain1Snapshot != nullptr);
+        VERIFY_IS_TRUE(domain2Snapshot != nullptr);
+
+        // Change the load in one domain only: the other domain reuses its snapshot
+        plb.UpdateLoadOrMoveCost(CreateLoadOrMoveCost(0, serviceName1, L"Metric1", 60, 30));
+
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        VERIFY_IS_TRUE(domain1Snapshot != plbTestHelper.GetLatestDomainSnapshot(L"Metric1"));
+        VERIFY_IS_TRUE(domain2Snapshot == plbTestHelper.GetLatestDomainSnapshot(L"Metric2"));
+        domain1Snapshot = plbTestHelper.GetLatestDomainSnapshot(L"Metric1");
+
+        result = plb.GetClusterLoadInformationQueryResult(queryResult);
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, result.ReadValue());
+
+        VerifyLoad(queryResult, L"Metric1", 120, false);
+        VerifyLoad(queryResult, L"Metric2", 40, false);
+
+        VerifyNodeLoadQuery(plb, 0, L"Metric1", 60);
+        VerifyNodeLoadQuery(plb, 1, L"Metric1", 30);
+        VerifyNodeLoadQuery(plb, 1, L"Metric2", 20);
+
+        // Nothing changed: both domains reuse their snapshots
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        VERIFY_IS_TRUE(domain1Snapshot == plbTestHelper.GetLatestDomainSnapshot(L"Metric1"));
+        VERIFY_IS_TRUE(domain2Snapshot == plbTestHelper.GetLatestDomainSnapshot(L"Metric2"));
+
+        result = plb.GetClusterLoadInformationQueryResult(queryResult);
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, result.ReadValue());
+
+        VerifyLoad(queryResult, L"Metric1", 120, false);
+        VerifyLoad(queryResult, L"Metric2", 40, false);
+
+        // Node change affects all domains
+        plb.UpdateNode(CreateNodeDescriptionWithCapacity(2, L"Metric1/50,Metric2/50"));
+
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        VERIFY_IS_TRUE(domain1Snapshot != plbTestHelper.GetLatestDomainSnapshot(L"Metric1"));
+        VERIFY_IS_TRUE(domain2Snapshot != plbTestHelper.GetLatestDomainSnapshot(L"Metric2"));
+
+        result = plb.GetClusterLoadInformationQueryResult(queryResult);
+        VERIFY_ARE_EQUAL(ErrorCodeValue::Success, result.ReadValue());
+
+        VerifyCapacity(queryResult, L"Metric1", 250);
+        VerifyCapacity(queryResult, L"Metric2", 250);
+    }
+
+    BOOST_AUTO_TEST_CASE(LoadQueriesWithInternedMetricIdsTest)
+    {
+        wstring testName = L"LoadQueriesWithInternedMetricIdsTest";
+        Trace.WriteInfo("PLBQueryTestSource", "{0}", testName);
+
+        MetricIdTable & metricIds = MetricIdTable::GetTable();
+        VERIFY_ARE_EQUAL(MetricIdTable::MoveCostId, metricIds.GetId(*Reliability::LoadBalancingComponent::Constants::MoveCostMetricName));
+        VERIFY_ARE_EQUAL(metricIds.GetId(L"Metric1"), metricIds.GetId(wstring(L"Metric1")));
+        VERIFY_ARE_EQUAL(MetricIdTable::InvalidId, metricIds.FindId(wformatString("{0}_UnknownMetric", testName)));
+
+        PlacementAndLoadBalancing & plb = fm_->PLB;
+
+        plb.UpdateNode(CreateNodeDescriptionWithCapacity(0, L"Metric1/100,Metric2/100"));
+        plb.UpdateNode(CreateNodeDescriptionWithCapacity(1, L"Metric1/100,Metric2/100"));
+
+        wstring testType = wformatString("{0}Type", testName);
+        plb.UpdateServiceType(ServiceTypeDescription(wstring(testType), set<NodeId>()));
+
+        wstring serviceName = wformatString("{0}_0", testName);
+        plb.UpdateService(CreateServiceDescription(serviceName, testType, true, CreateMetrics(L"Metric1/1.0/10/5,Metric2/1.0/10/5")));
+        plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(0), wstring(serviceName), 0, CreateReplicas(L"P/0,S/1"), 0));
+
+        // Ids are resolved once per report, unknown metrics stay unresolved
+        LoadOrMoveCostDescription report = CreateLoadOrMoveCost(0, serviceName, L"Metric2", 40, 30);
+        VERIFY_ARE_EQUAL(MetricIdTable::InvalidId, report.PrimaryEntries[0].MetricId);
+        metricIds.ResolveIds(report);
+        VERIFY_ARE_EQUAL(metricIds.FindId(L"Metric2"), report.PrimaryEntries[0].MetricId);
+        VERIFY_ARE_EQUAL(metricIds.FindId(L"Metric2"), report.SecondaryEntries[0].MetricId);
+
+        LoadOrMoveCostDescription unknownReport = CreateLoadOrMoveCost(0, serviceName, wformatString("{0}_UnknownMetric", testName), 1, 1);
+        metricIds.ResolveIds(unknownReport);
+        VERIFY_ARE_EQUAL(MetricIdTable::InvalidId, unknownReport.PrimaryEntries[0].MetricId);
+
+        plb.UpdateLoadOrMoveCost(move(report));
+        plb.UpdateLoadOrMoveCost(CreateLoadOrMoveCost(0, serviceName, *Reliability::LoadBalancingComponent::Constants::MoveCostMetricName, FABRIC_MOVE_COST_HIGH, FABRIC_MOVE_COST_LOW));
+
+        // Reports for metrics the service doesn't have are ignored and are not interned
+        wstring unknownMetric = wformatString("{0}_UnknownMetric", testName);
+        plb.UpdateLoadOrMoveCost(CreateLoadOrMoveCost(0, serviceName, unknownMetric, 70, 70));
+        VERIFY_ARE_EQUAL(MetricIdTable::InvalidId, metricIds.FindId(unknownMetric));
+
+        fm_->RefreshPLB(Stopwatch::Now());
+
+        VerifyNodeLoadQuery(plb, 0, L"Metric1", 10);
+        VerifyNodeLoadQuery(plb, 1, L"Metric1", 5);
+        VerifyNodeLoadQuery(plb, 0, L"Metric2", 40);
+        VerifyNodeLoadQuery(plb, 1, L"Metric2", 30);
+    }
+
     BOOST_AUTO_TEST_CASE(LoadQueriesDownNodes)
     {
         wstring testName = L"LoadQueriesDownNodes";
@@ -0,0 +1,476 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+#include "TestUtility.h"
+#include "TestFM.h"
+#include "PLBConfig.h"
+#include "PlacementAndLoadBalancing.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace PlacementAndLoadBalancingUnitTest
+{
+    using namespace std;
+    using namespace Common;
+    using namespace Federation;
+    using namespace Reliability::LoadBalancingComponent;
+
+    StringLiteral const PLBReplayPerfTestSource("PLBReplayPerfTestSource");
+
+    // Cluster state replayed by the benchmark. Snapshot files are text files with one entity per line:
+    //   node <id> <capacities> [<fault domain> <upgrade domain>]
+    //   service <name> <stateful> <metrics> [<target replica set size>]
+    //   partition <id> <service> <replicas>
+    //   load <partition id> <service> <metric> <primary load> <secondary load>
+    // Capacities, metrics and replicas use the formats of the test helpers,
+    // e.g. "M1/100,M2/50", "M1/1.0/10/5,M2/1.0/20/10" and "P/0,S/1,S/2"; "-" is an empty list.
+    // Loads of stateless services use the secondary load.
+    // Empty lines and lines starting with '#' are ignored.
+    // PlacementAndLoadBalancingTestHelper::ExportClusterSnapshot writes this format from a running PLB.
+    class ClusterSnapshot
+    {
+    public:
+        ClusterSnapshot() : entries_() {}
+
+        bool Load(wstring const& fileName);
+
+        // Generates a cluster with random replica placement and loads, for runs without a snapshot file
+        void Generate(int nodeCount, int partitionCount, int seed);
+
+        void Apply(PlacementAndLoadBalancing & plb) const;
+
+        static wstring GetList(wstring const& field) { return field == L"-" ? L"" : field; }
+
+        __declspec (property(get = get_EntryCount)) size_t EntryCount;
+        size_t get_EntryCount() const { return entries_.size(); }
+
+    private:
+        vector<vector<wstring>> entries_;
+    };
+
+    class TestPLBReplay
+    {
+    protected:
+        TestPLBReplay() {
+            BOOST_REQUIRE(ClassSetup());
+            BOOST_REQUIRE(TestSetup());
+        }
+
+        ~TestPLBReplay()
+        {
+            BOOST_REQUIRE(ClassCleanup());
+        }
+
+        TEST_CLASS_SETUP(ClassSetup);
+        TEST_CLASS_CLEANUP(ClassCleanup);
+        TEST_METHOD_SETUP(TestSetup);
+
+        shared_ptr<TestFM> fm_;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(TestPLBReplaySuite, TestPLBReplay)
+
+    BOOST_AUTO_TEST_CASE(ReplayClusterSnapshotPerfTest)
+    {
+        wstring testName = L"ReplayClusterSnapshotPerfTest";
+        Trace.WriteInfo(PLBReplayPerfTestSource, "{0}", testName);
+
+        PLBConfig const& config = PLBConfig::GetConfig();
+
+        ClusterSnapshot snapshot;
+        if (config.PerfTestReplayFile.empty())
+        {
+            snapshot.Generate(config.PerfTestNumberOfNodes, config.PerfTestNumberOfPartitions, config.InitialRandomSeed);
+        }
+        else
+        {
+            VERIFY_IS_TRUE(snapshot.Load(config.PerfTestReplayFile));
+        }
+
+        Trace.WriteInfo(PLBReplayPerfTestSource, "Replaying {0} entries from '{1}'", snapshot.EntryCount, config.PerfTestReplayFile);
+
+        int iterations = max(config.PerfTestReplayIterations, 1);
+
+        wstring results = L"iteration,seed,refreshMs,pendingUpdatesMs,beginRefreshMs,snapshotMs,engineMs,endRefreshMs,searchedDomains,originalEnergy,newEnergy,movements\r\n";
+
+        uint64 totalRefreshTime = 0;
+        uint64 totalEngineTime = 0;
+        uint64 maxRefreshTime = 0;
+        double totalOriginalEnergy = 0.0;
+        double totalNewEnergy = 0.0;
+
+        for (int iteration = 0; iteration < iterations; ++iteration)
+        {
+            // Each iteration replays the snapshot into a new PLB with its own fixed seed,
+            // so that runs of the benchmark on different builds are comparable.
+            int seed = config.InitialRandomSeed + iteration;
+            fm_->Load(seed);
+
+            PlacementAndLoadBalancing & plb = fm_->PLB;
+            snapshot.Apply(plb);
+
+            fm_->RefreshPLB(Stopwatch::Now());
+
+            auto const& timers = plb.RefreshTimers;
+            auto const& scores = plb.RefreshScores;
+
+            totalRefreshTime += timers.msRefreshTime;
+            totalEngineTime += timers.msTimeCountForEngine;
+            maxRefreshTime = max(maxRefreshTime, timers.msRefreshTime);
+            totalOriginalEnergy += scores.originalEnergy;
+            totalNewEnergy += scores.newEnergy;
+
+            Trace.WriteInfo(
+                PLBReplayPerfTestSource,
+                "Iteration {0} seed {1}: refresh {2}ms (pending updates {3}ms, begin refresh {4}ms, snapshot {5}ms, engine {6}ms, end refresh {7}ms), {8} domains searched, energy {9} -> {10}, {11} movements",
+                iteration,
+                seed,
+                timers.msRefreshTime,
+                timers.msPendingUpdatesTime,
+                timers.msBeginRefreshTime,
+                timers.msSnapshotTime,
+                timers.msTimeCountForEngine,
+                timers.msEndRefreshTime,
+                scores.searchedDomainCount,
+                scores.originalEnergy,
+                scores.newEnergy,
+                fm_->MoveActions.size());
+
+            results += wformatString(
+                "{0},{1},{2},{3},{4},{5},{6},{7},{8},{9},{10},{11}\r\n",
+                iteration,
+                seed,
+                timers.msRefreshTime,
+                timers.msPendingUpdatesTime,
+                timers.msBeginRefreshTime,
+                timers.msSnapshotTime,
+                timers.msTimeCountForEngine,
+                timers.msEndRefreshTime,
+                scores.searchedDomainCount,
+                scores.originalEnergy,
+                scores.newEnergy,
+                fm_->MoveActions.size());
+        }
+
+        wstring summary = wformatString(
+            L"{0} iterations: average refresh {1}ms, max refresh {2}ms, average engine {3}ms, average energy {4} -> {5}",
+            iterations,
+            totalRefreshTime / iterations,
+            maxRefreshTime,
+            totalEngineTime / iterations,
+            totalOriginalEnergy / iterations,
+            totalNewEnergy / iterations);
+
+        Trace.WriteInfo(PLBReplayPerfTestSource, "{0}", summary);
+
+        if (!config.PerfTestReplayResultFile.empty())
+        {
+            File file;
+            auto error = file.TryOpen(config.PerfTestReplayResultFile, FileMode::Create, FileAccess::Write, FileShare::None);
+            VERIFY_IS_TRUE(error.IsSuccess());
+
+            string text = StringUtility::Utf16ToUtf8(results);
+            DWORD bytesWritten = 0;
+            error = file.TryWrite2(text.data(), static_cast<int>(text.size()), bytesWritten);
+            file.Close();
+            VERIFY_IS_TRUE(error.IsSuccess());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ExportClusterSnapshotTest)
+    {
+        wstring testName = L"ExportClusterSnapshotTest";
+        Trace.WriteInfo(PLBReplayPerfTestSource, "{0}", testName);
+
+        ClusterSnapshot generated;
+        generated.Generate(10, 20, PLBConfig::GetConfig().InitialRandomSeed);
+        generated.Apply(fm_->PLB);
+
+        wstring fileName = Path::Combine(Directory::GetCurrentDirectory(), wformatString("{0}.txt", testName));
+        ErrorCode error = fm_->PLBTestHelper.ExportClusterSnapshot(fileName);
+        VERIFY_IS_TRUE(error.IsSuccess());
+
+        // Partitions are renumbered on export, but the exported snapshot has the same entries
+        // and replays into the same cluster load
+        ClusterSnapshot exported;
+        VERIFY_IS_TRUE(exported.Load(fileName));
+        VERIFY_ARE_EQUAL(generated.EntryCount, exported.EntryCount);
+
+        fm_->RefreshPLB(Stopwatch::Now());
+        ServiceModel::ClusterLoadInformationQueryResult generatedLoad;
+        VERIFY_IS_TRUE(fm_->PLB.GetClusterLoadInformationQueryResult(generatedLoad).IsSuccess());
+
+        fm_->Load();
+        exported.Apply(fm_->PLB);
+        fm_->RefreshPLB(Stopwatch::Now());
+        ServiceModel::ClusterLoadInformationQueryResult exportedLoad;
+        VERIFY_IS_TRUE(fm_->PLB.GetClusterLoadInformationQueryResult(exportedLoad).IsSuccess());
+
+        VERIFY_ARE_EQUAL(generatedLoad.LoadMetric.size(), exportedLoad.LoadMetric.size());
+        for (size_t i = 0; i < generatedLoad.LoadMetric.size(); ++i)
+        {
+            VERIFY_ARE_EQUAL(generatedLoad.LoadMetric[i].Name, exportedLoad.LoadMetric[i].Name);
+            VERIFY_ARE_EQUAL(generatedLoad.LoadMetric[i].ClusterLoad, exportedLoad.LoadMetric[i].ClusterLoad);
+        }
+
+        File::Delete2(fileName);
+    }
+
+    BOOST_AUTO_TEST_CASE(PlacementWithCapacityOnSyntheticClusterPerfTest)
+    {
+        // Places new partitions on a synthetic 5000-node cluster where odd nodes do not have enough
+        // capacity for a single replica, so that node capacity filtering is a large part of engine time.
+        wstring testName = L"PlacementWithCapacityOnSyntheticClusterPerfTest";
+        Trace.WriteInfo(PLBReplayPerfTestSource, "{0}", testName);
+
+        PLBConfig const& config = PLBConfig::GetConfig();
+
+        int nodeCount = 5000;
+        int partitionCount = 500;
+        int iterations = max(config.PerfTestReplayIterations, 1);
+
+        uint64 totalRefreshTime = 0;
+        uint64 totalEngineTime = 0;
+        uint64 maxEngineTime = 0;
+
+        for (int iteration = 0; iteration < iterations; ++iteration)
+        {
+            int seed = config.InitialRandomSeed + iteration;
+            fm_->Load(seed);
+
+            PlacementAndLoadBalancing & plb = fm_->PLB;
+
+            for (int i = 0; i < nodeCount; i++)
+            {
+                plb.UpdateNode(CreateNodeDescriptionWithCapacity(i, i % 2 == 0 ? L"MyMetric/100" : L"MyMetric/50"));
+            }
+
+            plb.UpdateServiceType(ServiceTypeDescription(wstring(L"TestType"), set<NodeId>()));
+            plb.UpdateService(CreateServiceDescription(L"TestService", L"TestType", false, CreateMetrics(L"MyMetric/1.0/60/60")));
+
+            for (int i = 0; i < partitionCount; i++)
+            {
+                plb.UpdateFailoverUnit(FailoverUnitDescription(CreateGuid(i), wstring(L"TestService"), 0, CreateReplicas(L""), 1));
+            }
+
+            fm_->RefreshPLB(Stopwatch::Now());
+
+            auto const& timers = plb.RefreshTimers;
+            totalRefreshTime += timers.msRefreshTime;
+            totalEngineTime += timers.msTimeCountForEngine;
+            maxEngineTime = max(maxEngineTime, timers.msTimeCountForEngine);
+
+            Trace.WriteInfo(
+                PLBReplayPerfTestSource,
+                "Iteration {0} seed {1}: placement of {2} partitions on {3} nodes: refresh {4}ms, snapshot {5}ms, engine {6}ms",
+                iteration,
+                seed,
+                partitionCount,
+                nodeCount,
+                timers.msRefreshTime,
+                timers.msSnapshotTime,
+                timers.msTimeCountForEngine);
+
+            vector<wstring> actionList = GetActionListString(fm_->MoveActions);
+            VERIFY_ARE_EQUAL(static_cast<size_t>(partitionCount), actionList.size());
+            for (int i = 1; i < 10; i += 2)
+            {
+                VERIFY_ARE_EQUAL(0, CountIf(actionList, ActionMatch(wformatString(L"* add instance {0}", i), value)));
+            }
+        }
+
+        Trace.WriteInfo(
+            PLBReplayPerfTestSource,
+            "{0} iterations: average refresh {1}ms, average engine {2}ms, max engine {3}ms",
+            iterations,
+            totalRefreshTime / iterations,
+            totalEngineTime / iterations,
+            maxEngineTime);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    bool ClusterSnapshot::Load(wstring const& fileName)
+    {
+        File file;
+        auto error = file.TryOpen(fileName, FileMode::Open, FileAccess::Read, FileShare::Read);
+        if (!error.IsSuccess())
+        {
+            Trace.WriteError(PLBReplayPerfTestSource, "Failed to open cluster snapshot {0}: {1}", fileName, error);
+            return false;
+        }
+
+        string text;
+        text.resize(static_cast<size_t>(file.size()));
+        if (!text.empty())
+        {
+            file.Read(&text[0], static_cast<int>(text.size()));
+        }
+        file.Close();
+
+        vector<wstring> lines;
+        StringUtility::Split<wstring>(StringUtility::Utf8ToUtf16(text), lines, wstring(L"\r\n"));
+
+        entries_.clear();
+        for (size_t lineIndex = 0; lineIndex < lines.size(); ++lineIndex)
+        {
+            vector<wstring> fields;
+            StringUtility::Split<wstring>(lines[lineIndex], fields, wstring(L" \t"));
+
+            if (fields.empty() || fields[0][0] == L'#')
+            {
+                continue;
+            }
+
+            wstring const& type = fields[0];
+            bool isValid =
+                (type == L"node" && (fields.size() == 3 || fields.size() == 5)) ||
+                (type == L"service" && (fields.size() == 4 || fields.size() == 5)) ||
+                (type == L"partition" && fields.size() == 4) ||
+                (type == L"load" && fields.size() == 6);
+
+            if (!isValid)
+            {
+                Trace.WriteError(PLBReplayPerfTestSource, "Invalid cluster snapshot entry: {0}", lines[lineIndex]);
+                return false;
+            }
+
+            entries_.push_back(move(fields));
+        }
+
+        return true;
+    }
+
+    void ClusterSnapshot::Generate(int nodeCount, int partitionCount, int seed)
+    {
+        Random random(seed);
+        int domainCount = 5;
+        int replicaCount = min(3, nodeCount);
+
+        entries_.clear();
+
+        for (int nodeId = 0; nodeId < nodeCount; ++nodeId)
+        {
+            entries_.push_back({
+                L"node",
+                wformatString("{0}", nodeId),
+                L"M1/10000,M2/10000",
+                wformatString("dc0/r{0}", nodeId % domainCount),
+                wformatString("{0}", nodeId % domainCount) });
+        }
+
+        entries_.push_back({ L"service", L"ReplayService", L"true", L"M1/1.0/10/5,M2/1.0/10/5", wformatString("{0}", replicaCount) });
+
+        for (int partitionId = 0; partitionId < partitionCount; ++partitionId)
+        {
+            // Replicas go to consecutive nodes, so they are in different fault and upgrade domains
+            int firstNode = random.Next(nodeCount);
+            wstring replicas;
+            for (int replica = 0; replica < replicaCount; ++replica)
+            {
+                replicas += wformatString("{0}{1}/{2}", replica == 0 ? L"" : L",", replica == 0 ? L"P" : L"S", (firstNode + replica) % nodeCount);
+            }
+
+            wstring id = wformatString("{0}", partitionId);
+            entries_.push_back({ L"partition", id, L"ReplayService", replicas });
+            entries_.push_back({ L"load", id, L"ReplayService", L"M1", wformatString("{0}", random.Next(100)), wformatString("{0}", random.Next(50)) });
+            entries_.push_back({ L"load", id, L"ReplayService", L"M2", wformatString("{0}", random.Next(100)), wformatString("{0}", random.Next(50)) });
+        }
+    }
+
+    void ClusterSnapshot::Apply(PlacementAndLoadBalancing & plb) const
+    {
+        wstring serviceType = L"ReplayServiceType";
+        plb.UpdateServiceType(ServiceTypeDescription(wstring(serviceType), set<NodeId>()));
+
+        set<wstring> statelessServices;
+
+        for (auto it = entries_.begin(); it != entries_.end(); ++it)
+        {
+            vector<wstring> const& fields = *it;
+            wstring const& type = fields[0];
+
+            if (type == L"node")
+            {
+                int nodeId = _wtoi(fields[1].c_str());
+                plb.UpdateNode(fields.size() == 5
+                    ? CreateNodeDescriptionWithDomainsAndCapacity(nodeId, fields[3], fields[4], GetList(fields[2]))
+                    : CreateNodeDescriptionWithCapacity(nodeId, GetList(fields[2])));
+            }
+            else if (type == L"service")
+            {
+                bool isStateful = StringUtility::AreEqualCaseInsensitive(fields[2], L"true");
+                int targetReplicaSetSize = fields.size() == 5 ? _wtoi(fields[4].c_str()) : 0;
+                if (!isStateful)
+                {
+                    statelessServices.insert(fields[1]);
+                }
+
+                plb.UpdateService(CreateServiceDescription(
+                    fields[1],
+                    serviceType,
+                    isStateful,
+                    CreateMetrics(GetList(fields[3])),
+                    FABRIC_MOVE_COST_LOW,
+                    false,
+                    targetReplicaSetSize));
+            }
+            else if (type == L"partition")
+            {
+                plb.UpdateFailoverUnit(FailoverUnitDescription(
+                    CreateGuid(_wtoi(fields[1].c_str())),
+                    wstring(fields[2]),
+                    0,
+                    CreateReplicas(GetList(fields[3])),
+                    0));
+            }
+            else if (type == L"load" && statelessServices.find(fields[2]) != statelessServices.end())
+            {
+                plb.UpdateLoadOrMoveCost(CreateLoadOrMoveCost(
+                    _wtoi(fields[1].c_str()),
+                    fields[2],
+                    fields[3],
+                    static_cast<uint>(_wtoi(fields[5].c_str()))));
+            }
+            else if (type == L"load")
+            {
+                plb.UpdateLoadOrMoveCost(CreateLoadOrMoveCost(
+                    _wtoi(fields[1].c_str()),
+                    fields[2],
+                    fields[3],
+                    static_cast<uint>(_wtoi(fields[4].c_str())),
+                    static_cast<uint>(_wtoi(fields[5].c_str()))));
+            }
+        }
+    }
+
+    bool TestPLBReplay::ClassSetup()
+    {
+        Trace.WriteInfo(PLBReplayPerfTestSource, "Random seed: {0}", PLBConfig::GetConfig().InitialRandomSeed);
+
+        fm_ = make_shared<TestFM>();
+
+        return TRUE;
+    }
+
+    bool TestPLBReplay::TestSetup()
+    {
+        fm_->Load();
+
+        return TRUE;
+    }
+
+    bool TestPLBReplay::ClassCleanup()
+    {
+        Trace.WriteInfo(PLBReplayPerfTestSource, "Cleaning up the class.");
+
+        // Dispose PLB
+        fm_->PLBTestHelper.Dispose();
+
+        return TRUE;
+    }
+}
@@ -73,7 +73,8 @@ Placement::Placement(
     partitionClosureType_(partitionClosureType),
     servicePackagePlacements_(move(servicePackagePlacement)),
     quorumBasedServicesCount_(quorumBasedServicesCount),
-    quorumBasedPartitionsCount_(quorumBasedPartitionsCount)
+    quorumBasedPartitionsCount_(quorumBasedPartitionsCount),
+    nodeLoads_(balanceChecker_->Nodes, GlobalMetricCount, TotalMetricCount)
 {
     // Remove down and deactivated nodes from eligible nodes!
     eligibleNodes_.DeleteNodeVecWithIndex(BalanceCheckerObj->DownNodes);
@@ -26,6 +26,7 @@
 #include "ApplicationReservedLoads.h"
 #include "ServicePackageEntry.h"
 #include "ServicePackagePlacement.h"
+#include "NodeLoadMatrix.h"
 
 namespace Reliability
 {
@@ -205,6 +206,9 @@ namespace Reliability
             __declspec (property(get = get_QuorumBasedPartitionsCount)) size_t QuorumBasedPartitionsCount;
             size_t get_QuorumBasedPartitionsCount() const { return quorumBasedPartitionsCount_; }
 
+            __declspec (property(get = get_NodeLoads)) NodeLoadMatrix const& NodeLoads;
+            NodeLoadMatrix const& get_NodeLoads() const { return nodeLoads_; }
+
         private:
             void PrepareServices();
             void PreparePartitions();
@@ -338,6 +342,9 @@ namespace Reliability
 
             size_t quorumBasedServicesCount_;
             size_t quorumBasedPartitionsCount_;
+
+            // Metric-major capacities and free capacities of nodes used by capacity checks
+            NodeLoadMatrix nodeLoads_;
         };
     }
 }
@@ -125,7 +125,8 @@ PlacementAndLoadBalancing::PlacementAndLoadBalancing(
     testTracingLock_(),
     testTracingBarrier_(testTracingLock_),
     lastStatisticsTrace_(StopwatchTime::Zero),
-    rgStatistics_()
+    rgStatistics_(),
+    snapshotGeneration_(0)
 {
     Trace.PLBConstruct(static_cast<int64>(nodes.size()), static_cast<int64>(serviceTypes.size()), static_cast<int64>(services.size()), static_cast<int64>(failoverUnits.size()), static_cast<int64>(loadOrMoveCosts.size()));
 
@@ -175,6 +176,7 @@ PlacementAndLoadBalancing::PlacementAndLoadBalancing(
 
     for (auto itLoad = loadOrMoveCosts.begin(); itLoad != loadOrMoveCosts.end(); ++itLoad)
     {
+        MetricIdTable::GetTable().ResolveIds(*itLoad);
         InternalUpdateLoadOrMoveCost(move(*itLoad));
     }
 
@@ -226,6 +228,7 @@ void PlacementAndLoadBalancing::SetMovementEnabled(bool constraintCheckEnabled,
     }
 
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
     StopwatchTime now = Stopwatch::Now();
 
     constraintCheckEnabled_.store(constraintCheckEnabled);
@@ -258,6 +261,8 @@ void PlacementAndLoadBalancing::UpdateNode(NodeDescription && nodeDescription)
 
 void PlacementAndLoadBalancing::ProcessUpdateNode(NodeDescription && nodeDescription, StopwatchTime timeStamp)
 {
+    ++snapshotGeneration_;
+
     Federation::NodeId nodeId = nodeDescription.NodeId;
     auto itNodeId = nodeToIndexMap_.find(nodeId);
     uint64 nodeIndex = UINT64_MAX;
@@ -482,6 +487,7 @@ void PlacementAndLoadBalancing::UpdateServiceType(ServiceTypeDescription && serv
     }
 
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     wstring serviceTypeName = serviceTypeDescription.Name;
     bool changed = false;
@@ -525,6 +531,7 @@ void PlacementAndLoadBalancing::UpdateClusterUpgrade(bool isUpgradeInProgress, s
     Trace.UpdateUpgradeCompletedUDs(L"cluster", isUpgradeInProgress, UDsToString(completedUDs));
 
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     clusterUpgradeInProgress_.store(isUpgradeInProgress);
 
@@ -562,6 +569,7 @@ Common::ErrorCode PlacementAndLoadBalancing::UpdateApplication(ApplicationDescri
     wstring applicationName = applicationDescription.Name;
 
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     if (applicationDescription.ApplicationId == 0)
     {
@@ -1001,6 +1009,7 @@ void PlacementAndLoadBalancing::DeleteApplication(std::wstring const& applicatio
     }
 
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     if (applicationToIdMap_.find(applicationName) == applicationToIdMap_.end())
     {
@@ -1199,6 +1208,7 @@ void PlacementAndLoadBalancing::DeleteServiceType(wstring const& serviceTypeName
 
     // assume all failover units of the service have already been deleted
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     auto itServiceType = serviceTypeTable_.find(serviceTypeName);
     if (itServiceType != serviceTypeTable_.end()) // to deal with the case where a deleted service be deleted again
@@ -1216,6 +1226,7 @@ ErrorCode PlacementAndLoadBalancing::UpdateService(ServiceDescription && service
     }
 
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     wstring serviceName = serviceDescription.Name;
 
@@ -1233,6 +1244,7 @@ void PlacementAndLoadBalancing::DeleteService(std::wstring const& serviceName)
 
     // assume all failover units of the service have already been deleted
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     // consume all pending updates so we won't have dangling FailoverUnits
     ProcessPendingUpdatesCallerHoldsLock(Stopwatch::Now());
@@ -1273,6 +1285,9 @@ void PlacementAndLoadBalancing::UpdateLoadOrMoveCost(LoadOrMoveCostDescription &
 
     // don't stop existing load balancing If only load is changed
 
+    // Resolve metric ids before taking any PLB lock, so that processing the report compares ids only
+    MetricIdTable::GetTable().ResolveIds(loadOrMoveCost);
+
     LockAndSetBooleanLock grab(bufferUpdateLock_);
 
     InternalUpdateLoadOrMoveCost(move(loadOrMoveCost));
@@ -1481,6 +1496,7 @@ void PlacementAndLoadBalancing::Refresh(StopwatchTime now)
     }
 
     plbRefreshTimers_.Reset();
+    plbRefreshScores_.Reset();
 
     nextActionPeriod_ = Common::TimeSpan::MaxValue;
 
@@ -1594,6 +1610,9 @@ void PlacementAndLoadBalancing::Refresh(StopwatchTime now)
         currentPlacementMovementCount = 0;
         totalOperationCount = 0;
 
+        vector<ParallelSearchResult> parallelSearchResults(noOfServiceDomains);
+        RunParallelSearches(searcherDataList, scrambler, stats, parallelSearchResults);
+
         for (size_t i = 0; i < noOfServiceDomains; i++)
         {
             auto itData = &(searcherDataList[scrambler[i]]);
@@ -1629,7 +1648,7 @@ void PlacementAndLoadBalancing::Refresh(StopwatchTime now)
             size_t placementBatchIndex = 0;
             while (placementBatchIndex < numBatch)
             {
-                RunSearcher(itData, stats, totalOperationCount, currentPlacementMovementCount, currentBalancingMovementCount);
+                RunSearcher(itData, stats, totalOperationCount, currentPlacementMovementCount, currentBalancingMovementCount, &(parallelSearchResults[scrambler[i]]));
 
                 placementBatchIndex++;
 
@@ -1841,6 +1860,13 @@ void PlacementAndLoadBalancing::PLBRefreshTimers::Reset()
     msRefreshTime = 0;
 }
 
+void PlacementAndLoadBalancing::PLBRefreshScores::Reset()
+{
+    searchedDomainCount = 0;
+    originalEnergy = 0.0;
+    newEnergy = 0.0;
+}
+
 //------------------------------------------------------------
 // private members
 //------------------------------------------------------------
@@ -3904,11 +3930,100 @@ void PlacementAndLoadBalancing::BeginRefresh(vector<ServiceDomain::DomainData> &
     }
 }
 
+void PlacementAndLoadBalancing::RunParallelSearches(
+    vector<ServiceDomain::DomainData> & searcherDataList,
+    vector<size_t> const& scrambler,
+    ServiceDomainStats const& stats,
+    vector<ParallelSearchResult> & results)
+{
+    PLBConfig const& config = PLBConfig::GetConfig();
+    size_t parallelism = static_cast<size_t>(max(config.SearcherDomainParallelism, 1));
+
+    if (parallelism <= 1 || !searcher_)
+    {
+        return;
+    }
+
+    // Only balancing searches are run concurrently: placement and constraint check searches
+    // share diagnostics tables that are not safe to update from several searchers at once.
+    // Domains with a balancing movement throttle are left to RunSearcher, since their allowed
+    // movements depend on the movements generated by the domains searched before them.
+    vector<size_t> domains;
+    for (size_t i = 0; i < scrambler.size(); i++)
+    {
+        ServiceDomain::DomainData const& domainData = searcherDataList[scrambler[i]];
+
+        if (domainData.action_.IsSkip ||
+            !domainData.action_.IsBalancing() ||
+            GetAllowedMovements(domainData.action_, stats.existingReplicaCount_, 0, 0) != SIZE_T_MAX)
+        {
+            continue;
+        }
+
+        domains.push_back(scrambler[i]);
+    }
+
+    if (domains.size() < 2)
+    {
+        return;
+    }
+
+    parallelism = min(parallelism, domains.size());
+
+    Trace.Searcher(wformatString("RunParallelSearches: running {0} domain searches with parallelism {1}", domains.size(), parallelism));
+
+    // Every searcher reseeds with the same seed before each search, so a domain gets the same
+    // solution regardless of the searcher instance or thread it is searched on.
+    int randomSeed = searcher_->RandomSeed;
+    size_t yieldDuration = static_cast<size_t>(config.YieldDurationPer10ms);
+
+    atomic_uint64 nextDomain(0);
+    atomic_uint64 pendingWorkers(parallelism);
+    ManualResetEvent workersCompleted(false);
+
+    auto worker = [&]()
+    {
+        Searcher searcher(Trace, stopSearching_, balancingEnabled_, plbDiagnosticsSPtr_, yieldDuration, randomSeed);
+
+        for (uint64 index = nextDomain++; index < domains.size(); index = nextDomain++)
+        {
+            ServiceDomain::DomainData & domainData = searcherDataList[domains[index]];
+            Placement const& pl = *(domainData.state_.PlacementObj);
+
+            StopwatchTime domainStartTime = Stopwatch::Now();
+
+            results[domains[index]].Solution = make_unique<CandidateSolution>(searcher.SearchForSolution(
+                domainData.action_,
+                pl,
+                *(domainData.state_.CheckerObj),
+                domainData.domainId_,
+                pl.BalanceCheckerObj->ExistDefragMetric,
+                SIZE_T_MAX));
+            results[domains[index]].Duration = Stopwatch::Now() - domainStartTime;
+        }
+
+        if (--pendingWorkers == 0)
+        {
+            workersCompleted.Set();
+        }
+    };
+
+    for (size_t i = 1; i < parallelism; i++)
+    {
+        Threadpool::Post(worker);
+    }
+
+    worker();
+
+    workersCompleted.WaitOne();
+}
+
 void PlacementAndLoadBalancing::RunSearcher(ServiceDomain::DomainData * searcherDomainData,
     ServiceDomainStats const& stats,
     size_t& totalOperationCount,
     size_t& currentPlacementMovementCount,
-    size_t& currentBalancingMovementCount)
+    size_t& currentBalancingMovementCount,
+    ParallelSearchResult * parallelSearchResult)
 {
     this->LoadBalancingCounters->ResetCategoricalCounterCheckStates();
 
@@ -3991,21 +4106,28 @@ void PlacementAndLoadBalancing::RunSearcher(ServiceDomain::DomainData * searcher
 
         StopwatchTime domainStartTime = Stopwatch::Now();
 
-        size_t allowedMovements = GetAllowedMovements(searcherDomainData->action_,
-            stats.existingReplicaCount_,
-            currentPlacementMovementCount,
-            currentBalancingMovementCount);
-        CandidateSolution solution = searcher_->SearchForSolution(
-            searcherDomainData->action_,
-            pl,
-            *(searcherDomainData->state_.CheckerObj),
-            searcherDomainData->domainId_,
-            pl.BalanceCheckerObj->ExistDefragMetric,
-            allowedMovements);
-        TimeSpan domainDelta = Stopwatch::Now() - domainStartTime;
+        CandidateSolution solution = (parallelSearchResult != nullptr && parallelSearchResult->Solution)
+            ? move(*(parallelSearchResult->Solution))
+            : searcher_->SearchForSolution(
+                searcherDomainData->action_,
+                pl,
+                *(searcherDomainData->state_.CheckerObj),
+                searcherDomainData->domainId_,
+                pl.BalanceCheckerObj->ExistDefragMetric,
+                GetAllowedMovements(searcherDomainData->action_,
+                    stats.existingReplicaCount_,
+                    currentPlacementMovementCount,
+                    currentBalancingMovementCount));
+        TimeSpan domainDelta = (parallelSearchResult != nullptr && parallelSearchResult->Solution)
+            ? parallelSearchResult->Duration
+            : Stopwatch::Now() - domainStartTime;
 
         searcherDomainData->isInterrupted_ = searcher_->IsInterrupted();
         searcherDomainData->newAvgStdDev_ = solution.AvgStdDev;
+
+        ++plbRefreshScores_.searchedDomainCount;
+        plbRefreshScores_.originalEnergy += originalScore.Energy;
+        plbRefreshScores_.newEnergy += solution.Energy;
         if (searcherDomainData->isInterrupted_)
         {
             searcherDomainData->interruptTime_ = Stopwatch::Now();
@@ -4925,14 +5047,16 @@ Common::ErrorCode PlacementAndLoadBalancing::SnapshotConstraintChecker(
         auto & newSnap = (snapshotsOnEachRefresh_->second.CreatedTimeUtc > snapshotsOnEachRefresh_->first.CreatedTimeUtc) ?
             snapshotsOnEachRefresh_->second.ServiceDomainSnapshot : snapshotsOnEachRefresh_->first.ServiceDomainSnapshot;
 
-        auto & snapState = newSnap.at(domainId).state_;
+        // Snapshots are reused across refreshes and shared with queries, so the full closure
+        // needed for the check is built into a private state instead of into the snapshot.
+        SystemState checkState(newSnap.at(domainId)->state_.serviceDomain_, Trace, plbDiagnosticsSPtr_);
 
         {
             AcquireExclusiveLock grabBig(lock_);
-            snapState.CreatePlacementAndChecker(PartitionClosureType::Full);
+            checkState.CreatePlacementAndChecker(PartitionClosureType::Full);
         }
 
-        PlacementUPtr const& pl = snapState.PlacementObj;
+        PlacementUPtr const& pl = checkState.PlacementObj;
         CandidateSolution solution(&(*pl), vector<Movement>(), vector<Movement>(), PLBSchedulerActionType::ConstraintCheck);
         TempSolution tempSolution(solution);
         NodeEntry *currentEntry = nullptr, *futureEntry = nullptr;
@@ -4992,7 +5116,7 @@ Common::ErrorCode PlacementAndLoadBalancing::SnapshotConstraintChecker(
             CandidateSolution newSolution(&(*pl), vector<Movement>(), move(migrates), PLBSchedulerActionType::ConstraintCheck);
             TempSolution newTempSolution(newSolution);
             std::wstring errMsg = L"";
-            bool isValid = snapState.CheckerObj->CheckSolutionForTriggerMigrateReplicaValidity(newTempSolution, replicaPtr, errMsg);
+            bool isValid = checkState.CheckerObj->CheckSolutionForTriggerMigrateReplicaValidity(newTempSolution, replicaPtr, errMsg);
 
             if (!isValid)
             {
@@ -5119,15 +5243,16 @@ std::pair<Common::ErrorCode, std::vector<Federation::NodeId>> PlacementAndLoadBa
         auto& newSnap = (snapshotsOnEachRefresh_->second.CreatedTimeUtc > snapshotsOnEachRefresh_->first.CreatedTimeUtc) ?
             snapshotsOnEachRefresh_->second.ServiceDomainSnapshot : snapshotsOnEachRefresh_->first.ServiceDomainSnapshot;
 
-        auto& snapState = newSnap.at(domainId).state_;
+        // Build the checker into a private state: the snapshot itself may be reused by later refreshes.
+        SystemState checkState(newSnap.at(domainId)->state_.serviceDomain_, Trace, plbDiagnosticsSPtr_);
 
         {
             AcquireExclusiveLock bigGrab(lock_);
             //Run this to generate the checkerObj
-            snapState.CreatePlacementAndChecker(PartitionClosureType::Full);
+            checkState.CreatePlacementAndChecker(PartitionClosureType::Full);
         }
 
-        PlacementUPtr const& pl = snapState.PlacementObj;
+        PlacementUPtr const& pl = checkState.PlacementObj;
         CandidateSolution solution(&(*pl), vector<Movement>(), vector<Movement>(), PLBSchedulerActionType::ConstraintCheck);
         TempSolution tempSolution(solution);
 
@@ -5155,13 +5280,13 @@ std::pair<Common::ErrorCode, std::vector<Federation::NodeId>> PlacementAndLoadBa
         if (replicaPtr)
         {
             Trace.MoveReplicaOrInstance(L"Replica Pointer Valid");
-            return make_pair(ErrorCode().Success(), snapState.CheckerObj->NodesAvailableForTriggerRandomMove(tempSolution, replicaPtr, randomEng, force));
+            return make_pair(ErrorCode().Success(), checkState.CheckerObj->NodesAvailableForTriggerRandomMove(tempSolution, replicaPtr, randomEng, force));
         }
         else
         {
-            if (snapState.serviceDomain_.FailoverUnits.count(failoverUnit.FUId))
+            if (checkState.serviceDomain_.FailoverUnits.count(failoverUnit.FUId))
             {
-                FailoverUnit const& cachedFUState = snapState.serviceDomain_.FailoverUnits.at(failoverUnit.FUId);
+                FailoverUnit const& cachedFUState = checkState.serviceDomain_.FailoverUnits.at(failoverUnit.FUId);
 
                 if (cachedFUState.FuDescription.Version != failoverUnit.FuDescription.Version)
                 {
@@ -5405,12 +5530,13 @@ Snapshot PlacementAndLoadBalancing::TakeSnapShot()
     timer.Start();
     Trace.SnapshotStart();
 
-    map<wstring, ServiceDomain::DomainData> serviceDomainMap;
+    map<wstring, ServiceDomain::DomainDataSPtr> serviceDomainMap;
+    StopwatchTime now = Stopwatch::Now();
 
     for (auto iter = serviceDomainTable_.begin(); iter != serviceDomainTable_.end(); ++iter)
     {
-        ServiceDomain::DomainData domainData = iter->second.TakeSnapshot(plbDiagnosticsSPtr_);
-        serviceDomainMap.insert(pair<wstring, ServiceDomain::DomainData>(iter->first, move(domainData)));
+        ServiceDomain::DomainDataSPtr domainData = iter->second.TakeSnapshot(plbDiagnosticsSPtr_, snapshotGeneration_, now);
+        serviceDomainMap.insert(make_pair(iter->first, move(domainData)));
     }
 
     // We want to snapshot metrics that do have capacity but no services.
@@ -5433,8 +5559,8 @@ Snapshot PlacementAndLoadBalancing::TakeSnapShot()
 
     if (prefix != L"")
     {
-        ServiceDomain::DomainData domainData = tempDomainUPtr->TakeSnapshot(plbDiagnosticsSPtr_);
-        serviceDomainMap.insert(pair<wstring, ServiceDomain::DomainData>(prefix, move(domainData)));
+        ServiceDomain::DomainDataSPtr domainData = tempDomainUPtr->TakeSnapshot(plbDiagnosticsSPtr_, snapshotGeneration_, now);
+        serviceDomainMap.insert(make_pair(prefix, move(domainData)));
     }
 
     Snapshot snapshot = move(Snapshot(move(serviceDomainMap)));
@@ -5551,13 +5677,13 @@ Common::ErrorCode PlacementAndLoadBalancing::GetClusterLoadInformationQueryResul
 
     for (auto iter = snapshots->first.ServiceDomainSnapshot.begin(); iter != snapshots->first.ServiceDomainSnapshot.end(); iter++)
     {
-        TESTASSERT_IFNOT(iter->second.state_.PlacementObj, "Placement object before refresh is not available for service domain: {0}", iter->second.domainId_);
-        if (!iter->second.state_.PlacementObj)
+        TESTASSERT_IFNOT(iter->second->state_.PlacementObj, "Placement object before refresh is not available for service domain: {0}", iter->second->domainId_);
+        if (!iter->second->state_.PlacementObj)
         {
             Trace.InternalError(L"GetClusterLoadInformationQueryResult(): Placement object is nullptr in shapshot.");
             return ErrorCodeValue::PLBNotReady;
         }
-        Placement const& pl = *(iter->second.state_.PlacementObj);
+        Placement const& pl = *(iter->second->state_.PlacementObj);
 
         Score originalScore(
             pl.TotalMetricCount,
@@ -5579,7 +5705,7 @@ Common::ErrorCode PlacementAndLoadBalancing::GetClusterLoadInformationQueryResul
                 loadMetricInformation.put_Name(j->Name);
                 loadMetricInformation.IsBalancedBefore = j->IsBalanced;
                 loadMetricInformation.DeviationBefore = originalScore.CalculateAvgStdDevForMetric(j->Name);
-                PLBSchedulerAction action = iter->second.action_;
+                PLBSchedulerAction action = iter->second->action_;
                 loadMetricInformation.Action = action.ToQueryString();
                 loadMetricInformation.MaxNodeLoadValue = -1;
                 loadMetricInformation.MinNodeLoadValue = -1;
@@ -5592,14 +5718,14 @@ Common::ErrorCode PlacementAndLoadBalancing::GetClusterLoadInformationQueryResul
 
     for (auto iter = snapshots->second.ServiceDomainSnapshot.begin(); iter != snapshots->second.ServiceDomainSnapshot.end(); iter++)
     {
-        TESTASSERT_IFNOT(iter->second.state_.PlacementObj, "Placement object after refresh is not available for service domain: {0}", iter->second.domainId_);
-        if (!iter->second.state_.PlacementObj)
+        TESTASSERT_IFNOT(iter->second->state_.PlacementObj, "Placement object after refresh is not available for service domain: {0}", iter->second->domainId_);
+        if (!iter->second->state_.PlacementObj)
         {
             Trace.InternalError(L"GetClusterLoadInformationQueryResult(): Placement object is nullptr in shapshot.");
             return ErrorCodeValue::PLBNotReady;
         }
 
-        Placement const& pl = *(iter->second.state_.PlacementObj);
+        Placement const& pl = *(iter->second->state_.PlacementObj);
 
         Score originalScore(
             pl.TotalMetricCount,
@@ -5776,9 +5902,9 @@ Common::ErrorCode PlacementAndLoadBalancing::GetNodeLoadInformationQueryResult(F
 
     for (auto iter = snapshots->second.ServiceDomainSnapshot.begin(); iter != snapshots->second.ServiceDomainSnapshot.end(); ++iter)
     {
-        if (iter->second.state_.PlacementObj)
+        if (iter->second->state_.PlacementObj)
         {
-            Placement const& pl = *(iter->second.state_.PlacementObj);
+            Placement const& pl = *(iter->second->state_.PlacementObj);
             for (size_t j = 0; j< pl.NodeCount; ++j)
             {
                 NodeEntry const & node = pl.SelectNode(j);
@@ -6022,6 +6148,8 @@ void PlacementAndLoadBalancing::ExecuteDomainChange(bool mergeOnly)
 
 void PlacementAndLoadBalancing::UpdateUseSeparateSecondaryLoadConfig(bool newUseSeparateSecondaryLoad)
 {
+    ++snapshotGeneration_;
+
     //if there was a change we remove all FUs and readd them with new config
     for (auto itDomains = serviceDomainTable_.begin(); itDomains != serviceDomainTable_.end(); ++itDomains)
     {
@@ -6057,6 +6185,7 @@ void PlacementAndLoadBalancing::UpdateUseSeparateSecondaryLoadConfig(bool newUse
 void PlacementAndLoadBalancing::OnSafetyCheckAcknowledged(ServiceModel::ApplicationIdentifier const & appId)
 {
     AcquireWriteLock grab(lock_);
+    ++snapshotGeneration_;
 
     for (auto & app : applicationTable_)
     {
@@ -219,6 +219,19 @@ namespace Reliability
             __declspec (property(get = getRefreshTimers)) PLBRefreshTimers const& RefreshTimers;
             PLBRefreshTimers const& getRefreshTimers() const { return plbRefreshTimers_; }
 
+            // Score energies of the searches run in the last refresh, used to compare search quality offline
+            struct PLBRefreshScores
+            {
+                size_t searchedDomainCount = 0;
+                double originalEnergy = 0.0;    // Sum of energies of the searched domains before the search
+                double newEnergy = 0.0;         // Sum of energies of the solutions found for the searched domains
+
+                void Reset();
+            };
+
+            __declspec (property(get = getRefreshScores)) PLBRefreshScores const& RefreshScores;
+            PLBRefreshScores const& getRefreshScores() const { return plbRefreshScores_; }
+
             void PassMovementsToFM(vector<ServiceDomain::DomainData> & searcherDataList);
             void UpdatePartitionsWithCreation(vector<ServiceDomain::DomainData> & searcherDataList);
 
@@ -342,11 +355,29 @@ namespace Reliability
             void ProcessUpdateNode(NodeDescription && nodeDescription, Common::StopwatchTime timeStamp);
 
             void BeginRefresh(std::vector<ServiceDomain::DomainData> & dataList, ServiceDomainStats & stats, Common::StopwatchTime refreshTime);
+
+            // Result of a search that was run ahead of RunSearcher, concurrently with searches of other domains
+            struct ParallelSearchResult
+            {
+                std::unique_ptr<CandidateSolution> Solution;
+                Common::TimeSpan Duration;
+            };
+
+            // Runs balancing searches of independent domains concurrently (SearcherDomainParallelism).
+            // Results are indexed the same way as searcherDataList and are consumed in scrambler order by RunSearcher,
+            // so the movements passed to FM do not depend on the order in which the searches complete.
+            void RunParallelSearches(
+                std::vector<ServiceDomain::DomainData> & searcherDataList,
+                std::vector<size_t> const& scrambler,
+                ServiceDomainStats const& stats,
+                std::vector<ParallelSearchResult> & results);
+
             void RunSearcher(ServiceDomain::DomainData * searcherDomainData,
                 ServiceDomainStats const& stats,
                 size_t& totalOperationCount,
                 size_t& currentPlacementMovementCount,
-                size_t& currentBalancingMovementCount);     
+                size_t& currentBalancingMovementCount,
+                ParallelSearchResult * parallelSearchResult = nullptr);
             void EndRefresh(ServiceDomain::DomainData * searcherDomainData, Common::StopwatchTime refreshTime);
 
             void TracePeriodical(ServiceDomainStats& stats, Common::StopwatchTime refreshTime);
@@ -563,6 +594,10 @@ namespace Reliability
 
             std::shared_ptr<std::pair<Snapshot,Snapshot>> snapshotsOnEachRefresh_;
 
+            // Incremented on every PLB-wide change that can affect service domain snapshots (nodes, services, applications...).
+            // Changes of failover units and loads are tracked by each service domain, so that unchanged domains can reuse their snapshots.
+            uint64 snapshotGeneration_;
+
             Common::StopwatchTime lastStatisticsTrace_;
             RGStatistics rgStatistics_;
 
@@ -601,6 +636,9 @@ namespace Reliability
             // Timers that gives insight into PLB refresh duration
             PLBRefreshTimers plbRefreshTimers_;
 
+            // Score energies of the searches run in the last refresh
+            PLBRefreshScores plbRefreshScores_;
+
             // synchronization for the test as TestFM can create multiple PLB objects
             bool tracingJobQueueFinished_;
 #if !defined(PLATFORM_UNIX)
@@ -563,6 +563,169 @@ void PlacementAndLoadBalancingTestHelper::GetReservedLoadNode(wstring const& met
     }
 }
 
+ServiceDomain::DomainDataSPtr PlacementAndLoadBalancingTestHelper::GetLatestDomainSnapshot(wstring const& metricName) const
+{
+    ServiceDomain::DomainId domainId;
+    {
+        AcquireReadLock grab(plb_.lock_);
+        auto sdIterator = plb_.metricToDomainTable_.find(metricName);
+        if (sdIterator == plb_.metricToDomainTable_.end())
+        {
+            return nullptr;
+        }
+        domainId = sdIterator->second->first;
+    }
+
+    AcquireReadLock grab(plb_.snapshotLock_);
+    if (plb_.snapshotsOnEachRefresh_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto const& snapshots = *plb_.snapshotsOnEachRefresh_;
+    auto const& latest = (snapshots.second.CreatedTimeUtc > snapshots.first.CreatedTimeUtc) ? snapshots.second : snapshots.first;
+
+    auto itDomain = latest.ServiceDomainSnapshot.find(domainId);
+    return itDomain == latest.ServiceDomainSnapshot.end() ? nullptr : itDomain->second;
+}
+
+ErrorCode PlacementAndLoadBalancingTestHelper::ExportClusterSnapshot(wstring const& fileName) const
+{
+    wstring text;
+    StringWriter writer(text);
+
+    {
+        AcquireReadLock grab(plb_.lock_);
+
+        writer.WriteLine("# Exported cluster snapshot: {0} nodes, {1} service domains", plb_.nodes_.size(), plb_.serviceDomainTable_.size());
+
+        for (size_t nodeIndex = 0; nodeIndex < plb_.nodes_.size(); ++nodeIndex)
+        {
+            NodeDescription const& node = plb_.nodes_[nodeIndex].NodeDescriptionObj;
+
+            wstring capacities;
+            for (auto itCapacity = node.Capacities.begin(); itCapacity != node.Capacities.end(); ++itCapacity)
+            {
+                capacities += wformatString("{0}{1}/{2}", capacities.empty() ? L"" : L",", itCapacity->first, itCapacity->second);
+            }
+
+            wstring faultDomain;
+            for (auto itSegment = node.FaultDomainId.begin(); itSegment != node.FaultDomainId.end(); ++itSegment)
+            {
+                faultDomain += wformatString("{0}{1}", faultDomain.empty() ? L"" : L"/", *itSegment);
+            }
+
+            if (faultDomain.empty() || node.UpgradeDomainId.empty())
+            {
+                writer.WriteLine("node {0} {1}", nodeIndex, capacities.empty() ? L"-" : capacities);
+            }
+            else
+            {
+                writer.WriteLine("node {0} {1} {2} {3}", nodeIndex, capacities.empty() ? L"-" : capacities, faultDomain, node.UpgradeDomainId);
+            }
+        }
+
+        int partitionIndex = 0;
+        for (auto itDomain = plb_.serviceDomainTable_.begin(); itDomain != plb_.serviceDomainTable_.end(); ++itDomain)
+        {
+            ServiceDomain & serviceDomain = itDomain->second;
+
+            for (auto itService = serviceDomain.Services.begin(); itService != serviceDomain.Services.end(); ++itService)
+            {
+                ServiceDescription const& service = itService->second.ServiceDesc;
+
+                wstring metrics;
+                for (auto itMetric = service.Metrics.begin(); itMetric != service.Metrics.end(); ++itMetric)
+                {
+                    metrics += wformatString("{0}{1}/{2}/{3}/{4}",
+                        metrics.empty() ? L"" : L",",
+                        itMetric->Name,
+                        itMetric->Weight,
+                        itMetric->PrimaryDefaultLoad,
+                        itMetric->SecondaryDefaultLoad);
+                }
+
+                writer.WriteLine("service {0} {1} {2} {3}",
+                    service.Name,
+                    service.IsStateful ? L"true" : L"false",
+                    metrics.empty() ? L"-" : metrics,
+                    service.TargetReplicaSetSize);
+            }
+
+            for (auto itFailoverUnit = serviceDomain.FailoverUnits.begin(); itFailoverUnit != serviceDomain.FailoverUnits.end(); ++itFailoverUnit)
+            {
+                FailoverUnit const& failoverUnit = itFailoverUnit->second;
+                FailoverUnitDescription const& description = failoverUnit.FuDescription;
+
+                wstring replicas;
+                for (auto itReplica = description.Replicas.begin(); itReplica != description.Replicas.end(); ++itReplica)
+                {
+                    auto itNodeIndex = plb_.nodeToIndexMap_.find(itReplica->NodeId);
+                    if (itNodeIndex == plb_.nodeToIndexMap_.end())
+                    {
+                        continue;
+                    }
+
+                    wstring role;
+                    switch (itReplica->CurrentRole)
+                    {
+                    case ReplicaRole::Primary: role = L"P"; break;
+                    case ReplicaRole::Secondary: role = L"S"; break;
+                    case ReplicaRole::StandBy: role = L"SB"; break;
+                    case ReplicaRole::Dropped: role = L"D"; break;
+                    default: role = L"N"; break;
+                    }
+
+                    replicas += wformatString("{0}{1}/{2}", replicas.empty() ? L"" : L",", role, itNodeIndex->second);
+                }
+
+                if (replicas.empty())
+                {
+                    continue;
+                }
+
+                writer.WriteLine("partition {0} {1} {2}", partitionIndex, description.ServiceName, replicas);
+
+                Service const& service = serviceDomain.GetService(description.ServiceId);
+                vector<ServiceMetric> const& metrics = service.ServiceDesc.Metrics;
+                for (size_t metricIndex = 0; metricIndex < metrics.size(); ++metricIndex)
+                {
+                    bool isReported = failoverUnit.IsSecondaryLoadReported[metricIndex] ||
+                        (service.ServiceDesc.IsStateful && failoverUnit.IsPrimaryLoadReported[metricIndex]);
+
+                    if (metrics[metricIndex].IsBuiltIn || !isReported)
+                    {
+                        continue;
+                    }
+
+                    writer.WriteLine("load {0} {1} {2} {3} {4}",
+                        partitionIndex,
+                        description.ServiceName,
+                        metrics[metricIndex].Name,
+                        failoverUnit.PrimaryEntries[metricIndex],
+                        failoverUnit.SecondaryEntries[metricIndex]);
+                }
+
+                ++partitionIndex;
+            }
+        }
+    }
+
+    File file;
+    auto error = file.TryOpen(fileName, FileMode::Create, FileAccess::Write, FileShare::None);
+    if (!error.IsSuccess())
+    {
+        return error;
+    }
+
+    string utf8Text = StringUtility::Utf16ToUtf8(text);
+    DWORD bytesWritten = 0;
+    error = file.TryWrite2(utf8Text.data(), static_cast<int>(utf8Text.size()), bytesWritten);
+    file.Close();
+
+    return error;
+}
+
 void PlacementAndLoadBalancingTestHelper::GetApplicationSumLoadAndCapacityHelper(
     ServiceDomain const& serviceDomain,
     uint64 appId, 
@@ -9,6 +9,7 @@
 #include "FailoverUnitMovement.h"
 #include "IPlacementAndLoadBalancing.h"
 #include "ReplicaRole.h"
+#include "ServiceDomain.h"
 
 namespace Reliability
 {
@@ -125,6 +126,14 @@ namespace Reliability
 
             void GetReservedLoadNode(wstring const& metricName, int64 & reservedLoadUsed, Federation::NodeId) const;
 
+            // Returns the data of the domain containing the metric from the latest snapshot taken on refresh
+            ServiceDomain::DomainDataSPtr GetLatestDomainSnapshot(wstring const& metricName) const;
+
+            // Writes nodes, services, partitions and reported loads in the cluster snapshot format replayed by
+            // LoadBalancing.Perf (see PLBReplay.PerfTest.cpp). Nodes and partitions are renumbered in the order they
+            // are written. Placement constraints, affinity, applications and per node secondary loads are not exported.
+            Common::ErrorCode ExportClusterSnapshot(std::wstring const& fileName) const;
+
             // helper function for getting load - used to merge the logic for nonAppGroup and appGroup applications
             void GetApplicationSumLoadAndCapacityHelper(
                 ServiceDomain const& serviceDomain,
@@ -29,6 +29,9 @@ Score::Score(
     nodeMetricScores_(),
     udMetricScores_(),
     fdMetricScores_(),
+    metricStdDevs_(totalMetricCount, 0.0),
+    changedMetrics_(totalMetricCount, false),
+    allMetricsChanged_(true),
     existDefragMetric_(existDefragMetric),
     existScopedDefragMetric_(existScopedDefragMetric),
     defragTargetEmptyNodesAchieved_(false),
@@ -83,6 +86,9 @@ Score::Score(Score && other)
     nodeMetricScores_(move(other.nodeMetricScores_)),
     udMetricScores_(move(other.udMetricScores_)),
     fdMetricScores_(move(other.fdMetricScores_)),
+    metricStdDevs_(move(other.metricStdDevs_)),
+    changedMetrics_(move(other.changedMetrics_)),
+    allMetricsChanged_(other.allMetricsChanged_),
     existDefragMetric_(other.existDefragMetric_),
     existScopedDefragMetric_(other.existScopedDefragMetric_),
     defragTargetEmptyNodesAchieved_(other.defragTargetEmptyNodesAchieved_),
@@ -103,6 +109,9 @@ Score::Score(Score const& other)
     nodeMetricScores_(other.nodeMetricScores_),
     udMetricScores_(other.udMetricScores_),
     fdMetricScores_(other.fdMetricScores_),
+    metricStdDevs_(other.metricStdDevs_),
+    changedMetrics_(other.changedMetrics_),
+    allMetricsChanged_(other.allMetricsChanged_),
     existDefragMetric_(other.existDefragMetric_),
     existScopedDefragMetric_(other.existScopedDefragMetric_),
     defragTargetEmptyNodesAchieved_(other.defragTargetEmptyNodesAchieved_),
@@ -130,6 +139,9 @@ Score & Score::operator = (Score && other)
         nodeMetricScores_ = move(other.nodeMetricScores_);
         udMetricScores_ = move(other.udMetricScores_);
         fdMetricScores_ = move(other.fdMetricScores_);
+        metricStdDevs_ = move(other.metricStdDevs_);
+        changedMetrics_ = move(other.changedMetrics_);
+        allMetricsChanged_ = other.allMetricsChanged_;
         existDefragMetric_ = other.existDefragMetric_;
         existScopedDefragMetric_ = other.existScopedDefragMetric_;
         defragTargetEmptyNodesAchieved_ = other.defragTargetEmptyNodesAchieved_;
@@ -249,6 +261,7 @@ void Score::UpdateMetricScores(NodeMetrics const& nodeChanges)
             int64 loadLevelNew = node->GetLoadLevel(totalMetricIndex, changes.Values[totalMetricIndex]);
 
             nodeMetricScores_[totalMetricIndex].AdjustOneValue(loadLevelOld, loadLevelNew);
+            SetMetricChanged(totalMetricIndex);
 
             if (isDefragMetric)
             {
@@ -343,6 +356,7 @@ void Score::UpdateMetricScores(NodeMetrics const& newNodeChanges, NodeMetrics co
             int64 loadLevelNew = node->GetLoadLevel(totalMetricIndex, newChanges.Values[totalMetricIndex]);
 
             nodeMetricScores_[totalMetricIndex].AdjustOneValue(loadLevelOld, loadLevelNew);
+            SetMetricChanged(totalMetricIndex);
 
             if (isDefragMetric)
             {
@@ -514,15 +528,23 @@ void Score::CalculateAvgStdDev()
         {
             auto& metric = lbDomain.Metrics[j];
 
-            lbDomainScore += StdDevCaculationHelper(currentIndex,
-                metric.IsDefrag,
-                metric.DefragmentationScopedAlgorithmEnabled,
-                metric.placementStrategy,
-                metric.DefragNodeCount,
-                metric.DefragmentationEmptyNodeWeight,
-                metric.DefragDistribution,
-                metric.DefragEmptyNodeLoadThreshold,
-                metric.Weight);
+            // Scoped defrag score depends on dynamic node loads and also updates defragTargetEmptyNodesAchieved_
+            if (allMetricsChanged_ || changedMetrics_[currentIndex] || (metric.IsDefrag && metric.DefragmentationScopedAlgorithmEnabled))
+            {
+                metricStdDevs_[currentIndex] = CalculateMetricStdDev(lbDomain, j, currentIndex);
+                changedMetrics_[currentIndex] = false;
+            }
+            else if (settings_.VerifyIncrementalScore)
+            {
+                double metricStdDev = CalculateMetricStdDev(lbDomain, j, currentIndex);
+                ASSERT_IFNOT(metricStdDev == metricStdDevs_[currentIndex],
+                    "Incremental score of metric {0} is {1}, recalculated score is {2}",
+                    metric.Name,
+                    metricStdDevs_[currentIndex],
+                    metricStdDev);
+            }
+
+            lbDomainScore += metricStdDevs_[currentIndex];
 
             currentIndex++;
         }
@@ -550,9 +572,30 @@ void Score::CalculateAvgStdDev()
         }
     }
 
+    allMetricsChanged_ = false;
     avgStdDev_ = avgStdDev;
 }
 
+void Score::SetMetricChanged(size_t totalMetricIndex)
+{
+    changedMetrics_[totalMetricIndex] = true;
+}
+
+double Score::CalculateMetricStdDev(LoadBalancingDomainEntry const& lbDomain, size_t metricIndex, size_t totalMetricIndex)
+{
+    auto& metric = lbDomain.Metrics[metricIndex];
+
+    return StdDevCaculationHelper(totalMetricIndex,
+        metric.IsDefrag,
+        metric.DefragmentationScopedAlgorithmEnabled,
+        metric.placementStrategy,
+        metric.DefragNodeCount,
+        metric.DefragmentationEmptyNodeWeight,
+        metric.DefragDistribution,
+        metric.DefragEmptyNodeLoadThreshold,
+        metric.Weight);
+}
+
 void Score::CalculateCost(double moveCost)
 {
     // TempSolution and candidate solution will keep track of the cost.
@@ -141,6 +141,11 @@ namespace Reliability
             void UpdateDynamicNodeLoads(DynamicNodeLoadSet* nodeLoadSet, int nodeIndex, int64 newNodeLoad, size_t totalMetricIndex);
 
             void CalculateAvgStdDev();
+
+            // Marks the metric so that its score is recalculated in the next Calculate
+            void SetMetricChanged(size_t totalMetricIndex);
+
+            double CalculateMetricStdDev(LoadBalancingDomainEntry const& lbDomain, size_t metricIndex, size_t totalMetricIndex);
             void CalculateCost(double moveCost);
             void CalculateEnergy();
 
@@ -172,6 +177,12 @@ namespace Reliability
             DomainAccTree upgradeDomainInitialLoads_;
             DynamicNodeLoadSet* dynamicNodeLoads_;
 
+            // Weighted standard deviation of every metric from the last Calculate.
+            // Only metrics whose loads changed since then (and scoped defrag metrics) are recalculated.
+            std::vector<double> metricStdDevs_;
+            std::vector<bool> changedMetrics_;
+            bool allMetricsChanged_;
+
             bool existDefragMetric_;
             bool existScopedDefragMetric_;
 
@@ -1401,6 +1401,11 @@ public:
     double initialEnergy_;
     size_t noChangeRound_;
     bool useRestrictedDefrag_;
+    bool previousBest_;
+    uint64 iterations_;
+    uint64 transitions_;
+    uint64 positiveTransitions_;
+    size_t successfulMoves_;
 
     SimulatedAnnealingSolution(CandidateSolution && solution, bool swapOnly, bool useNodeLoadAsHeuristic, int maxConstraintPriority, double temperature, bool useRestrictedDefrag)
         : solution_(std::move(solution)),
@@ -1412,7 +1417,12 @@ public:
         noBestRound_(0),
         initialEnergy_(0.0),
         noChangeRound_(0),
-        useRestrictedDefrag_(useRestrictedDefrag)
+        useRestrictedDefrag_(useRestrictedDefrag),
+        previousBest_(false),
+        iterations_(0),
+        transitions_(0),
+        positiveTransitions_(0),
+        successfulMoves_(0)
     {
     }
 
@@ -1426,7 +1436,12 @@ public:
         noBestRound_(other.noBestRound_),
         initialEnergy_(other.initialEnergy_),
         noChangeRound_(other.noChangeRound_),
-        useRestrictedDefrag_(other.useRestrictedDefrag_)
+        useRestrictedDefrag_(other.useRestrictedDefrag_),
+        previousBest_(other.previousBest_),
+        iterations_(other.iterations_),
+        transitions_(other.transitions_),
+        positiveTransitions_(other.positiveTransitions_),
+        successfulMoves_(other.successfulMoves_)
     {
     }
 
@@ -1444,12 +1459,59 @@ public:
             initialEnergy_ = other.initialEnergy_;
             noChangeRound_ = other.noChangeRound_;
             useRestrictedDefrag_ = other.useRestrictedDefrag_;
+            previousBest_ = other.previousBest_;
+            iterations_ = other.iterations_;
+            transitions_ = other.transitions_;
+            positiveTransitions_ = other.positiveTransitions_;
+            successfulMoves_ = other.successfulMoves_;
         }
 
         return *this;
     }
 };
 
+struct Searcher::SimulatedAnnealingBest
+{
+    double energy_;
+    size_t validMoveCount_;
+    vector<Movement> creations_;
+    vector<Movement> movements_;
+    size_t solutionIndex_;
+
+    explicit SimulatedAnnealingBest(CandidateSolution const& solution)
+        : energy_(solution.Energy),
+        validMoveCount_(solution.ValidMoveCount),
+        creations_(solution.Creations),
+        movements_(solution.Migrations),
+        solutionIndex_(SIZE_MAX)
+    {
+    }
+
+    bool IsImprovedBy(double energy, size_t validMoveCount) const
+    {
+        return energy < energy_ || (energy_ == energy && validMoveCount < validMoveCount_);
+    }
+
+    bool IsImprovedBy(CandidateSolution const& solution) const
+    {
+        return IsImprovedBy(solution.Energy, solution.ValidMoveCount);
+    }
+
+    bool IsImprovedBy(SimulatedAnnealingBest const& other) const
+    {
+        return IsImprovedBy(other.energy_, other.validMoveCount_);
+    }
+
+    void Update(CandidateSolution const& solution, size_t solutionIndex)
+    {
+        energy_ = solution.Energy;
+        validMoveCount_ = solution.ValidMoveCount;
+        creations_ = solution.Creations;
+        movements_ = solution.Migrations;
+        solutionIndex_ = solutionIndex;
+    }
+};
+
 CandidateSolution Searcher::SimulatedAnnealing(
     vector<SimulatedAnnealingSolution> && solutions,
     StopwatchTime endTime,
@@ -1461,43 +1523,35 @@ CandidateSolution Searcher::SimulatedAnnealing(
 {
     ASSERT_IF(solutions.empty(), "Empty solution list");
 
-    size_t bestSolutionIndex = SIZE_MAX;
-    vector<size_t> successfulTriesPerSolution(solutions.size(), 0);
-
     PLBConfig const& config = PLBConfig::GetConfig();
-    bool traceSAStat = config.TraceSimulatedAnnealingStatistics;
-    int statInterval = config.SimulatedAnnealingStatisticsInterval;
+    size_t parallelism = min(solutions.size(), static_cast<size_t>(max(config.SimulatedAnnealingParallelism, 1)));
+    size_t exchangeRounds = static_cast<size_t>(max(config.SimulatedAnnealingExchangeRounds, 1));
 
     vector<Guid> saIds = TraceSimulatedAnnealingStarted(solutions);
 
-    CandidateSolution const& solution = solutions[0].solution_;
-
-    double currentBestEnergy = solution.Energy;
-    size_t currentBestValidMoveCount = solution.ValidMoveCount;
-    vector<Movement> currentBestCreations(solution.Creations);
-    vector<Movement> currentBestMovements(solution.Migrations);
+    SimulatedAnnealingBest best(solutions[0].solution_);
 
     for (size_t solutionIndex = 1; solutionIndex < solutions.size(); ++solutionIndex)
     {
         CandidateSolution & currentSolution = solutions[solutionIndex].solution_;
-        if (currentSolution.Energy < currentBestEnergy || (currentBestEnergy == currentSolution.Energy && currentSolution.ValidMoveCount < currentBestValidMoveCount))
+        if (best.IsImprovedBy(currentSolution))
         {
-            currentBestEnergy = currentSolution.Energy;
-            currentBestValidMoveCount = currentSolution.ValidMoveCount;
-            currentBestCreations = currentSolution.Creations;
-            currentBestMovements = currentSolution.Migrations;
+            best.Update(currentSolution, SIZE_MAX);
         }
     }
 
-    StopwatchTime lastStartTime = Stopwatch::Now();
-
-    vector<bool> previousBest;
-    previousBest.resize(solutions.size(), false);
+    // Chains that run in parallel use their own random sequences, seeded from the searcher's sequence
+    vector<Random> randoms;
+    if (parallelism > 1)
+    {
+        randoms.reserve(solutions.size());
+        for (size_t solutionIndex = 0; solutionIndex < solutions.size(); ++solutionIndex)
+        {
+            randoms.push_back(Random(random_.Next()));
+        }
+    }
 
-    uint64 totalIterations = 0;
-    uint64 totalTransitions = 0;
-    uint64 totalPositiveTransitions = 0;
-    uint64 successfulMoves = 0;
+    StopwatchTime lastStartTime = Stopwatch::Now();
 
     for (uint64 round = 0; IsRunning(solutions) && !toStop_.load() && round < maxRound; ++round)
     {
@@ -1514,161 +1568,294 @@ CandidateSolution Searcher::SimulatedAnnealing(
             lastStartTime = now;
         }
 
-        for (size_t solutionIndex = 0; solutionIndex < solutions.size(); ++solutionIndex)
+        if (parallelism > 1)
         {
-            SimulatedAnnealingSolution & currentSASolution = solutions[solutionIndex];
-
-            if (!currentSASolution.running_)
-            {
-                continue;
-            }
-
-            successfulMoves = 0;
-            CandidateSolution & currentSolution = currentSASolution.solution_;
-            TempSolution tempSolution(currentSolution);
-
-            solutions[solutionIndex].initialEnergy_ = currentSolution.Energy;
-
-            double currentTemperature = currentSASolution.temperature_;
-            bool swapOnly = currentSASolution.swapOnly_;
-            bool useNodeLoadAsHeuristic = currentSASolution.useNodeLoadAsHeuristic_;
-            bool useRestrictedDefrag = currentSASolution.useRestrictedDefrag_;
-            int maxConstraintPriority = currentSASolution.maxConstraintPriority_;
+            RunSimulatedAnnealingRoundInParallel(
+                solutions,
+                parallelism,
+                round,
+                transitionPerRound,
+                temperatureDecayRatio,
+                noChangeRoundToExit,
+                diffEachRound,
+                saIds,
+                randoms,
+                best);
 
-            size_t countOfPositiveTrans = 0;
-            bool generateBest = false;
-            for (size_t transition = 0; transition < transitionPerRound; ++transition)
+            if ((round + 1) % exchangeRounds == 0)
             {
-                if (traceSAStat)
+                // Chains that stopped finding better solutions continue from the best one found by any chain
+                for (auto & currentSASolution : solutions)
                 {
-                    size_t currentTransition = transition + transitionPerRound * static_cast<size_t>(round);
-                    if (currentTransition % statInterval == 0 || previousBest[solutionIndex])
+                    CandidateSolution & currentSolution = currentSASolution.solution_;
+                    if (currentSASolution.running_ && currentSASolution.noBestRound_ >= exchangeRounds && best.energy_ < currentSolution.Energy)
                     {
-                        trace_.SimulatedAnnealingStatistics(saIds[solutionIndex], currentTransition, currentTemperature, currentSolution.AvgStdDev, currentSolution.Energy, currentBestEnergy);
+                        currentSolution = CandidateSolution(
+                            currentSolution.OriginalPlacement,
+                            vector<Movement>(best.creations_),
+                            vector<Movement>(best.movements_),
+                            currentSolution.CurrentSchedulerAction,
+                            move(currentSolution.SolutionSearchInsight));
+                        currentSASolution.noBestRound_ = 0;
+                        currentSASolution.noChangeRound_ = 0;
                     }
                 }
+            }
+        }
+        else
+        {
+            for (size_t solutionIndex = 0; solutionIndex < solutions.size(); ++solutionIndex)
+            {
+                if (solutions[solutionIndex].running_)
+                {
+                    RunSimulatedAnnealingRound(
+                        solutions[solutionIndex],
+                        solutionIndex,
+                        round,
+                        transitionPerRound,
+                        temperatureDecayRatio,
+                        noChangeRoundToExit,
+                        diffEachRound,
+                        saIds,
+                        random_,
+                        best);
+                }
+            }
+        }
+    }
 
-                previousBest[solutionIndex] = false;
+    uint64 totalIterations = 0;
+    uint64 totalTransitions = 0;
+    uint64 totalPositiveTransitions = 0;
+    vector<size_t> successfulTriesPerSolution;
+    for (auto const& currentSASolution : solutions)
+    {
+        totalIterations += currentSASolution.iterations_;
+        totalTransitions += currentSASolution.transitions_;
+        totalPositiveTransitions += currentSASolution.positiveTransitions_;
+        successfulTriesPerSolution.push_back(currentSASolution.successfulMoves_);
+    }
 
-                bool ret = checker_->MoveSolutionRandomly(tempSolution, swapOnly, useNodeLoadAsHeuristic, maxConstraintPriority, useRestrictedDefrag, random_);
-                if (ret && !tempSolution.IsEmpty)
-                {
-                    Score score = currentSolution.TryChange(tempSolution);
+    if (best.solutionIndex_ == SIZE_MAX)
+    {
+        trace_.Searcher(wformatString("Search of balancing completed with {0} total iterations and {1} total transitions and {2} positive transitions, no better solution found", totalIterations, totalTransitions, totalPositiveTransitions));
+    }
+    else
+    {
+        trace_.Searcher(wformatString("Search of balancing completed with {0} total iterations and {1} total transitions and {2} positive transitions, solution picked: {3}", totalIterations, totalTransitions, totalPositiveTransitions, best.solutionIndex_));
+    }
 
-                    if (score.Energy < currentSolution.Energy || (score.Energy == currentSolution.Energy && tempSolution.ValidMoveCount < currentSolution.ValidMoveCount))
-                    {
-                        currentSolution.ApplyChange(tempSolution, move(score));
-                        ++totalTransitions;
-                        if (currentSolution.Energy < currentBestEnergy || (currentBestEnergy == currentSolution.Energy && currentSolution.ValidMoveCount < currentBestValidMoveCount))
-                        {
-                            currentBestEnergy = currentSolution.Energy;
-                            currentBestValidMoveCount = currentSolution.ValidMoveCount;
-                            currentBestCreations = currentSolution.Creations;
-                            currentBestMovements = currentSolution.Migrations;
-                            generateBest = true;
-                            ++countOfPositiveTrans;
-                            previousBest[solutionIndex] = true;
-                            bestSolutionIndex = solutionIndex;
-                        }
-                    }
-                    else if (currentTemperature > 0)
-                    {
-                        double energyDiff = score.Energy - currentSolution.Energy; //energyDiff should be >=0
-                        double power = -energyDiff / currentTemperature;
+    stringstream successfulTries;
+    copy(successfulTriesPerSolution.begin(), successfulTriesPerSolution.end(), std::ostream_iterator<size_t>(successfulTries, "/"));
+    trace_.DetailedSimulatedAnnealingStatistic(solutions.size(), wformatString(successfulTries.str()));
 
-                        double pThreshold = random_.NextDouble();
-                        if (power > log(pThreshold))
-                        {
-                            currentSolution.ApplyChange(tempSolution, move(score));
-                            ++totalTransitions;
-                        }
-                        else
-                        {
-                            currentSolution.UndoChange(tempSolution);
-                        }
-                    }
-                    else
-                    {
-                        currentSolution.UndoChange(tempSolution);
-                    }
-                }
+    return CandidateSolution(
+        solutions[0].solution_.OriginalPlacement,
+        move(best.creations_),
+        move(best.movements_),
+        solutions[0].solution_.CurrentSchedulerAction,
+        move(solutions[0].solution_.SolutionSearchInsight));
+}
 
-                if (ret)
-                {
-                    ++successfulMoves;
-                }
-                tempSolution.Clear();
-                ++totalIterations;
-            }
-            
-            totalPositiveTransitions += countOfPositiveTrans;
-            successfulTriesPerSolution.at(solutionIndex) += successfulMoves;
+void Searcher::RunSimulatedAnnealingRound(
+    SimulatedAnnealingSolution & currentSASolution,
+    size_t solutionIndex,
+    uint64 round,
+    size_t transitionPerRound,
+    double temperatureDecayRatio,
+    size_t noChangeRoundToExit,
+    double diffEachRound,
+    vector<Guid> const& saIds,
+    Random & random,
+    SimulatedAnnealingBest & best)
+{
+    PLBConfig const& config = PLBConfig::GetConfig();
+    bool traceSAStat = config.TraceSimulatedAnnealingStatistics;
+    int statInterval = config.SimulatedAnnealingStatisticsInterval;
 
-            // check whether the running need to be continued
-            double diffThisRound = currentSolution.Energy == 0 ?
-                                    currentSASolution.initialEnergy_ :
-                                    abs(currentSolution.Energy - currentSASolution.initialEnergy_) / currentSolution.Energy;
+    size_t successfulMoves = 0;
+    CandidateSolution & currentSolution = currentSASolution.solution_;
+    TempSolution tempSolution(currentSolution);
 
-            if (diffThisRound < diffEachRound)
-            {
-                currentSASolution.noChangeRound_++;
-            }
-            else
+    currentSASolution.initialEnergy_ = currentSolution.Energy;
+
+    double currentTemperature = currentSASolution.temperature_;
+    bool swapOnly = currentSASolution.swapOnly_;
+    bool useNodeLoadAsHeuristic = currentSASolution.useNodeLoadAsHeuristic_;
+    bool useRestrictedDefrag = currentSASolution.useRestrictedDefrag_;
+    int maxConstraintPriority = currentSASolution.maxConstraintPriority_;
+
+    size_t countOfPositiveTrans = 0;
+    bool generateBest = false;
+    for (size_t transition = 0; transition < transitionPerRound; ++transition)
+    {
+        if (traceSAStat)
+        {
+            size_t currentTransition = transition + transitionPerRound * static_cast<size_t>(round);
+            if (currentTransition % statInterval == 0 || currentSASolution.previousBest_)
             {
-                currentSASolution.noChangeRound_ = 0;
+                trace_.SimulatedAnnealingStatistics(saIds[solutionIndex], currentTransition, currentTemperature, currentSolution.AvgStdDev, currentSolution.Energy, best.energy_);
             }
+        }
+
+        currentSASolution.previousBest_ = false;
+
+        bool ret = checker_->MoveSolutionRandomly(tempSolution, swapOnly, useNodeLoadAsHeuristic, maxConstraintPriority, useRestrictedDefrag, random);
+        if (ret && !tempSolution.IsEmpty)
+        {
+            Score score = currentSolution.TryChange(tempSolution);
 
-            if (!generateBest)
+            if (score.Energy < currentSolution.Energy || (score.Energy == currentSolution.Energy && tempSolution.ValidMoveCount < currentSolution.ValidMoveCount))
             {
-                currentSASolution.noBestRound_++;
+                currentSolution.ApplyChange(tempSolution, move(score));
+                ++currentSASolution.transitions_;
+                if (best.IsImprovedBy(currentSolution))
+                {
+                    best.Update(currentSolution, solutionIndex);
+                    generateBest = true;
+                    ++countOfPositiveTrans;
+                    currentSASolution.previousBest_ = true;
+                }
             }
-            else
+            else if (currentTemperature > 0)
             {
-                currentSASolution.noBestRound_ = 0;
-            }
+                double energyDiff = score.Energy - currentSolution.Energy; //energyDiff should be >=0
+                double power = -energyDiff / currentTemperature;
 
-            if (currentSASolution.noChangeRound_ >= noChangeRoundToExit)
-            {
-                if (currentSASolution.noBestRound_ >= noChangeRoundToExit)
+                double pThreshold = random.NextDouble();
+                if (power > log(pThreshold))
                 {
-                    currentSASolution.running_ = false;
+                    currentSolution.ApplyChange(tempSolution, move(score));
+                    ++currentSASolution.transitions_;
                 }
                 else
                 {
-                    currentSASolution.temperature_ = 0;
+                    currentSolution.UndoChange(tempSolution);
                 }
             }
             else
             {
-                // change the temperature for the next round
-                // if there are positive transitions, don't change the temperature
-                if (countOfPositiveTrans == 0)
-                {
-                    currentSASolution.temperature_ *= temperatureDecayRatio;
-                }
+                currentSolution.UndoChange(tempSolution);
             }
         }
+
+        if (ret)
+        {
+            ++successfulMoves;
+        }
+        tempSolution.Clear();
+        ++currentSASolution.iterations_;
     }
 
-    if (bestSolutionIndex == SIZE_MAX)
+    currentSASolution.positiveTransitions_ += countOfPositiveTrans;
+    currentSASolution.successfulMoves_ += successfulMoves;
+
+    // check whether the running need to be continued
+    double diffThisRound = currentSolution.Energy == 0 ?
+                            currentSASolution.initialEnergy_ :
+                            abs(currentSolution.Energy - currentSASolution.initialEnergy_) / currentSolution.Energy;
+
+    if (diffThisRound < diffEachRound)
     {
-        trace_.Searcher(wformatString("Search of balancing completed with {0} total iterations and {1} total transitions and {2} positive transitions, no better solution found", totalIterations, totalTransitions, totalPositiveTransitions));
+        currentSASolution.noChangeRound_++;
     }
     else
     {
-        trace_.Searcher(wformatString("Search of balancing completed with {0} total iterations and {1} total transitions and {2} positive transitions, solution picked: {3}", totalIterations, totalTransitions, totalPositiveTransitions, bestSolutionIndex));
+        currentSASolution.noChangeRound_ = 0;
     }
 
-    stringstream successfulTries;
-    copy(successfulTriesPerSolution.begin(), successfulTriesPerSolution.end(), std::ostream_iterator<size_t>(successfulTries, "/"));
-    trace_.DetailedSimulatedAnnealingStatistic(solutions.size(), wformatString(successfulTries.str()));
+    if (!generateBest)
+    {
+        currentSASolution.noBestRound_++;
+    }
+    else
+    {
+        currentSASolution.noBestRound_ = 0;
+    }
 
-    return CandidateSolution(
-        solutions[0].solution_.OriginalPlacement,
-        move(currentBestCreations),
-        move(currentBestMovements),
-        solutions[0].solution_.CurrentSchedulerAction,
-        move(solutions[0].solution_.SolutionSearchInsight));
+    if (currentSASolution.noChangeRound_ >= noChangeRoundToExit)
+    {
+        if (currentSASolution.noBestRound_ >= noChangeRoundToExit)
+        {
+            currentSASolution.running_ = false;
+        }
+        else
+        {
+            currentSASolution.temperature_ = 0;
+        }
+    }
+    else
+    {
+        // change the temperature for the next round
+        // if there are positive transitions, don't change the temperature
+        if (countOfPositiveTrans == 0)
+        {
+            currentSASolution.temperature_ *= temperatureDecayRatio;
+        }
+    }
+}
+
+void Searcher::RunSimulatedAnnealingRoundInParallel(
+    vector<SimulatedAnnealingSolution> & solutions,
+    size_t parallelism,
+    uint64 round,
+    size_t transitionPerRound,
+    double temperatureDecayRatio,
+    size_t noChangeRoundToExit,
+    double diffEachRound,
+    vector<Guid> const& saIds,
+    vector<Random> & randoms,
+    SimulatedAnnealingBest & best)
+{
+    // Each chain compares against the best solution known at the start of the round
+    vector<SimulatedAnnealingBest> chainBests(solutions.size(), best);
+
+    atomic_uint64 nextSolution(0);
+    atomic_uint64 pendingWorkers(parallelism);
+    ManualResetEvent workersCompleted(false);
+
+    auto worker = [&]()
+    {
+        for (uint64 solutionIndex = nextSolution++; solutionIndex < solutions.size(); solutionIndex = nextSolution++)
+        {
+            if (solutions[solutionIndex].running_)
+            {
+                RunSimulatedAnnealingRound(
+                    solutions[solutionIndex],
+                    static_cast<size_t>(solutionIndex),
+                    round,
+                    transitionPerRound,
+                    temperatureDecayRatio,
+                    noChangeRoundToExit,
+                    diffEachRound,
+                    saIds,
+                    randoms[solutionIndex],
+                    chainBests[solutionIndex]);
+            }
+        }
+
+        if (--pendingWorkers == 0)
+        {
+            workersCompleted.Set();
+        }
+    };
+
+    for (size_t i = 1; i < parallelism; ++i)
+    {
+        Threadpool::Post(worker);
+    }
+
+    worker();
+
+    workersCompleted.WaitOne();
+
+    for (size_t solutionIndex = 0; solutionIndex < chainBests.size(); ++solutionIndex)
+    {
+        if (best.IsImprovedBy(chainBests[solutionIndex]))
+        {
+            best = move(chainBests[solutionIndex]);
+        }
+    }
 }
 
 void Searcher::AddSimulatedAnnealingSolution(
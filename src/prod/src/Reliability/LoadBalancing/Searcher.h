@@ -187,6 +187,35 @@ namespace Reliability
                 size_t noChangeRoundToExit,
                 double diffEachRound);
 
+            struct SimulatedAnnealingBest;
+
+            // Runs one round of transitions of a single chain, updating best if the chain finds a better solution
+            void RunSimulatedAnnealingRound(
+                SimulatedAnnealingSolution & saSolution,
+                size_t solutionIndex,
+                uint64 round,
+                size_t transitionPerRound,
+                double temperatureDecayRatio,
+                size_t noChangeRoundToExit,
+                double diffEachRound,
+                std::vector<Common::Guid> const& saIds,
+                Common::Random & random,
+                SimulatedAnnealingBest & best);
+
+            // Runs one round of all running chains on up to parallelism threads, each chain with its own random sequence.
+            // The best solutions of the chains are merged in chain order, so the result does not depend on thread scheduling.
+            void RunSimulatedAnnealingRoundInParallel(
+                std::vector<SimulatedAnnealingSolution> & solutions,
+                size_t parallelism,
+                uint64 round,
+                size_t transitionPerRound,
+                double temperatureDecayRatio,
+                size_t noChangeRoundToExit,
+                double diffEachRound,
+                std::vector<Common::Guid> const& saIds,
+                std::vector<Common::Random> & randoms,
+                SimulatedAnnealingBest & best);
+
             static bool IsRunning(std::vector<SimulatedAnnealingSolution> const & solutions);
 
             // If metric is considered for balancing, useNodeLoadAsHeuristic will prefer swaps/moves from overloaded to underloaded nodes.
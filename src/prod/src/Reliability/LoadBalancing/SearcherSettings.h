@@ -54,6 +54,7 @@ namespace Reliability
                 AllowHigherChildTargetReplicaCountForAffinity = config.AllowHigherChildTargetReplicaCountForAffinity;
                 DummyPLBEnabled = config.DummyPLBEnabled;
                 IsTestMode = config.IsTestMode;
+                VerifyIncrementalScore = config.VerifyIncrementalScore;
                 NodeBufferPercentage = config.NodeBufferPercentage;
                 UseDefaultLoadForServiceOnEveryNode = config.UseDefaultLoadForServiceOnEveryNode;
                 PlacementHeuristicIncomingLoadFactor = config.PlacementHeuristicIncomingLoadFactor;
@@ -108,6 +109,7 @@ namespace Reliability
             bool AllowHigherChildTargetReplicaCountForAffinity;
             bool DummyPLBEnabled;
             bool IsTestMode;
+            bool VerifyIncrementalScore;
             PLBConfig::KeyDoubleValueMap NodeBufferPercentage;
             bool UpgradeDomainEnabled;
             bool FaultDomainEnabled;
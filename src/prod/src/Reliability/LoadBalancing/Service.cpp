@@ -204,6 +204,22 @@ int Service::GetCustomLoadIndex(std::wstring const& name) const
     return ret;
 }
 
+int Service::GetCustomLoadIndex(uint metricId) const
+{
+    int ret = -1;
+
+    for (size_t index = 0; index < serviceDesc_.Metrics.size(); ++index)
+    {
+        if (!serviceDesc_.Metrics[index].IsBuiltIn && serviceDesc_.Metrics[index].Id == metricId)
+        {
+            ret = static_cast<int>(index);
+            break;
+        }
+    }
+
+    return ret;
+}
+
 bool Service::ContainsMetric(std::wstring const& name) const
 {
     bool ret = false;
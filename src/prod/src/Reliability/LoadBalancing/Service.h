@@ -105,6 +105,7 @@ namespace Reliability
             uint GetDefaultMoveCost(ReplicaRole::Enum role) const;
 
             int GetCustomLoadIndex(std::wstring const& name) const;
+            int GetCustomLoadIndex(uint metricId) const;
 
             bool ContainsMetric(std::wstring const& name) const;
 
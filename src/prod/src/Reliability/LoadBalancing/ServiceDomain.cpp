@@ -24,6 +24,7 @@ ServiceDomain::ServiceDomain(DomainId && id, PlacementAndLoadBalancing const& pl
     plb_(plb),
     serviceTable_(),
     metricTable_(),
+    metricsById_(),
     failoverUnitTable_(),
     movePlan_(),
     scheduler_(
@@ -56,7 +57,12 @@ ServiceDomain::ServiceDomain(DomainId && id, PlacementAndLoadBalancing const& pl
     applicationLoadTable_(),
     reservationLoadTable_(),
     servicePackageReplicaCountPerNode_(),
-    partitionsInAppUpgrade_(0)
+    partitionsInAppUpgrade_(0),
+    snapshotVersion_(0),
+    lastSnapshot_(),
+    lastSnapshotVersion_(0),
+    lastSnapshotGeneration_(0),
+    lastSnapshotTime_(StopwatchTime::Zero)
 {
     if (plb_.applicationTable_.size() > 0)
     {
@@ -69,6 +75,7 @@ ServiceDomain::ServiceDomain(ServiceDomain && other)
     plb_(other.plb_),
     serviceTable_(move(other.serviceTable_)),
     metricTable_(move(other.metricTable_)),
+    metricsById_(move(other.metricsById_)),
     failoverUnitTable_(move(other.failoverUnitTable_)),
     movePlan_(move(other.movePlan_)),
     scheduler_(move(other.scheduler_)),
@@ -94,7 +101,12 @@ ServiceDomain::ServiceDomain(ServiceDomain && other)
     reservationLoadTable_(move(other.reservationLoadTable_)),
     applicationLoadTable_(move(other.applicationLoadTable_)),
     servicePackageReplicaCountPerNode_(move(other.servicePackageReplicaCountPerNode_)),
-    partitionsInAppUpgrade_(other.partitionsInAppUpgrade_)
+    partitionsInAppUpgrade_(other.partitionsInAppUpgrade_),
+    snapshotVersion_(other.snapshotVersion_),
+    lastSnapshot_(),
+    lastSnapshotVersion_(0),
+    lastSnapshotGeneration_(0),
+    lastSnapshotTime_(StopwatchTime::Zero)
 {
 }
 /// <summary>
@@ -104,6 +116,8 @@ ServiceDomain::ServiceDomain(ServiceDomain && other)
 /// <param name="incrementAppCount">if set to <c>true</c> [increment application count].</param>
 void ServiceDomain::AddMetric(std::wstring metricName,bool incrementAppCount)
 {
+    ++snapshotVersion_;
+
     auto metricIt = metricTable_.find(metricName);
     if (metricIt != metricTable_.end())
     {
@@ -120,6 +134,7 @@ void ServiceDomain::AddMetric(std::wstring metricName,bool incrementAppCount)
         domainMetric.ApplicationCount++;
     }
     metricTable_.insert(make_pair(metricName, move(domainMetric)));
+    UpdateMetricIndex();
 }
 /// <summary>
 /// Removes the metric, if it is not being referenced. Can also decrement Application count.
@@ -128,6 +143,8 @@ void ServiceDomain::AddMetric(std::wstring metricName,bool incrementAppCount)
 /// <param name="decrementAppCount">if set to <c>true</c> [decrement application count].</param>
 bool ServiceDomain::RemoveMetric(std::wstring metricName,bool decrementAppCount)
 {
+    ++snapshotVersion_;
+
     auto metricIt = metricTable_.find(metricName);
     if (metricIt == metricTable_.end())
     {
@@ -140,6 +157,7 @@ bool ServiceDomain::RemoveMetric(std::wstring metricName,bool decrementAppCount)
     if (metricIt->second.ApplicationCount == 0u && metricIt->second.ServiceCount == 0u)
     {
         metricTable_.erase(metricIt);
+        UpdateMetricIndex();
         return true;
     }
     return false;
@@ -161,6 +179,8 @@ bool ServiceDomain::CheckMetrics()
 
 void ServiceDomain::AddService(ServiceDescription && serviceDescription)
 {
+    ++snapshotVersion_;
+
     ASSERT_IF(serviceTable_.find(serviceDescription.ServiceId) != serviceTable_.end(), "Service {0} already exists", serviceDescription.Name);
 
     auto itInserted = serviceTable_.insert(make_pair(serviceDescription.ServiceId, Service(move(serviceDescription)))).first;
@@ -194,6 +214,8 @@ void ServiceDomain::AddService(ServiceDescription && serviceDescription)
             it->second.IncreaseServiceCount(itMetric->Weight, affectsBalancing);
         }
     }
+    UpdateMetricIndex();
+
     //should we trace this during a domain split?...
     plb_.Trace.UpdateService(itInserted->second.ServiceDesc.Name, itInserted->second.ServiceDesc);
     scheduler_.OnServiceChanged(Stopwatch::Now());
@@ -203,6 +225,8 @@ void ServiceDomain::AddService(ServiceDescription && serviceDescription)
 void ServiceDomain::DeleteService(uint64 serviceId, wstring const& serviceName, uint64 & applicationId, std::vector<wstring> & deletedMetrics,
     bool & depended, wstring & affinitizedService, bool assertFailoverUnitEmpty)
 {
+    ++snapshotVersion_;
+
     // returns the deleted metrics and whether the service is depended by any existing service
     // assume all failover units of this service are already deleted
     auto itService = serviceTable_.find(serviceId);
@@ -263,6 +287,7 @@ void ServiceDomain::DeleteService(uint64 serviceId, wstring const& serviceName,
 
         serviceTable_.erase(itService);
         depended = HasDependentService(serviceName);
+        UpdateMetricIndex();
     }
     else
     {
@@ -271,6 +296,7 @@ void ServiceDomain::DeleteService(uint64 serviceId, wstring const& serviceName,
             deletedMetrics.push_back(itMetric->first);
         }
         metricTable_.clear();
+        metricsById_.clear();
         serviceTable_.clear();
         if(assertFailoverUnitEmpty)
         {
@@ -318,6 +344,8 @@ bool ServiceDomain::HasDependedService(std::wstring const& dependentService) con
 
 void ServiceDomain::MergeDomain(ServiceDomain && other)
 {
+    ++snapshotVersion_;
+
     // exclusive lock acquired at upper level
 
     // assumes there is no overlap between the two domains
@@ -348,6 +376,7 @@ void ServiceDomain::MergeDomain(ServiceDomain && other)
             }
         }
     }
+    UpdateMetricIndex();
 
     for (auto it = other.failoverUnitTable_.begin(); it != other.failoverUnitTable_.end(); ++it)
     {
@@ -475,6 +504,8 @@ void ServiceDomain::MergeDomain(ServiceDomain && other)
 
 void ServiceDomain::AddFailoverUnit(FailoverUnit && failoverUnitToAdd, StopwatchTime timeStamp)
 {
+    ++snapshotVersion_;
+
     Common::Guid fuId = failoverUnitToAdd.FuDescription.FUId;
     Service & service = GetService(failoverUnitToAdd.FuDescription.ServiceId);
 
@@ -512,6 +543,8 @@ void ServiceDomain::AddFailoverUnit(FailoverUnit && failoverUnitToAdd, Stopwatch
 
 bool ServiceDomain::UpdateFailoverUnit(FailoverUnitDescription && failoverUnitDescription, StopwatchTime timeStamp, bool traceDetail)
 {
+    ++snapshotVersion_;
+
     bool ret = false;
     Common::Guid fuId = failoverUnitDescription.FUId;
     Service & service = GetService(failoverUnitDescription.ServiceId);
@@ -658,6 +691,8 @@ bool ServiceDomain::UpdateFailoverUnit(FailoverUnitDescription && failoverUnitDe
 
 void ServiceDomain::UpdateFailoverUnitWithMoves(FailoverUnitMovement const& movement)
 {
+    ++snapshotVersion_;
+
     auto itFailoverUnit = failoverUnitTable_.find(movement.FailoverUnitId);
 
     if (itFailoverUnit != failoverUnitTable_.end())
@@ -682,6 +717,8 @@ void ServiceDomain::UpdateFailoverUnitWithMoves(FailoverUnitMovement const& move
 
 void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMoveCost, StopwatchTime timeStamp)
 {
+    ++snapshotVersion_;
+
     bool isReset = loadOrMoveCost.IsReset;
 
     size_t updatedMetricCount = 0;
@@ -721,7 +758,8 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
         // Update the primary entries
         for (auto it = loadOrMoveCost.PrimaryEntries.begin(); it != loadOrMoveCost.PrimaryEntries.end(); ++it)
         {
-            if (it->Name == *Constants::MoveCostMetricName)
+            uint metricId = GetReportedMetricId(*it);
+            if (metricId == MetricIdTable::MoveCostId)
             {
                 if (itFailoverUnit->second.UpdateMoveCost(ReplicaRole::Primary, it->Value))
                 {
@@ -733,7 +771,7 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
                     plb_.Trace.IgnoreInvalidMoveCost(fuId, ReplicaRole::ToString(ReplicaRole::Primary), it->Value);
                 }
             }
-			else if (it->Name == *ServiceModel::Constants::SystemMetricNameCpuCores || it->Name == *ServiceModel::Constants::SystemMetricNameMemoryInMB)
+			else if (metricId == MetricIdTable::CpuCoresId || metricId == MetricIdTable::MemoryInMBId)
 			{
 				if (itFailoverUnit->second.UpdateResourceLoad(it->Name, it->Value, (failoverUnit.FuDescription.PrimaryReplica)->NodeId))
 				{
@@ -742,7 +780,7 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
 			}
             else
             {
-                int index = service.GetCustomLoadIndex(it->Name);
+                int index = service.GetCustomLoadIndex(metricId);
                 if (index < 0)
                 {
                     plb_.Trace.IgnoreLoadInvalidMetric(fuId, ReplicaRole::ToString(ReplicaRole::Primary), it->Name, it->Value);
@@ -771,7 +809,8 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
         // Replica should use default load if they didn't do reportload
         for (auto it = loadOrMoveCost.SecondaryEntries.begin(); it != loadOrMoveCost.SecondaryEntries.end(); ++it)
         {
-            if (it->Name == *Constants::MoveCostMetricName)
+            uint metricId = GetReportedMetricId(*it);
+            if (metricId == MetricIdTable::MoveCostId)
             {
                 if (itFailoverUnit->second.UpdateMoveCost(ReplicaRole::Secondary, it->Value))
                 {
@@ -785,7 +824,7 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
             }
             else
             {
-                int index = service.GetCustomLoadIndex(it->Name);
+                int index = service.GetCustomLoadIndex(metricId);
                 if (index < 0)
                 {
                     plb_.Trace.IgnoreLoadInvalidMetric(fuId, ReplicaRole::ToString(ReplicaRole::Secondary), it->Name, it->Value);
@@ -804,7 +843,8 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
         // Empty load update indicate it is a load reset
         for (auto it = loadOrMoveCost.SecondaryEntries.begin(); it != loadOrMoveCost.SecondaryEntries.end(); ++it)
         {
-            int index = service.GetCustomLoadIndex(it->Name);
+            uint metricId = GetReportedMetricId(*it);
+            int index = service.GetCustomLoadIndex(metricId);
             if (index < 0)
             {
                 plb_.Trace.IgnoreLoadInvalidMetric(fuId, ReplicaRole::ToString(ReplicaRole::Secondary), it->Name, it->Value);
@@ -822,7 +862,8 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
         {
             for (auto it = mapIt->second.begin(); it != mapIt->second.end(); ++it)
             {
-                if (it->Name == *Constants::MoveCostMetricName)
+                uint metricId = GetReportedMetricId(*it);
+                if (metricId == MetricIdTable::MoveCostId)
                 {
                     if (itFailoverUnit->second.UpdateMoveCost(ReplicaRole::Secondary, it->Value))
                     {
@@ -834,7 +875,7 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
                         plb_.Trace.IgnoreInvalidMoveCost(fuId, ReplicaRole::ToString(ReplicaRole::Secondary), it->Value);
                     }
                 }
-				else if (it->Name == *ServiceModel::Constants::SystemMetricNameCpuCores || it->Name == *ServiceModel::Constants::SystemMetricNameMemoryInMB)
+				else if (metricId == MetricIdTable::CpuCoresId || metricId == MetricIdTable::MemoryInMBId)
 				{
 					if (itFailoverUnit->second.UpdateResourceLoad(it->Name, it->Value, mapIt->first))
 					{
@@ -843,7 +884,7 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
 				}
                 else
                 {
-                    int index = service.GetCustomLoadIndex(it->Name);
+                    int index = service.GetCustomLoadIndex(metricId);
                     if (index < 0)
                     {
                         plb_.Trace.IgnoreLoadInvalidMetricOnNode(fuId, ReplicaRole::ToString(ReplicaRole::Secondary), it->Name, it->Value, mapIt->first);
@@ -878,6 +919,8 @@ void ServiceDomain::UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMove
 
 void ServiceDomain::SetMovementEnabled(bool constraintCheckEnabled, bool balancingEnabled, bool isDummyPLB, StopwatchTime timeStamp)
 {
+    ++snapshotVersion_;
+
     scheduler_.SetConstraintCheckEnabled(constraintCheckEnabled, timeStamp);
     if (!isDummyPLB)
     {
@@ -1233,6 +1276,8 @@ int ServiceDomain::CompareNodeForPromotion(Guid fuId, Node const& node1, Node co
 
 void ServiceDomain::OnNodeUp(uint64 node, StopwatchTime timeStamp)
 {
+    ++snapshotVersion_;
+
     // exclusive lock acquired at upper level
 
     changedNodes_.insert(node);
@@ -1243,6 +1288,8 @@ void ServiceDomain::OnNodeUp(uint64 node, StopwatchTime timeStamp)
 
 void ServiceDomain::OnNodeDown(uint64 node, StopwatchTime timeStamp)
 {
+    ++snapshotVersion_;
+
     // exclusive lock acquired at upper level
 
     changedNodes_.insert(node);
@@ -1253,6 +1300,8 @@ void ServiceDomain::OnNodeDown(uint64 node, StopwatchTime timeStamp)
 
 void ServiceDomain::OnNodeChanged(uint64 node, StopwatchTime timeStamp)
 {
+    ++snapshotVersion_;
+
     // exclusive lock acquired at upper level
 
     changedNodes_.insert(node);
@@ -1263,6 +1312,8 @@ void ServiceDomain::OnNodeChanged(uint64 node, StopwatchTime timeStamp)
 
 void ServiceDomain::OnServiceTypeChanged(std::wstring const& serviceTypeName)
 {
+    ++snapshotVersion_;
+
     // exclusive lock acquired at upper level
 
     changedServiceTypes_.insert(serviceTypeName);
@@ -1273,6 +1324,8 @@ void ServiceDomain::OnServiceTypeChanged(std::wstring const& serviceTypeName)
 
 void ServiceDomain::UpdateFailoverUnitWithCreationMoves(vector<Common::Guid> & partitionsWithCreations)
 {
+    ++snapshotVersion_;
+
     if (!partitionsWithCreations.empty() && (scheduler_.CurrentAction.IsCreation() || scheduler_.CurrentAction.IsCreationWithMove()))
     {
         for (auto it = partitionsWithCreations.begin(); it != partitionsWithCreations.end(); ++it)
@@ -1291,6 +1344,8 @@ void ServiceDomain::UpdateFailoverUnitWithCreationMoves(vector<Common::Guid> & p
 
 void ServiceDomain::OnMovementGenerated(StopwatchTime timeStamp, Common::Guid decisionGuid, double newAvgStdDev, FailoverUnitMovementTable && movementList)
 {
+    ++snapshotVersion_;
+
     bool isCreation = (scheduler_.CurrentAction.Action == PLBSchedulerActionType::Creation ||
         scheduler_.CurrentAction.Action == PLBSchedulerActionType::CreationWithMove);
 
@@ -1352,8 +1407,23 @@ FailoverUnitMovementTable ServiceDomain::GetMovements(StopwatchTime now)
     return movePlan_.GetMovements(now);
 }
 
-ServiceDomain::DomainData ServiceDomain::TakeSnapshot(PLBDiagnosticsSPtr const& plbDiagnosticsSPtr)
+ServiceDomain::DomainDataSPtr ServiceDomain::TakeSnapshot(PLBDiagnosticsSPtr const& plbDiagnosticsSPtr, uint64 plbSnapshotGeneration, StopwatchTime now)
 {
+    PLBConfig const& config = PLBConfig::GetConfig();
+    PLBSchedulerAction const& currentAction = scheduler_.CurrentAction;
+
+    if (config.IncrementalSnapshotEnabled &&
+        lastSnapshot_ &&
+        lastSnapshotVersion_ == snapshotVersion_ &&
+        lastSnapshotGeneration_ == plbSnapshotGeneration &&
+        lastSnapshot_->action_.Action == currentAction.Action &&
+        lastSnapshot_->action_.IsSkip == currentAction.IsSkip &&
+        lastSnapshot_->action_.IsConstraintCheckLight == currentAction.IsConstraintCheckLight &&
+        now - lastSnapshotTime_ < config.IncrementalSnapshotMaxAge)
+    {
+        return lastSnapshot_;
+    }
+
     // No partitions or replicas are neeeded for most of the queries.
     // If we need full information in snapshot it is enough to call IsConstraintSatisfied() to populate it.
     PartitionClosureType::Enum closureType = PartitionClosureType::None;
@@ -1361,7 +1431,21 @@ ServiceDomain::DomainData ServiceDomain::TakeSnapshot(PLBDiagnosticsSPtr const&
     SystemState systemState(*this, plb_.Trace, plbDiagnosticsSPtr);
     systemState.CreatePlacementAndChecker(closureType);
 
-    return DomainData(DomainId(domainId_), scheduler_.CurrentAction, move(systemState), FailoverUnitMovementTable());
+    DomainDataSPtr snapshot = make_shared<DomainData>(DomainId(domainId_), currentAction, move(systemState), FailoverUnitMovementTable());
+
+    if (config.IncrementalSnapshotEnabled)
+    {
+        lastSnapshot_ = snapshot;
+        lastSnapshotVersion_ = snapshotVersion_;
+        lastSnapshotGeneration_ = plbSnapshotGeneration;
+        lastSnapshotTime_ = now;
+    }
+    else
+    {
+        lastSnapshot_ = nullptr;
+    }
+
+    return snapshot;
 }
 
 void ServiceDomain::TraceNodeLoads(StopwatchTime const& now)
@@ -1421,6 +1505,11 @@ ServiceDomain::DomainData ServiceDomain::RefreshStates(StopwatchTime now, PLBDia
         }
     }
 
+    if (!changedNodes_.empty() || !changedServiceTypes_.empty() || !changedServices_.empty())
+    {
+        ++snapshotVersion_;
+    }
+
     changedNodes_.clear();
     changedServiceTypes_.clear();
     changedServices_.clear();
@@ -1541,17 +1630,19 @@ void ServiceDomain::UpdateContraintCheckClosure(set<Guid> && partitions)
 
 void ServiceDomain::UpdateReservationsServicesNoMetric(
     uint64 appId,
-    std::set<std::wstring> &checkedMetrics,
+    std::vector<bool> const& checkedMetrics,
     vector<ReplicaDescription> const& replicas,
     bool isAdd,
     bool decrementNodeCounts)
 {
-    auto const& appCapacities = plb_.GetApplication(appId).ApplicationDesc.AppCapacities;
-    for (auto itCapacity = appCapacities.begin(); itCapacity != appCapacities.end(); itCapacity++)
+    Application const& application = plb_.GetApplication(appId);
+    auto const& appCapacities = application.ApplicationDesc.AppCapacities;
+    auto itCapacityId = application.CapacityMetricIds.begin();
+    for (auto itCapacity = appCapacities.begin(); itCapacity != appCapacities.end(); itCapacity++, itCapacityId++)
     {
         // for metrics which aren't checked
         wstring metricName = itCapacity->first;
-        if (checkedMetrics.find(metricName) == checkedMetrics.end())
+        if (*itCapacityId >= checkedMetrics.size() || !checkedMetrics[*itCapacityId])
         {
             int64 reservationCapacity = 0;
             auto const& appCapacityIt = appCapacities.find(metricName);
@@ -1601,6 +1692,36 @@ void ServiceDomain::UpdateReservationsServicesNoMetric(
     }
 }
 
+void ServiceDomain::UpdateMetricIndex()
+{
+    metricsById_.clear();
+
+    for (auto it = metricTable_.begin(); it != metricTable_.end(); ++it)
+    {
+        uint metricId = MetricIdTable::GetTable().GetId(it->first);
+        if (metricId >= metricsById_.size())
+        {
+            metricsById_.resize(metricId + 1, nullptr);
+        }
+
+        metricsById_[metricId] = &(it->second);
+    }
+}
+
+uint ServiceDomain::GetReportedMetricId(LoadMetricStats const& entry)
+{
+    return entry.MetricId != MetricIdTable::InvalidId ? entry.MetricId : MetricIdTable::GetTable().FindId(entry.Name);
+}
+
+ServiceDomainMetric & ServiceDomain::GetDomainMetric(ServiceMetric const& metric)
+{
+    uint metricId = metric.Id;
+    ASSERT_IF(metricId >= metricsById_.size() || metricsById_[metricId] == nullptr,
+        "Metric {0} doesn't exist in a domain", metric.Name);
+
+    return *(metricsById_[metricId]);
+}
+
 inline void ServiceDomain::AddNodeLoad(Service const& service, FailoverUnit const& failoverUnit, vector<ReplicaDescription> const& replicas, bool isLoadOrMoveCostChange)
 {
     vector<ServiceMetric> const& metrics = service.ServiceDesc.Metrics;
@@ -1608,7 +1729,7 @@ inline void ServiceDomain::AddNodeLoad(Service const& service, FailoverUnit cons
         failoverUnit.SecondaryEntries.size(), "Metric sizes don't match");
 
     uint64 appId = service.ServiceDesc.ApplicationId;
-    std::set<std::wstring> checkedMetrics;
+    std::vector<bool> checkedMetrics(metricsById_.size(), false);
     std::map<uint64, std::vector<Federation::NodeId>> removeShouldDisappearServicePackageLoad;
 
     Application const* app = plb_.GetApplicationPtrCallerHoldsLock(appId);
@@ -1622,11 +1743,9 @@ inline void ServiceDomain::AddNodeLoad(Service const& service, FailoverUnit cons
     {
         auto & metric = metrics[metricIndex];
         wstring const& metricName = metric.Name;
-        auto itServiceDomainMetric = metricTable_.find(metricName);
-        ASSERT_IF(itServiceDomainMetric == metricTable_.end(),
-            "Metric {0} doesn't exist in a domain", service.ServiceDesc.Metrics[metricIndex].Name);
+        ServiceDomainMetric & domainMetric = GetDomainMetric(metric);
 
-        checkedMetrics.insert(metricName);
+        checkedMetrics[metric.Id] = true;
 
         int64 partitionLoad(0);
         int64 shouldDisappearDecrease(0);
@@ -1686,7 +1805,7 @@ inline void ServiceDomain::AddNodeLoad(Service const& service, FailoverUnit cons
 
             if (replicaLoad > 0)
             {
-                itServiceDomainMetric->second.AddLoad(
+                domainMetric.AddLoad(
                     itReplica->NodeId,
                     replicaLoad,
                     itReplica->ShouldDisappear);
@@ -1695,7 +1814,7 @@ inline void ServiceDomain::AddNodeLoad(Service const& service, FailoverUnit cons
             //remove should disappear load from the node
             if (shouldDisappearLoadChange > 0)
             {
-                itServiceDomainMetric->second.DeleteLoad(
+                domainMetric.DeleteLoad(
                     itReplica->NodeId,
                     shouldDisappearLoadChange,
                     true);
@@ -1827,17 +1946,15 @@ inline void ServiceDomain::DeleteNodeLoad(Service const& service, FailoverUnit c
         failoverUnit.SecondaryEntries.size(), "Metric sizes don't match");
 
     uint64 appId = service.ServiceDesc.ApplicationId;
-    std::set<std::wstring> checkedMetrics;
+    std::vector<bool> checkedMetrics(metricsById_.size(), false);
 
     for (size_t metricIndex = 0; metricIndex < metrics.size(); ++metricIndex)
     {
         auto & metric = metrics[metricIndex];
         wstring const& metricName = metric.Name;
-        auto itServiceDomainMetric = metricTable_.find(metricName);
-        ASSERT_IF(itServiceDomainMetric == metricTable_.end(),
-            "Metric {0} doesn't exist in a domain", service.ServiceDesc.Metrics[metricIndex].Name);
+        ServiceDomainMetric & domainMetric = GetDomainMetric(metric);
 
-        checkedMetrics.insert(metricName);
+        checkedMetrics[metric.Id] = true;
 
         int64 partitionLoad(0);
         int64 shouldDisappearIncrease(0);
@@ -1898,7 +2015,7 @@ inline void ServiceDomain::DeleteNodeLoad(Service const& service, FailoverUnit c
 
             if (replicaLoad > 0)
             {
-                itServiceDomainMetric->second.DeleteLoad(
+                domainMetric.DeleteLoad(
                     itReplica->NodeId,
                     replicaLoad,
                     itReplica->ShouldDisappear);
@@ -1906,7 +2023,7 @@ inline void ServiceDomain::DeleteNodeLoad(Service const& service, FailoverUnit c
 
             if (shouldDisappearLoadChange > 0)
             {
-                itServiceDomainMetric->second.AddLoad(
+                domainMetric.AddLoad(
                     itReplica->NodeId,
                     shouldDisappearLoadChange,
                     true);
@@ -99,6 +99,8 @@ namespace Reliability
                 Common::StopwatchTime interruptTime_;
             };
 
+            typedef std::shared_ptr<DomainData> DomainDataSPtr;
+
 
             ServiceDomain(DomainId && id, PlacementAndLoadBalancing const& plb);
 
@@ -158,7 +160,7 @@ namespace Reliability
             void AddFailoverUnit(FailoverUnit && failoverUnitToAdd, Common::StopwatchTime timeStamp);
             bool UpdateFailoverUnit(FailoverUnitDescription && failoverUnitDescription, Common::StopwatchTime timeStamp, bool traceDetail = true);
             void UpdateLoadOrMoveCost(LoadOrMoveCostDescription && loadOrMoveCost, Common::StopwatchTime timeStamp);
-            void RemoveFailoverUnit(Common::Guid fuId) { failoverUnitTable_.erase(fuId); }
+            void RemoveFailoverUnit(Common::Guid fuId) { failoverUnitTable_.erase(fuId); ++snapshotVersion_; }
 
             void UpdateFailoverUnitWithMoves(FailoverUnitMovement const& movement);
 
@@ -189,7 +191,9 @@ namespace Reliability
 
             FailoverUnitMovementTable GetMovements(Common::StopwatchTime now);
 
-            DomainData TakeSnapshot(PLBDiagnosticsSPtr const& plbDiagnosticsSPtr);
+            // Returns the previous snapshot if neither the domain (snapshotVersion_) nor the PLB-wide state
+            // (plbSnapshotGeneration) changed since it was taken; otherwise takes a new one.
+            DomainDataSPtr TakeSnapshot(PLBDiagnosticsSPtr const& plbDiagnosticsSPtr, uint64 plbSnapshotGeneration, Common::StopwatchTime now);
 
             DomainData RefreshStates(Common::StopwatchTime now, PLBDiagnosticsSPtr const& plbDiagnosticsSPtr);
 
@@ -212,7 +216,7 @@ namespace Reliability
             // The amount of time until next action is required for this service domain
             Common::TimeSpan GetNextActionInterval(Common::StopwatchTime now) { return scheduler_.GetNextRefreshInterval(now); }
 
-            void UpdateDomainId(DomainId const& Id) { domainId_ = Id; }
+            void UpdateDomainId(DomainId const& Id) { domainId_ = Id; ++snapshotVersion_; }
             void CheckAndUpdateAppPartitions(uint64 applicationId);
             void AddAppPartitionsToPartialClosure(uint64 applicationId);
 
@@ -268,6 +272,14 @@ namespace Reliability
 
             void UpdatePendingLoadsOrMoveCosts();
 
+            // Rebuilds metricsById_, must be called after every change of metricTable_
+            void UpdateMetricIndex();
+
+            ServiceDomainMetric & GetDomainMetric(ServiceMetric const& metric);
+
+            // Id resolved by the API layer; only entries that were unknown at report time are looked up again
+            static uint GetReportedMetricId(LoadMetricStats const& entry);
+
             void ComputeServiceBlockList(Service & service) const;
 
             bool IsServiceBlockNode(NodeDescription const& nodeDescription, Common::Expression & constraintExpression, std::wstring const& placementConstraints, bool forPrimary = false, bool traceDetail = true) const;
@@ -322,8 +334,9 @@ namespace Reliability
 
             ReservationLoad & GetReservationLoad(std::wstring const& metricName);
 
+            // checkedMetrics is indexed by metric id and is true for the metrics of the service
             void UpdateReservationsServicesNoMetric(uint64 appId,
-                std::set<std::wstring>& checkedMetrics,
+                std::vector<bool> const& checkedMetrics,
                 vector<ReplicaDescription> const& replicas,
                 bool isAdd,
                 bool decrementNodeCounts);
@@ -336,6 +349,10 @@ namespace Reliability
 
             std::map<std::wstring, ServiceDomainMetric> metricTable_;
 
+            // Entries of metricTable_ indexed by interned metric id (see MetricIdTable), nullptr for metrics not in this domain.
+            // Map nodes are stable, so the pointers stay valid until the metric is erased from metricTable_.
+            std::vector<ServiceDomainMetric*> metricsById_;
+
             // ApplicationName -> MetricName -> Loads!
             std::map<std::wstring, std::map<std::wstring, ServiceDomainMetric>> applicationMetricTable_;
 
@@ -410,6 +427,16 @@ namespace Reliability
             DynamicBitSet lastEvaluatedOverallBlocklist_;
             bool lastEvaluatedPartialPlacement_;
             Service::Type::Enum lastEvaluatedFDDistributionPolicy_;
+
+            // Incremented on failover unit, load and movement changes of this domain.
+            // Changes that go through PLB-wide updates (nodes, services, applications...) are tracked by PLB itself.
+            uint64 snapshotVersion_;
+
+            // Last snapshot of this domain, reused by TakeSnapshot while nothing changes
+            DomainDataSPtr lastSnapshot_;
+            uint64 lastSnapshotVersion_;
+            uint64 lastSnapshotGeneration_;
+            Common::StopwatchTime lastSnapshotTime_;
         };
     }
 }
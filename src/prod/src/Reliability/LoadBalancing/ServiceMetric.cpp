@@ -18,6 +18,7 @@ GlobalWString ServiceMetric::CountName = make_global<wstring>(L"Count");
 
 ServiceMetric::ServiceMetric(wstring && name, double weight, uint primaryDefaultLoad, uint secondaryDefaultLoad, bool isRGMetric)
     : name_(move(name)), 
+      metricId_(MetricIdTable::GetTable().GetId(name_)),
       builtInType_(ParseName(name_)), 
       weight_(weight), 
       primaryDefaultLoad_(primaryDefaultLoad), 
@@ -31,6 +32,7 @@ ServiceMetric::ServiceMetric(wstring && name, double weight, uint primaryDefault
 
 ServiceMetric::ServiceMetric(ServiceMetric const & other)
     : name_(other.name_), 
+    metricId_(other.metricId_),
     builtInType_(other.builtInType_), 
     weight_(other.weight_), 
     primaryDefaultLoad_(other.primaryDefaultLoad_),
@@ -41,6 +43,7 @@ ServiceMetric::ServiceMetric(ServiceMetric const & other)
 
 ServiceMetric::ServiceMetric(ServiceMetric && other)
     : name_(move(other.name_)), 
+      metricId_(other.metricId_),
       builtInType_(other.builtInType_), 
       weight_(other.weight_), 
       primaryDefaultLoad_(other.primaryDefaultLoad_),
@@ -54,6 +57,7 @@ ServiceMetric & ServiceMetric::operator = (ServiceMetric && other)
     if (this != &other)
     {
         name_ = move(other.name_);
+        metricId_ = other.metricId_;
         builtInType_ = other.builtInType_;
         weight_ = other.weight_;
         primaryDefaultLoad_ = other.primaryDefaultLoad_;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Constants.h"
+#include "MetricIdTable.h"
 
 namespace Reliability
 {
@@ -45,6 +46,10 @@ namespace Reliability
             __declspec (property(get=get_Name)) std::wstring const& Name;
             std::wstring const& get_Name() const { return name_; }
 
+            // Interned id of the metric name (see MetricIdTable)
+            __declspec (property(get=get_Id)) uint Id;
+            uint get_Id() const { return metricId_; }
+
             __declspec (property(get=get_IsPrimaryCount)) bool IsPrimaryCount;
             bool get_IsPrimaryCount() const { return builtInType_ == PrimaryCount; }
 
@@ -91,6 +96,7 @@ namespace Reliability
             static BuiltInType ParseName(std::wstring const& name);
 
             std::wstring name_;
+            uint metricId_;
             BuiltInType builtInType_;
             double weight_;
             uint primaryDefaultLoad_;
@@ -19,10 +19,10 @@ namespace Reliability
         public:
             Snapshot();
             Snapshot(Snapshot && other);
-            Snapshot(std::map<std::wstring, ServiceDomain::DomainData> && serviceDomainSnapshot);
+            Snapshot(std::map<std::wstring, ServiceDomain::DomainDataSPtr> && serviceDomainSnapshot);
 
-            __declspec (property(get=get_ServiceDomainSnapshot)) std::map<std::wstring, ServiceDomain::DomainData> const& ServiceDomainSnapshot;
-            std::map<std::wstring, ServiceDomain::DomainData> const & get_ServiceDomainSnapshot() const { return serviceDomainSnapshot_; }
+            __declspec (property(get=get_ServiceDomainSnapshot)) std::map<std::wstring, ServiceDomain::DomainDataSPtr> const& ServiceDomainSnapshot;
+            std::map<std::wstring, ServiceDomain::DomainDataSPtr> const & get_ServiceDomainSnapshot() const { return serviceDomainSnapshot_; }
 
             __declspec (property(get=get_CreatedTimeUtc)) Common::DateTime CreatedTimeUtc;
             Common::DateTime get_CreatedTimeUtc() const { return createdTimeUtc_; }
@@ -30,12 +30,9 @@ namespace Reliability
             ServiceDomain::DomainData const* GetRGDomainData() const;
             void SetRGDomain(std::wstring const& rgDomain) { rgDomainId_ = rgDomain; }
 
-            // Used for populating the snapshot with all partitions and replicas for a given domain
-            void GetFullSnapshot(std::wstring domainId);
-
         private:
             Common::DateTime createdTimeUtc_;
-            std::map<std::wstring, ServiceDomain::DomainData> serviceDomainSnapshot_;
+            std::map<std::wstring, ServiceDomain::DomainDataSPtr> serviceDomainSnapshot_;
             std::wstring rgDomainId_;
         };
     }
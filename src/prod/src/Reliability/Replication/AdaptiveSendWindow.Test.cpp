@@ -0,0 +1,139 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace ReplicationUnitTest
+{
+    using namespace Common;
+    using namespace std;
+    using namespace Reliability::ReplicationComponent;
+
+    static StringLiteral const PublicTestSource("TESTAdaptiveSendWindow");
+
+    class TestAdaptiveSendWindow
+    {
+    protected:
+        TestAdaptiveSendWindow() { BOOST_REQUIRE(Setup()); }
+        TEST_CLASS_SETUP(Setup)
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(TestAdaptiveSendWindowSuite, TestAdaptiveSendWindow)
+
+    BOOST_AUTO_TEST_CASE(SlowStartGrowsByAckedCount)
+    {
+        AdaptiveSendWindow window(4, 32, TimeSpan::Zero);
+        StopwatchTime now = Stopwatch::Now();
+
+        VERIFY_IS_FALSE(window.OnAck(4, TimeSpan::FromMilliseconds(10), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(8));
+        VERIFY_IS_FALSE(window.OnAck(8, TimeSpan::FromMilliseconds(10), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(16));
+        VERIFY_IS_FALSE(window.OnAck(16, TimeSpan::FromMilliseconds(10), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(32));
+        VERIFY_IS_FALSE(window.OnAck(32, TimeSpan::FromMilliseconds(10), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(32));
+    }
+
+    BOOST_AUTO_TEST_CASE(LatencyIncreaseReducesOncePerWindow)
+    {
+        AdaptiveSendWindow window(16, 64, TimeSpan::Zero);
+        StopwatchTime now = Stopwatch::Now();
+
+        VERIFY_IS_FALSE(window.OnAck(16, TimeSpan::FromMilliseconds(10), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(32));
+
+        VERIFY_IS_TRUE(window.OnAck(32, TimeSpan::FromMilliseconds(50), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(22));
+
+        // Still high latency, but not a full window ACKed since the reduction
+        VERIFY_IS_FALSE(window.OnAck(1, TimeSpan::FromMilliseconds(50), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(22));
+
+        VERIFY_IS_TRUE(window.OnAck(22, TimeSpan::FromMilliseconds(50), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(15));
+    }
+
+    BOOST_AUTO_TEST_CASE(LatencyWithinSlackDoesNotReduce)
+    {
+        AdaptiveSendWindow window(16, 64, TimeSpan::FromMilliseconds(50));
+        StopwatchTime now = Stopwatch::Now();
+
+        VERIFY_IS_FALSE(window.OnAck(16, TimeSpan::FromMilliseconds(10), 2.0, now));
+        VERIFY_IS_FALSE(window.OnAck(32, TimeSpan::FromMilliseconds(60), 2.0, now));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(64));
+    }
+
+    BOOST_AUTO_TEST_CASE(AckTimeoutHalvesWindow)
+    {
+        AdaptiveSendWindow window(8, 64, TimeSpan::Zero);
+
+        VERIFY_IS_TRUE(window.OnAckTimeout());
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(4));
+        VERIFY_IS_TRUE(window.OnAckTimeout());
+        VERIFY_IS_TRUE(window.OnAckTimeout());
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(1));
+        VERIFY_IS_FALSE(window.OnAckTimeout());
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(1));
+
+        // Growth is additive after a reduction
+        VERIFY_IS_FALSE(window.OnAck(1, TimeSpan::Zero, 2.0, Stopwatch::Now()));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(2));
+        VERIFY_IS_FALSE(window.OnAck(2, TimeSpan::Zero, 2.0, Stopwatch::Now()));
+        VERIFY_ARE_EQUAL(window.WindowSize, static_cast<size_t>(3));
+    }
+
+    BOOST_AUTO_TEST_CASE(BurstSizeFollowsBandwidthDelayProduct)
+    {
+        AdaptiveSendWindow window(64, 64, TimeSpan::Zero);
+        StopwatchTime now = Stopwatch::Now();
+
+        // No estimate yet
+        VERIFY_ARE_EQUAL(window.BurstSize, static_cast<size_t>(64));
+
+        window.OnAck(1, TimeSpan::FromMilliseconds(10), 2.0, now);
+        window.OnAck(10, TimeSpan::FromMilliseconds(10), 2.0, now + TimeSpan::FromMilliseconds(10));
+
+        // 1 operation/ms for 10ms
+        VERIFY_ARE_EQUAL(window.BurstSize, static_cast<size_t>(10));
+
+        window.OnAckTimeout();
+        VERIFY_ARE_EQUAL(window.BurstSize, static_cast<size_t>(5));
+    }
+
+    BOOST_AUTO_TEST_CASE(MinLatencyIsRemeasured)
+    {
+        AdaptiveSendWindow window(64, 64, TimeSpan::Zero);
+        StopwatchTime now = Stopwatch::Now();
+
+        for (size_t i = 0; i < AdaptiveSendWindow::MinLatencySampleCount; ++i)
+        {
+            window.OnAck(1, TimeSpan::FromMilliseconds(10), 100.0, now);
+        }
+
+        VERIFY_ARE_EQUAL2(window.MinLatency, TimeSpan::FromMilliseconds(10));
+
+        for (size_t i = 0; i < AdaptiveSendWindow::MinLatencySampleCount; ++i)
+        {
+            window.OnAck(1, TimeSpan::FromMilliseconds(40), 100.0, now);
+            if (i < AdaptiveSendWindow::MinLatencySampleCount - 1)
+            {
+                VERIFY_ARE_EQUAL2(window.MinLatency, TimeSpan::FromMilliseconds(10));
+            }
+        }
+
+        VERIFY_ARE_EQUAL2(window.MinLatency, TimeSpan::FromMilliseconds(40));
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    bool TestAdaptiveSendWindow::Setup()
+    {
+        return true;
+    }
+}
@@ -0,0 +1,250 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+namespace Reliability {
+namespace ReplicationComponent {
+
+using std::wstring;
+
+using Common::StopwatchTime;
+using Common::StringWriter;
+using Common::TimeSpan;
+
+size_t const AdaptiveSendWindow::MinLatencySampleCount = 256;
+
+// Window reduction when the ACK latency indicates queueing on the remote side
+double const LatencyReductionFactor = 0.7;
+// Window reduction when there was no ACK in a retry interval, same as the non-adaptive sender
+double const TimeoutReductionFactor = 0.5;
+// Decay of the highest delivery rate on every new rate sample
+double const DeliveryRateDecayFactor = 0.9;
+TimeSpan const MinRateInterval = TimeSpan::FromMilliseconds(1);
+
+AdaptiveSendWindow::AdaptiveSendWindow(
+    size_t initialWindowSize,
+    size_t maxWindowSize,
+    TimeSpan latencySlack)
+    : maxWindowSize_(maxWindowSize)
+    , latencySlack_(latencySlack)
+    , windowSize_(static_cast<double>(initialWindowSize))
+    , slowStartThreshold_(static_cast<double>(maxWindowSize))
+    , ackedSinceLastReduction_(0)
+    , minLatency_(TimeSpan::MaxValue)
+    , nextMinLatency_(TimeSpan::MaxValue)
+    , latencySampleCount_(0)
+    , maxDeliveryRate_(0)
+    , rateIntervalStart_(StopwatchTime::Zero)
+    , rateIntervalAckedCount_(0)
+{
+    if (windowSize_ < 1)
+    {
+        windowSize_ = 1;
+    }
+}
+
+AdaptiveSendWindow::AdaptiveSendWindow(AdaptiveSendWindow && other)
+    : maxWindowSize_(other.maxWindowSize_)
+    , latencySlack_(other.latencySlack_)
+    , windowSize_(other.windowSize_)
+    , slowStartThreshold_(other.slowStartThreshold_)
+    , ackedSinceLastReduction_(other.ackedSinceLastReduction_)
+    , minLatency_(other.minLatency_)
+    , nextMinLatency_(other.nextMinLatency_)
+    , latencySampleCount_(other.latencySampleCount_)
+    , maxDeliveryRate_(other.maxDeliveryRate_)
+    , rateIntervalStart_(other.rateIntervalStart_)
+    , rateIntervalAckedCount_(other.rateIntervalAckedCount_)
+{
+}
+
+size_t AdaptiveSendWindow::get_WindowSize() const
+{
+    return static_cast<size_t>(windowSize_);
+}
+
+size_t AdaptiveSendWindow::get_BurstSize() const
+{
+    size_t windowSize = WindowSize;
+    if (maxDeliveryRate_ == 0 || minLatency_ == TimeSpan::MaxValue)
+    {
+        // No estimate yet
+        return windowSize;
+    }
+
+    double bdp = ceil(maxDeliveryRate_ * (minLatency_ + latencySlack_).TotalMillisecondsAsDouble());
+    if (bdp < 1)
+    {
+        return 1;
+    }
+
+    return bdp < static_cast<double>(windowSize) ? static_cast<size_t>(bdp) : windowSize;
+}
+
+void AdaptiveSendWindow::SetMaxWindowSize(size_t maxWindowSize)
+{
+    maxWindowSize_ = maxWindowSize;
+    if (slowStartThreshold_ > maxWindowSize_)
+    {
+        slowStartThreshold_ = static_cast<double>(maxWindowSize_);
+    }
+
+    if (windowSize_ > maxWindowSize_)
+    {
+        windowSize_ = static_cast<double>(maxWindowSize_);
+    }
+}
+
+void AdaptiveSendWindow::Reset(size_t windowSize)
+{
+    windowSize_ = windowSize < 1 ? 1 : static_cast<double>(windowSize);
+    slowStartThreshold_ = static_cast<double>(maxWindowSize_);
+    ackedSinceLastReduction_ = 0;
+}
+
+bool AdaptiveSendWindow::OnAck(
+    size_t ackedCount,
+    TimeSpan const & latency,
+    double latencyThreshold,
+    StopwatchTime now)
+{
+    if (ackedCount == 0)
+    {
+        return false;
+    }
+
+    UpdateDeliveryRate(ackedCount, now);
+    ackedSinceLastReduction_ += ackedCount;
+
+    if (latency > TimeSpan::Zero)
+    {
+        UpdateMinLatency(latency);
+
+        double latencyTargetMilliseconds = minLatency_.TotalMillisecondsAsDouble() * latencyThreshold + latencySlack_.TotalMillisecondsAsDouble();
+        if (latency.TotalMillisecondsAsDouble() > latencyTargetMilliseconds &&
+            ackedSinceLastReduction_ >= WindowSize)
+        {
+            return Reduce(LatencyReductionFactor);
+        }
+    }
+
+    if (windowSize_ < slowStartThreshold_)
+    {
+        windowSize_ += static_cast<double>(ackedCount);
+    }
+    else
+    {
+        windowSize_ += static_cast<double>(ackedCount) / windowSize_;
+    }
+
+    if (windowSize_ > maxWindowSize_)
+    {
+        windowSize_ = static_cast<double>(maxWindowSize_);
+    }
+
+    return false;
+}
+
+bool AdaptiveSendWindow::OnAckTimeout()
+{
+    // The remote side may be stalled, so the ACK rate observed so far is too optimistic
+    maxDeliveryRate_ *= TimeoutReductionFactor;
+    rateIntervalStart_ = StopwatchTime::Zero;
+    rateIntervalAckedCount_ = 0;
+
+    return Reduce(TimeoutReductionFactor);
+}
+
+bool AdaptiveSendWindow::Reduce(double factor)
+{
+    ackedSinceLastReduction_ = 0;
+
+    if (windowSize_ <= 1)
+    {
+        slowStartThreshold_ = 1;
+        return false;
+    }
+
+    windowSize_ = windowSize_ * factor;
+    if (windowSize_ < 1)
+    {
+        windowSize_ = 1;
+    }
+
+    slowStartThreshold_ = windowSize_;
+    return true;
+}
+
+void AdaptiveSendWindow::UpdateMinLatency(TimeSpan const & latency)
+{
+    if (latency < minLatency_)
+    {
+        minLatency_ = latency;
+    }
+
+    if (latency < nextMinLatency_)
+    {
+        nextMinLatency_ = latency;
+    }
+
+    if (++latencySampleCount_ >= MinLatencySampleCount)
+    {
+        minLatency_ = nextMinLatency_;
+        nextMinLatency_ = TimeSpan::MaxValue;
+        latencySampleCount_ = 0;
+    }
+}
+
+void AdaptiveSendWindow::UpdateDeliveryRate(size_t ackedCount, StopwatchTime now)
+{
+    if (rateIntervalStart_ == StopwatchTime::Zero)
+    {
+        rateIntervalStart_ = now;
+        rateIntervalAckedCount_ = 0;
+        return;
+    }
+
+    rateIntervalAckedCount_ += ackedCount;
+
+    // Sample over at least one round trip so that batched ACKs do not inflate the rate
+    TimeSpan interval = now - rateIntervalStart_;
+    TimeSpan minInterval = minLatency_ == TimeSpan::MaxValue ? MinRateInterval : minLatency_ + latencySlack_;
+    if (interval < minInterval || interval < MinRateInterval)
+    {
+        return;
+    }
+
+    double rate = static_cast<double>(rateIntervalAckedCount_) / interval.TotalMillisecondsAsDouble();
+    maxDeliveryRate_ = maxDeliveryRate_ * DeliveryRateDecayFactor;
+    if (rate > maxDeliveryRate_)
+    {
+        maxDeliveryRate_ = rate;
+    }
+
+    rateIntervalStart_ = now;
+    rateIntervalAckedCount_ = 0;
+}
+
+wstring AdaptiveSendWindow::ToString() const
+{
+    wstring content;
+    StringWriter writer(content);
+    WriteTo(writer, Common::FormatOptions(0, false, ""));
+    return content;
+}
+
+void AdaptiveSendWindow::WriteTo(Common::TextWriter& writer, Common::FormatOptions const &) const
+{
+    writer.Write(
+        "Window={0} Burst={1} SSThresh={2} MinLatency={3}",
+        WindowSize,
+        BurstSize,
+        static_cast<size_t>(slowStartThreshold_),
+        minLatency_ == TimeSpan::MaxValue ? TimeSpan::Zero : minLatency_);
+}
+
+}
+}
@@ -0,0 +1,96 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Reliability
+{
+    namespace ReplicationComponent
+    {
+        //
+        //  Congestion control for the operations sent to a single remote replica.
+        //
+        //  The send window follows AIMD: it grows by the number of ACKed operations while
+        //  below the slow start threshold (doubling every round trip) and by one operation
+        //  per window afterwards. It is reduced when no ACK is received for a retry interval,
+        //  or when the ACK latency rises above the lowest latency observed recently by more
+        //  than the configured threshold, which means operations are queueing on the remote side.
+        //  Latency based reductions happen at most once per window of ACKed operations.
+        //
+        //  The burst size estimates the bandwidth-delay product (highest ACK rate observed
+        //  times the lowest latency) and bounds how many operations are resent at once, so that
+        //  a slow replica is not flooded with retries.
+        //
+        //  This class is NOT thread safe and must be protected by a higher level lock
+        //
+        class AdaptiveSendWindow
+        {
+            DENY_COPY(AdaptiveSendWindow)
+
+        public:
+            AdaptiveSendWindow(
+                size_t initialWindowSize,
+                size_t maxWindowSize,
+                Common::TimeSpan latencySlack);
+
+            AdaptiveSendWindow(AdaptiveSendWindow && other);
+
+            __declspec (property(get=get_WindowSize)) size_t WindowSize;
+            size_t get_WindowSize() const;
+
+            __declspec (property(get=get_BurstSize)) size_t BurstSize;
+            size_t get_BurstSize() const;
+
+            __declspec (property(get=get_MinLatency)) Common::TimeSpan MinLatency;
+            Common::TimeSpan get_MinLatency() const { return minLatency_; }
+
+            void SetMaxWindowSize(size_t maxWindowSize);
+
+            // Restarts slow start from the given window size, keeping the latency and rate estimates
+            void Reset(size_t windowSize);
+
+            // Invoked when ackedCount operations are receive ACKed.
+            // latency is the time since the newest ACKed operation was sent, or Zero if unknown.
+            // Returns true if the window was reduced.
+            bool OnAck(
+                size_t ackedCount,
+                Common::TimeSpan const & latency,
+                double latencyThreshold,
+                Common::StopwatchTime now);
+
+            // Invoked when a retry interval elapsed without ACK progress.
+            // Returns true if the window was reduced.
+            bool OnAckTimeout();
+
+            void WriteTo(Common::TextWriter& writer, Common::FormatOptions const &) const;
+
+            std::wstring ToString() const;
+
+            // Number of latency samples after which the lowest latency is re-measured,
+            // so that a permanent change in the network path is eventually picked up
+            static size_t const MinLatencySampleCount;
+
+        private:
+            void UpdateMinLatency(Common::TimeSpan const & latency);
+            void UpdateDeliveryRate(size_t ackedCount, Common::StopwatchTime now);
+            bool Reduce(double factor);
+
+            size_t maxWindowSize_;
+            Common::TimeSpan const latencySlack_;
+            double windowSize_;
+            double slowStartThreshold_;
+            size_t ackedSinceLastReduction_;
+
+            Common::TimeSpan minLatency_;
+            Common::TimeSpan nextMinLatency_;
+            size_t latencySampleCount_;
+
+            // ACKed operations per millisecond
+            double maxDeliveryRate_;
+            Common::StopwatchTime rateIntervalStart_;
+            size_t rateIntervalAckedCount_;
+        };
+    }
+}
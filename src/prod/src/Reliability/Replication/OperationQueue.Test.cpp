@@ -981,6 +981,68 @@ namespace ReplicationUnitTest
         }
     }
 
+    BOOST_AUTO_TEST_CASE(TestBurstyEnqueueLatency)
+    {
+        // Perf test: bursts of increasing size force the queue to expand and shrink repeatedly.
+        // Expanding must not move the queued operations, so the enqueue time should not
+        // depend on the number of operations already in the queue.
+        FABRIC_SEQUENCE_NUMBER startSeq = 1;
+        ULONGLONG initialSize = 64;
+        ULONGLONG maxSize = 64 * 1024;
+        OperationQueue queue(Guid::NewGuid(), L"BurstyEnqueueTest", initialSize, maxSize, 0, 0, 0, false, true /*cleanOnComplete*/, false, startSeq, nullptr);
+
+        FABRIC_SEQUENCE_NUMBER nextSeq = startSeq;
+        TimeSpan maxEnqueueTime = TimeSpan::Zero;
+        TimeSpan totalEnqueueTime = TimeSpan::Zero;
+        LONGLONG enqueueCount = 0;
+
+        for (int round = 0; round < 4; ++round)
+        {
+            for (ULONGLONG burstSize = initialSize; burstSize < maxSize; burstSize <<= 1)
+            {
+                for (ULONGLONG i = 0; i < burstSize; ++i)
+                {
+                    FABRIC_OPERATION_METADATA metadata;
+                    metadata.Type = FABRIC_OPERATION_TYPE_NORMAL;
+                    metadata.SequenceNumber = nextSeq++;
+                    metadata.Reserved = NULL;
+                    ComOperationCPtr op = make_com<ComUserDataOperation, ComOperation>(
+                        make_com<ComTestOperation, IFabricOperationData>(L"BurstyEnqueueTest"),
+                        metadata);
+
+                    Stopwatch stopwatch;
+                    stopwatch.Start();
+                    ErrorCode error = queue.TryEnqueue(op);
+                    stopwatch.Stop();
+
+                    VERIFY_IS_TRUE(error.IsSuccess());
+                    if (stopwatch.Elapsed > maxEnqueueTime)
+                    {
+                        maxEnqueueTime = stopwatch.Elapsed;
+                    }
+
+                    totalEnqueueTime = totalEnqueueTime + stopwatch.Elapsed;
+                    ++enqueueCount;
+                }
+
+                VERIFY_IS_TRUE(queue.Commit());
+                VERIFY_IS_TRUE(queue.Complete());
+                VERIFY_ARE_EQUAL(queue.OperationCount, static_cast<size_t>(0));
+            }
+        }
+
+        Trace.WriteInfo(
+            OperationQueueSource,
+            "TestBurstyEnqueueLatency: {0} operations, average enqueue {1} ticks, max enqueue {2}, {3} capacity changes",
+            enqueueCount,
+            totalEnqueueTime.Ticks / enqueueCount,
+            maxEnqueueTime,
+            queue.CapacityChangeCount);
+
+        VERIFY_ARE_EQUAL(queue.LastCompletedSequenceNumber, nextSeq - 1);
+        VERIFY_IS_FALSE(queue.HasPendingOperations());
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
 
     bool TestOperationQueue::Setup()
@@ -20,8 +20,6 @@ using std::map;
 using std::move;
 using std::pair;
 using std::wstring;
-using std::swap;
-using std::vector;
 
 OperationQueue::OperationQueue(
     Common::Guid const & partitionId, 
@@ -39,7 +37,7 @@ OperationQueue::OperationQueue(
     :   initialSize_(initialSize),
         maxSize_(maxSize),
         maxMemorySize_(maxMemorySize),
-        queue_(),
+        queue_(OperationRingBuffer::DefaultSegmentSize, startSequence),
         partitionId_(partitionId),
         description_(description),
         requireServiceAck_(requireServiceAck),
@@ -74,10 +72,7 @@ OperationQueue::OperationQueue(
     ASSERT_IF(startSequence <= Constants::InvalidLSN, "startSequence {0} must be strictly positive", startSequence);
 
     ASSERT_IF(cleanOnComplete_ && maxCompletedOperationsMemorySize_ != 0 && maxCompletedOperationsSize_ != 0, "Queue {0}: Queue is cleaned up on complete. Cannot set completed operation size limit", ToString());
- 
-    // Resize from the beginning to the correct capacity,
-    // filling the vector with nullptr
-    queue_.resize(SafeConvert<size_t>(capacity_));
+
     OperationQueueEventSource::Events->Ctor(
         this->partitionId_,
         this->description_,
@@ -132,9 +127,9 @@ OperationQueue::OperationQueue(
 
     // When an operation is moved from 1 queue to another, its lifecycle starts again
     // As a result, we must refresh its enqueue time to the current time
-    for (ComOperationCPtr op : queue_)
+    for (FABRIC_SEQUENCE_NUMBER i = completedHead_; i < tail_; ++i)
     {
-        if(op) op->RefreshEnqueueTime();
+        if (queue_[i]) queue_[i]->RefreshEnqueueTime();
     }
 
     // resize the queue to the correct size
@@ -207,7 +202,7 @@ TimeSpan OperationQueue::get_FirstOperationInReplicationQueueEnqueuedSince() con
     if (operationCount_  == 0)
         return TimeSpan::Zero;
 
-    auto op = queue_[GetPosition(completedHead_)];
+    auto op = queue_[completedHead_];
     return (Stopwatch::Now() - op->EnqueueTime);
 }
 
@@ -224,23 +219,17 @@ void OperationQueue::SetCommitCallback(OperationCallback const & callback)
             return;
         }
         // Apply the callback to all already committed operations
-        size_t pos = GetPosition(i);
-        if (!queue_[pos])
+        if (!queue_[i])
         {
             Assert::CodingError("Queue {0}: SetCommitCallback: Operation {1} doesn't exist", ToString(), i);
         }
 
         // The callback must execute fast or
         // the user should schedule it on a different thread.
-        commitCallback_(queue_[pos]);
+        commitCallback_(queue_[i]);
     }
 }
 
-size_t OperationQueue::GetPosition(FABRIC_SEQUENCE_NUMBER sequenceNumber, FABRIC_SEQUENCE_NUMBER mask)
-{
-    return SafeConvert<size_t>(sequenceNumber & mask);
-}
-
 ULONGLONG OperationQueue::get_ConvergentCapacity() const
 { 
     if (convergentCapacity_ == 0)
@@ -268,8 +257,8 @@ ErrorCode OperationQueue::MakeRoomForOperations(
                 ULONGLONG memoryAfterDrop = totalMemorySize_ - completedMemorySize_ + totalDataSize;
                 while (lsnDropStart > lastSequenceNumber && memoryAfterDrop > maxMemorySize_)
                 {
-                    memoryAfterDrop -= queue_[GetPosition(lsnDropStart)]->DataSize;
-                    while (--lsnDropStart >= committedHead_ && !queue_[GetPosition(lsnDropStart)]);
+                    memoryAfterDrop -= queue_[lsnDropStart]->DataSize;
+                    while (--lsnDropStart >= committedHead_ && !queue_[lsnDropStart]);
                 }
                 if (memoryAfterDrop <= maxMemorySize_)
                 {
@@ -310,7 +299,7 @@ ErrorCode OperationQueue::MakeRoomForOperations(
             FABRIC_SEQUENCE_NUMBER snClearedUpto;
             for (snClearedUpto = completedHead_; snClearedUpto < head_ && newMemorySize > maxMemorySize_; snClearedUpto++)
             {
-                newMemorySize -= queue_[GetPosition(snClearedUpto)]->DataSize;
+                newMemorySize -= queue_[snClearedUpto]->DataSize;
             }
             //TODO: clean all operations in same batch
             ASSERT_IF(newMemorySize > maxMemorySize_, "newMemorySize > maxMemorySize_");
@@ -373,7 +362,7 @@ ErrorCode OperationQueue::TryEnqueue(ComOperationCPtr const & operationPtr)
         Assert::CodingError("{0}: TryEnqueue: {1} should be > 0", ToString(), sequenceNumber);
     }
 
-    if (sequenceNumber < committedHead_ || (sequenceNumber < tail_ && queue_[GetPosition(sequenceNumber)]))
+    if (sequenceNumber < committedHead_ || (sequenceNumber < tail_ && queue_[sequenceNumber]))
     {
         OperationQueueEventSource::Events->Duplicate(
             this->partitionId_,
@@ -393,31 +382,31 @@ ErrorCode OperationQueue::TryEnqueue(ComOperationCPtr const & operationPtr)
         return error;
     }
 
-    size_t position = GetPosition(sequenceNumber);
-    
     operationCount_ += 1;
     totalMemorySize_ += operationPtr->DataSize;
     if (sequenceNumber < tail_)
     {
-        queue_[position] = operationPtr;
+        queue_[sequenceNumber] = operationPtr;
     }
     else
     {
-        // All previous completed items should be removed before the expansion;
-        // so we should have only null between the old tail and the new one
+        // Segments are appended as needed, existing operations are never moved
+        queue_.Reserve(sequenceNumber);
+
+        // Discarded items were removed, so we should have only null
+        // between the old tail and the new one
         for (FABRIC_SEQUENCE_NUMBER i = tail_; i <= sequenceNumber; ++i)
         {
-            size_t pos = GetPosition(i); 
-            if (pos >= queue_.size() || queue_[pos])
+            if (queue_[i])
             {
                 Assert::CodingError(
                     "Queue {0}: The operation at {1} should have been removed", 
                     ToString(), 
-                    pos);
+                    i);
             }
         }
 
-        queue_[position] = move(operationPtr);
+        queue_[sequenceNumber] = move(operationPtr);
         // Update tail to the new position
         tail_ = sequenceNumber + 1;
     }
@@ -445,10 +434,10 @@ ComOperationRawPtr OperationQueue::GetOperation(
 {
     if (sequenceNumber < tail_)
     {
-        size_t pos = GetPosition(sequenceNumber); 
-        if (queue_[pos])
+        ComOperationCPtr const & op = queue_[sequenceNumber];
+        if (op)
         {
-            return queue_[pos].GetRawPointer();
+            return op.GetRawPointer();
         }
     }
 
@@ -477,8 +466,8 @@ bool OperationQueue::GetOperations(
 
     for(FABRIC_SEQUENCE_NUMBER i = first; i < tail_; ++i)
     {
-        size_t pos = GetPosition(i); 
-        if (!queue_[pos])
+        ComOperationCPtr const & op = queue_[i];
+        if (!op)
         {
             OperationQueueEventSource::Events->CancelOp(
                 this->partitionId_,
@@ -493,7 +482,7 @@ bool OperationQueue::GetOperations(
             return false;
         }
 
-        operations.push_back(queue_[pos].GetRawPointer());
+        operations.push_back(op.GetRawPointer());
     }
 
     return true;
@@ -565,6 +554,8 @@ void OperationQueue::ClearCompleted(FABRIC_SEQUENCE_NUMBER sequenceNumber)
         UpdatePerfCounter(PerfCounterName::AverageCleanupTime, elapsedTime);
     }
 
+    queue_.Release(completedHead_);
+
     CheckQueueInvariants();
 }
     
@@ -687,8 +678,7 @@ bool OperationQueue::Complete()
     FABRIC_SEQUENCE_NUMBER oldHead = head_;
     for (; i < lastSeq; ++i)
     {
-        size_t pos = GetPosition(i);
-        if (!queue_[pos])
+        if (!queue_[i])
         {
             // Stop at the first out of order item
             OperationQueueEventSource::Events->Gap(
@@ -703,7 +693,7 @@ bool OperationQueue::Complete()
 
             break;
         }
-        else if (requireServiceAck_ && queue_[pos]->NeedsAck)
+        else if (requireServiceAck_ && queue_[i]->NeedsAck)
         {
             // When sending ACKs after service ACKs operations, 
             // stop at the first item that needs to wait for ACK
@@ -719,7 +709,7 @@ bool OperationQueue::Complete()
             break;
         }
 
-        CompleteItem(pos);
+        CompleteItem(i);
     }
 
     if (oldHead < head_)
@@ -801,9 +791,8 @@ bool OperationQueue::Complete(FABRIC_SEQUENCE_NUMBER sequenceNumber)
 
     for (; i <= lastSeq; ++i)
     {
-        size_t pos = GetPosition(i);
         // All items until sequenceNumber should be in order 
-        if (!queue_[pos] || (requireServiceAck_ && queue_[pos]->NeedsAck))
+        if (!queue_[i] || (requireServiceAck_ && queue_[i]->NeedsAck))
         {
             Assert::CodingError(
                 "Queue {0}: Operation {1} doesn't exist or needs Ack",
@@ -811,7 +800,7 @@ bool OperationQueue::Complete(FABRIC_SEQUENCE_NUMBER sequenceNumber)
                 i);
         }
 
-        CompleteItem(pos);
+        CompleteItem(i);
     }
 
     if (oldHead < head_)
@@ -883,7 +872,7 @@ bool OperationQueue::UpdateLastCompletedHead(FABRIC_SEQUENCE_NUMBER sequenceNumb
 
         while (head_ > newHead)
         {
-            completedMemorySize_ -= queue_[GetPosition(--head_)]->DataSize;
+            completedMemorySize_ -= queue_[--head_]->DataSize;
             completedOperationCount_ -= 1;
         }
         CheckQueueInvariants();
@@ -896,26 +885,27 @@ bool OperationQueue::UpdateLastCompletedHead(FABRIC_SEQUENCE_NUMBER sequenceNumb
     }
 }
 
-// Caller should have checked that pos
+// Caller should have checked that sequenceNumber
 // contains a valid item
-void OperationQueue::CompleteItem(size_t pos)
+void OperationQueue::CompleteItem(FABRIC_SEQUENCE_NUMBER sequenceNumber)
 {
+    ComOperationCPtr & op = queue_[sequenceNumber];
     if (ignoreCommit_)
     {
         ++committedHead_;
-        auto elapsedCommit = queue_[pos]->Commit();
+        auto elapsedCommit = op->Commit();
         if (commitCallback_)
         {
             // The callback must execute fast or
             // the user should schedule it on a different thread.
-            commitCallback_(queue_[pos]);
+            commitCallback_(op);
         }
         
         // Update Average Commit Time
         UpdatePerfCounter(AverageCommitTime, elapsedCommit);
     }
     
-    auto elapsedComplete = queue_[pos]->Complete();
+    auto elapsedComplete = op->Complete();
     ++head_;
 
     // Update Average Complete Time
@@ -924,16 +914,17 @@ void OperationQueue::CompleteItem(size_t pos)
     if (cleanOnComplete_)
     {
         operationCount_ -= 1;
-        totalMemorySize_ -= queue_[pos]->DataSize;
+        totalMemorySize_ -= op->DataSize;
         ++completedHead_;
-        auto elapsedCleanup = queue_[pos]->Cleanup();
+        auto elapsedCleanup = op->Cleanup();
         
         UpdatePerfCounter(AverageCleanupTime, elapsedCleanup);
-        ComOperationCPtr cleanup(move(queue_[pos]));
+        ComOperationCPtr cleanup(move(op));
+        queue_.Release(completedHead_);
     }
     else
     {
-        completedMemorySize_ += queue_[pos]->DataSize;
+        completedMemorySize_ += op->DataSize;
         completedOperationCount_ += 1;
 
         // If the number of completed operations has exceeded the limit, trim the queue
@@ -964,23 +955,25 @@ void OperationQueue::TrimCompletedOperations()
     // start from the 'completedHead_' and cleanup operations until the memory or size restriction is satisfied
     do
     {
-        size_t pos = GetPosition(completedHead_);
+        ComOperationCPtr & op = queue_[completedHead_];
 
-        ASSERT_IFNOT(queue_[pos], "Queue {0}: TrimCompletedOperations:- Items are Completed in order. Position cannot be null", ToString());
+        ASSERT_IFNOT(op, "Queue {0}: TrimCompletedOperations:- Items are Completed in order. Position cannot be null", ToString());
         
         operationCount_ -= 1;
         completedOperationCount_ -= 1;
 
-        completedMemorySize_ -= queue_[pos]->DataSize;
-        totalMemorySize_ -= queue_[pos]->DataSize;
+        completedMemorySize_ -= op->DataSize;
+        totalMemorySize_ -= op->DataSize;
 
         ++completedHead_;
-        auto elapsedCleanup = queue_[pos]->Cleanup();
+        auto elapsedCleanup = op->Cleanup();
         
         UpdatePerfCounter(AverageCleanupTime, elapsedCleanup);
-        ComOperationCPtr cleanup(move(queue_[pos]));
+        ComOperationCPtr cleanup(move(op));
     } while (ShouldTrimCompletedOperations());
 
+    queue_.Release(completedHead_);
+
     // Removal of items might have resulted in less number of operations. Attempt to shrink the queue here
     Shrink(tail_ - completedHead_, false /*clearCompleted*/);
 
@@ -1011,8 +1004,7 @@ bool OperationQueue::Commit()
 
     for (; i < tail_; ++i)
     {
-        size_t pos = GetPosition(i);
-        if (!queue_[pos])
+        if (!queue_[i])
         {
             // Stop at the first out of order item
             OperationQueueEventSource::Events->Gap(
@@ -1028,7 +1020,7 @@ bool OperationQueue::Commit()
             break;
         }
         
-        CommitItem(pos);
+        CommitItem(i);
     }
 
     if (oldCommit < committedHead_)
@@ -1095,14 +1087,13 @@ bool OperationQueue::Commit(FABRIC_SEQUENCE_NUMBER sequenceNumber)
     FABRIC_SEQUENCE_NUMBER i = committedHead_;
     for (; i <= sequenceNumber; ++i)
     {
-        size_t pos = GetPosition(i);
         // All items until sequenceNumber should be in order 
-        if (!queue_[pos])
+        if (!queue_[i])
         {
             Assert::CodingError("Queue {0}: Commit upto {1}: {2} doesn't exist", ToString(), sequenceNumber, i);
         }
 
-        CommitItem(pos);
+        CommitItem(i);
     }
 
     if (oldCommit < committedHead_)
@@ -1182,16 +1173,17 @@ bool OperationQueue::UpdateCommitHead(FABRIC_SEQUENCE_NUMBER sequenceNumber)
     }
 }
 
-// Caller should have checked that pos
+// Caller should have checked that sequenceNumber
 // contains a valid item
-void OperationQueue::CommitItem(size_t pos)
+void OperationQueue::CommitItem(FABRIC_SEQUENCE_NUMBER sequenceNumber)
 {
-    auto elapsedCommit = queue_[pos]->Commit();
+    ComOperationCPtr const & op = queue_[sequenceNumber];
+    auto elapsedCommit = op->Commit();
     if (commitCallback_)
     {
         // Commit callback must execute fast or
         // the user should schedule it on a different thread.
-        commitCallback_(queue_[pos]); 
+        commitCallback_(op); 
     }
     committedHead_++;
 
@@ -1207,7 +1199,7 @@ void OperationQueue::Reset(FABRIC_SEQUENCE_NUMBER startSequence)
     }
 
     // Clean all the existing items
-    queue_.clear();
+    queue_.Reset(startSequence);
     
     // Set the indexes to the new value
     head_ = startSequence; 
@@ -1225,8 +1217,6 @@ void OperationQueue::Reset(FABRIC_SEQUENCE_NUMBER startSequence)
     convergentCapacity_ = 0;
     capacityChangeCount_ = 1;
     mask_ = capacity_ - 1;
-
-    queue_.resize(SafeConvert<size_t>(capacity_));
 }
 
 void OperationQueue::DiscardNonCommittedOperations()
@@ -1287,11 +1277,11 @@ void OperationQueue::RemoveItem(
     FABRIC_SEQUENCE_NUMBER sequenceNumber, 
     __out TimeSpan & elapsedTime)
 {
-    size_t pos = GetPosition(sequenceNumber);
+    ComOperationCPtr & op = queue_[sequenceNumber];
 
-    if (queue_[pos])
+    if (op)
     {
-        ULONGLONG dataSize = queue_[pos]->DataSize; 
+        ULONGLONG dataSize = op->DataSize; 
         operationCount_ -= 1;
         totalMemorySize_ -= dataSize;
         if (sequenceNumber < head_)
@@ -1300,8 +1290,8 @@ void OperationQueue::RemoveItem(
             completedOperationCount_ -= 1;
         }
 
-        elapsedTime = queue_[pos]->Cleanup();
-        ComOperationCPtr cleanup(move(queue_[pos]));
+        elapsedTime = op->Cleanup();
+        ComOperationCPtr cleanup(move(op));
     }
 }
 
@@ -1348,16 +1338,8 @@ void OperationQueue::UpdateCapacity(FABRIC_SEQUENCE_NUMBER newCapacity)
 {
     ASSERT_IF(newCapacity <= 1, "Queue {0}: Capacity must be greater than 1", ToString());
     ASSERT_IF(newCapacity == SafeConvert<FABRIC_SEQUENCE_NUMBER>(capacity_), "Queue {0}: Shouldn't update the capacity to the same value", ToString());
-    // Resize the queue and move all items to map to the new capacity
-    vector<ComOperationCPtr> newQueue;
-    newQueue.resize(SafeConvert<size_t>(newCapacity));
-    FABRIC_SEQUENCE_NUMBER newMask = newCapacity - 1;
-    for (FABRIC_SEQUENCE_NUMBER i = completedHead_; i < tail_; ++i)
-    {
-        swap(newQueue[GetPosition(i, newMask)], queue_[GetPosition(i)]);
-    }
-
-    swap(queue_, newQueue);
+    // The capacity only limits the number of items admitted in the queue;
+    // the ring buffer grows and shrinks by segments, so no items are moved here.
     capacity_ = newCapacity;
     mask_ = capacity_ - 1;
     ++capacityChangeCount_;
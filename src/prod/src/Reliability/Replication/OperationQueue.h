@@ -19,8 +19,8 @@ namespace Reliability
         } PerfCounterName;
 
         // Queue used for ordering operations that arrive out-of-order.
-        // Implemented using a cyclic buffer that stores operations based on their
-        // sequence number.
+        // Implemented using a segmented ring buffer that stores operations based on their
+        // sequence number; stored operations are never moved when the capacity changes.
         // The queue has indexes to keep track of the sequence number
         // of the last in-order, last out-of-order, first completed and committed operation.
         // The size of the queue is variable, and it can grow between 
@@ -206,18 +206,10 @@ namespace Reliability
                 return converted;
             }
 
-            // Returns the position in the vector
-            static size_t GetPosition(FABRIC_SEQUENCE_NUMBER sequenceNumber, FABRIC_SEQUENCE_NUMBER mask);
-            inline size_t GetPosition(FABRIC_SEQUENCE_NUMBER sequenceNumber) const
-            {
-                return GetPosition(sequenceNumber, mask_);
-            }
-
-            void CommitItem(size_t pos);
-            void CompleteItem(size_t pos);
+            void CommitItem(FABRIC_SEQUENCE_NUMBER sequenceNumber);
+            void CompleteItem(FABRIC_SEQUENCE_NUMBER sequenceNumber);
 
-            // Changes the capacity and moves the elements in the vector
-            // to match the new capacity.
+            // Changes the capacity, which limits the number of items in the queue.
             void UpdateCapacity(FABRIC_SEQUENCE_NUMBER newCapacity);
 
             // Remove previously completed items.
@@ -263,7 +255,7 @@ namespace Reliability
             ULONGLONG maxMemorySize_;
 
             // The queue that holds the operations
-            std::vector<ComOperationCPtr> queue_;
+            OperationRingBuffer queue_;
             
             // ID used for tracing
             Common::Guid const partitionId_;
@@ -0,0 +1,152 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+#include "ComTestOperation.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace ReplicationUnitTest
+{
+    using namespace Common;
+    using namespace std;
+    using namespace Reliability::ReplicationComponent;
+
+    static StringLiteral const PublicTestSource("TESTOperationRingBuffer");
+
+    class TestOperationRingBuffer
+    {
+    protected:
+        TestOperationRingBuffer() { BOOST_REQUIRE(Setup()); }
+        TEST_CLASS_SETUP(Setup)
+
+        static ComOperationCPtr CreateOperation(FABRIC_SEQUENCE_NUMBER sequenceNumber)
+        {
+            FABRIC_OPERATION_METADATA metadata;
+            metadata.Type = FABRIC_OPERATION_TYPE_NORMAL;
+            metadata.SequenceNumber = sequenceNumber;
+            metadata.Reserved = NULL;
+            return make_com<ComUserDataOperation, ComOperation>(
+                make_com<ComTestOperation, IFabricOperationData>(L"OperationRingBufferTest"),
+                metadata);
+        }
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(TestOperationRingBufferSuite, TestOperationRingBuffer)
+
+    BOOST_AUTO_TEST_CASE(ReserveAppendsSegments)
+    {
+        OperationRingBuffer buffer(4, 6);
+
+        VERIFY_ARE_EQUAL(buffer.SegmentSize, static_cast<size_t>(4));
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(0));
+        VERIFY_IS_FALSE(buffer.Contains(6));
+
+        // 6 and 7 are in the first segment [4, 8)
+        buffer.Reserve(7);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(1));
+        VERIFY_IS_TRUE(buffer.Contains(6));
+        VERIFY_IS_FALSE(buffer.Contains(8));
+
+        buffer.Reserve(17);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(4));
+        VERIFY_IS_TRUE(buffer.Contains(19));
+        VERIFY_IS_FALSE(buffer.Contains(20));
+
+        // Reserving an already reserved sequence number does nothing
+        buffer.Reserve(9);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(4));
+    }
+
+    BOOST_AUTO_TEST_CASE(GrowingDoesNotMoveOperations)
+    {
+        OperationRingBuffer buffer(4, 1);
+
+        buffer.Reserve(1);
+        ComOperationCPtr op = CreateOperation(1);
+        buffer[1] = op;
+        ComOperationCPtr const * address = &buffer[1];
+
+        buffer.Reserve(100);
+        VERIFY_IS_TRUE(address == &buffer[1]);
+        VERIFY_IS_TRUE(buffer[1].GetRawPointer() == op.GetRawPointer());
+        VERIFY_IS_FALSE(buffer[100]);
+    }
+
+    BOOST_AUTO_TEST_CASE(ReleaseKeepsSpareSegments)
+    {
+        OperationRingBuffer buffer(4, 0);
+        FABRIC_SEQUENCE_NUMBER count = static_cast<FABRIC_SEQUENCE_NUMBER>(4 * (OperationRingBuffer::MaxSpareSegmentCount + 2));
+
+        buffer.Reserve(count - 1);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, OperationRingBuffer::MaxSpareSegmentCount + 2);
+
+        // 5 is in the second segment, so only the first one is released
+        buffer.Release(5);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, OperationRingBuffer::MaxSpareSegmentCount + 1);
+        VERIFY_ARE_EQUAL(buffer.SpareSegmentCount, static_cast<size_t>(1));
+        VERIFY_IS_FALSE(buffer.Contains(3));
+        VERIFY_IS_TRUE(buffer.Contains(4));
+
+        buffer.Release(count);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(0));
+        VERIFY_ARE_EQUAL(buffer.SpareSegmentCount, OperationRingBuffer::MaxSpareSegmentCount);
+
+        // Spare segments are reused before allocating new ones
+        buffer.Reserve(count + 3);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(1));
+        VERIFY_ARE_EQUAL(buffer.SpareSegmentCount, OperationRingBuffer::MaxSpareSegmentCount - 1);
+        VERIFY_IS_TRUE(buffer.Contains(count));
+    }
+
+    BOOST_AUTO_TEST_CASE(ReleaseEmptyBufferMovesStart)
+    {
+        OperationRingBuffer buffer(4, 1);
+
+        buffer.Release(9);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(0));
+
+        buffer.Reserve(9);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(1));
+        VERIFY_IS_TRUE(buffer.Contains(8));
+        VERIFY_IS_FALSE(buffer.Contains(7));
+    }
+
+    BOOST_AUTO_TEST_CASE(ResetClearsOperations)
+    {
+        OperationRingBuffer buffer(4, 1);
+
+        buffer.Reserve(2);
+        buffer[2] = CreateOperation(2);
+
+        buffer.Reset(2);
+        VERIFY_ARE_EQUAL(buffer.SegmentCount, static_cast<size_t>(0));
+        VERIFY_ARE_EQUAL(buffer.SpareSegmentCount, static_cast<size_t>(1));
+
+        // The spare segment is reused and must not contain the old operation
+        buffer.Reserve(2);
+        VERIFY_IS_FALSE(buffer[2]);
+    }
+
+    BOOST_AUTO_TEST_CASE(ConstAccessOutOfRangeIsEmpty)
+    {
+        OperationRingBuffer buffer(4, 4);
+        buffer.Reserve(4);
+        buffer[4] = CreateOperation(4);
+
+        OperationRingBuffer const & constBuffer = buffer;
+        VERIFY_IS_TRUE(constBuffer[4]);
+        VERIFY_IS_FALSE(constBuffer[3]);
+        VERIFY_IS_FALSE(constBuffer[8]);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    bool TestOperationRingBuffer::Setup()
+    {
+        return true;
+    }
+}
@@ -0,0 +1,120 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+namespace Reliability {
+namespace ReplicationComponent {
+
+size_t const OperationRingBuffer::DefaultSegmentSize = 64;
+size_t const OperationRingBuffer::MaxSpareSegmentCount = 4;
+
+ComOperationCPtr const OperationRingBuffer::EmptyOperation;
+
+OperationRingBuffer::OperationRingBuffer(
+    size_t segmentSize,
+    FABRIC_SEQUENCE_NUMBER startSequence)
+    : segmentShift_(0)
+    , segmentMask_(0)
+    , firstSegmentNumber_(0)
+    , segments_()
+    , spareSegments_()
+{
+    ASSERT_IF(
+        segmentSize == 0 || (segmentSize & (segmentSize - 1)) != 0,
+        "OperationRingBuffer: segment size {0} must be a power of 2",
+        segmentSize);
+
+    while ((static_cast<size_t>(1) << segmentShift_) < segmentSize)
+    {
+        ++segmentShift_;
+    }
+
+    segmentMask_ = static_cast<FABRIC_SEQUENCE_NUMBER>(segmentSize - 1);
+    firstSegmentNumber_ = startSequence >> segmentShift_;
+}
+
+OperationRingBuffer::OperationRingBuffer(OperationRingBuffer && other)
+    : segmentShift_(other.segmentShift_)
+    , segmentMask_(other.segmentMask_)
+    , firstSegmentNumber_(other.firstSegmentNumber_)
+    , segments_(std::move(other.segments_))
+    , spareSegments_(std::move(other.spareSegments_))
+{
+}
+
+void OperationRingBuffer::Reserve(FABRIC_SEQUENCE_NUMBER sequenceNumber)
+{
+    FABRIC_SEQUENCE_NUMBER segmentNumber = sequenceNumber >> segmentShift_;
+    ASSERT_IF(
+        segmentNumber < firstSegmentNumber_,
+        "OperationRingBuffer: {0} is below the first segment {1}",
+        sequenceNumber,
+        firstSegmentNumber_);
+
+    while (segmentNumber - firstSegmentNumber_ >= static_cast<FABRIC_SEQUENCE_NUMBER>(segments_.size()))
+    {
+        segments_.push_back(AcquireSegment());
+    }
+}
+
+void OperationRingBuffer::Release(FABRIC_SEQUENCE_NUMBER sequenceNumber)
+{
+    FABRIC_SEQUENCE_NUMBER segmentNumber = sequenceNumber >> segmentShift_;
+
+    while (firstSegmentNumber_ < segmentNumber)
+    {
+        if (!segments_.empty())
+        {
+            ReleaseSegment(std::move(segments_.front()));
+            segments_.pop_front();
+        }
+
+        ++firstSegmentNumber_;
+    }
+}
+
+void OperationRingBuffer::Reset(FABRIC_SEQUENCE_NUMBER startSequence)
+{
+    while (!segments_.empty())
+    {
+        for (ComOperationCPtr & op : *segments_.front())
+        {
+            op = nullptr;
+        }
+
+        ReleaseSegment(std::move(segments_.front()));
+        segments_.pop_front();
+    }
+
+    firstSegmentNumber_ = startSequence >> segmentShift_;
+}
+
+OperationRingBuffer::SegmentUPtr OperationRingBuffer::AcquireSegment()
+{
+    if (spareSegments_.empty())
+    {
+        return Common::make_unique<Segment>(SegmentSize);
+    }
+
+    SegmentUPtr segment = std::move(spareSegments_.back());
+    spareSegments_.pop_back();
+    return segment;
+}
+
+void OperationRingBuffer::ReleaseSegment(SegmentUPtr && segment)
+{
+    if (spareSegments_.size() < MaxSpareSegmentCount)
+    {
+        spareSegments_.push_back(std::move(segment));
+    }
+    else
+    {
+        segment.reset();
+    }
+}
+
+}
+}
@@ -0,0 +1,93 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Reliability
+{
+    namespace ReplicationComponent
+    {
+        // Storage for the OperationQueue, indexed by sequence number.
+        // Operations are kept in fixed size segments that are appended at the back
+        // as the tail advances and released from the front as operations are removed,
+        // so growing never moves the operations that are already stored.
+        // A few released segments are cached to avoid allocations under steady load.
+        // The buffer does not provide any threading protection.
+        class OperationRingBuffer
+        {
+            DENY_COPY(OperationRingBuffer);
+
+        public:
+            static size_t const DefaultSegmentSize;
+            static size_t const MaxSpareSegmentCount;
+
+            // segmentSize must be a power of 2
+            OperationRingBuffer(
+                size_t segmentSize,
+                FABRIC_SEQUENCE_NUMBER startSequence);
+
+            OperationRingBuffer(OperationRingBuffer && other);
+
+            __declspec (property(get=get_SegmentSize)) size_t SegmentSize;
+            size_t get_SegmentSize() const { return static_cast<size_t>(segmentMask_) + 1; }
+
+            __declspec (property(get=get_SegmentCount)) size_t SegmentCount;
+            size_t get_SegmentCount() const { return segments_.size(); }
+
+            __declspec (property(get=get_SpareSegmentCount)) size_t SpareSegmentCount;
+            size_t get_SpareSegmentCount() const { return spareSegments_.size(); }
+
+            bool Contains(FABRIC_SEQUENCE_NUMBER sequenceNumber) const
+            {
+                FABRIC_SEQUENCE_NUMBER segmentNumber = sequenceNumber >> segmentShift_;
+                return segmentNumber >= firstSegmentNumber_ &&
+                    segmentNumber - firstSegmentNumber_ < static_cast<FABRIC_SEQUENCE_NUMBER>(segments_.size());
+            }
+
+            // The sequence number must have been reserved and not released
+            ComOperationCPtr & operator[](FABRIC_SEQUENCE_NUMBER sequenceNumber)
+            {
+                ASSERT_IFNOT(Contains(sequenceNumber), "OperationRingBuffer: {0} is not in the buffer", sequenceNumber);
+                return (*segments_[static_cast<size_t>((sequenceNumber >> segmentShift_) - firstSegmentNumber_)])[static_cast<size_t>(sequenceNumber & segmentMask_)];
+            }
+
+            // Returns an empty pointer for sequence numbers that are not in the buffer
+            ComOperationCPtr const & operator[](FABRIC_SEQUENCE_NUMBER sequenceNumber) const
+            {
+                if (!Contains(sequenceNumber))
+                {
+                    return EmptyOperation;
+                }
+
+                return (*segments_[static_cast<size_t>((sequenceNumber >> segmentShift_) - firstSegmentNumber_)])[static_cast<size_t>(sequenceNumber & segmentMask_)];
+            }
+
+            // Makes room for all sequence numbers up to and including the provided one
+            void Reserve(FABRIC_SEQUENCE_NUMBER sequenceNumber);
+
+            // Releases the segments that only hold sequence numbers smaller than the provided one.
+            // The caller must have already removed the operations stored there.
+            void Release(FABRIC_SEQUENCE_NUMBER sequenceNumber);
+
+            // Releases all the operations and starts indexing at the provided sequence number
+            void Reset(FABRIC_SEQUENCE_NUMBER startSequence);
+
+        private:
+            typedef std::vector<ComOperationCPtr> Segment;
+            typedef std::unique_ptr<Segment> SegmentUPtr;
+
+            static ComOperationCPtr const EmptyOperation;
+
+            SegmentUPtr AcquireSegment();
+            void ReleaseSegment(SegmentUPtr && segment);
+
+            size_t segmentShift_;
+            FABRIC_SEQUENCE_NUMBER segmentMask_;
+            FABRIC_SEQUENCE_NUMBER firstSegmentNumber_;
+            std::deque<SegmentUPtr> segments_;
+            std::vector<SegmentUPtr> spareSegments_;
+        };
+    }
+}
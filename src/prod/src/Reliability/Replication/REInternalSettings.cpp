@@ -153,6 +153,18 @@ int64 REInternalSettings::get_SecondaryReplicatorBatchTracingArraySize() const
     return secondaryReplicatorBatchTracingArraySize_;
 }
 
+bool REInternalSettings::get_EnableAdaptiveSendWindow() const
+{
+    AcquireReadLock grab(lock_);
+    return enableAdaptiveSendWindow_;
+}
+
+double REInternalSettings::get_AdaptiveSendWindowLatencyThreshold() const
+{
+    AcquireReadLock grab(lock_);
+    return adaptiveSendWindowLatencyThreshold_;
+}
+
 bool REInternalSettings::get_RequireServiceAck() const
 {
     AcquireReadLock grab(lock_);
@@ -624,6 +636,38 @@ int REInternalSettings::LoadGlobalSettingsCallerHoldsLock()
     });
     i += 1;
 
+    this->enableAdaptiveSendWindow_ = globalConfig_->EnableAdaptiveSendWindow;
+    globalConfig_->EnableAdaptiveSendWindowEntry.AddHandler(
+        [&](EventArgs const &)
+    {
+        AcquireExclusiveLock grab(lock_);
+
+        ReplicatorEventSource::Events->ReplicatorConfigUpdate(
+            reinterpret_cast<uintptr_t>(this),
+            L"EnableAdaptiveSendWindow",
+            Common::wformatString("{0}", this->enableAdaptiveSendWindow_),
+            Common::wformatString("{0}", globalConfig_->EnableAdaptiveSendWindow));
+
+        this->enableAdaptiveSendWindow_ = globalConfig_->EnableAdaptiveSendWindow;
+    });
+    i += 1;
+
+    this->adaptiveSendWindowLatencyThreshold_ = globalConfig_->AdaptiveSendWindowLatencyThreshold;
+    globalConfig_->AdaptiveSendWindowLatencyThresholdEntry.AddHandler(
+        [&](EventArgs const &)
+    {
+        AcquireExclusiveLock grab(lock_);
+
+        ReplicatorEventSource::Events->ReplicatorConfigUpdate(
+            reinterpret_cast<uintptr_t>(this),
+            L"AdaptiveSendWindowLatencyThreshold",
+            Common::wformatString("{0}", this->adaptiveSendWindowLatencyThreshold_),
+            Common::wformatString("{0}", globalConfig_->AdaptiveSendWindowLatencyThreshold));
+
+        this->adaptiveSendWindowLatencyThreshold_ = globalConfig_->AdaptiveSendWindowLatencyThreshold;
+    });
+    i += 1;
+
     return i;
 }
 
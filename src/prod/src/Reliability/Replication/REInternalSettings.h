@@ -85,6 +85,8 @@ namespace Reliability
             double secondaryProgressRateDecayFactor_ ;
             Common::TimeSpan idleReplicaMaxLagDurationBeforePromotion_;
             int64 secondaryReplicatorBatchTracingArraySize_;
+            bool enableAdaptiveSendWindow_;
+            double adaptiveSendWindowLatencyThreshold_;
 
             // The following are over-ridable settings
             Common::TimeSpan retryInterval_;
@@ -96,6 +96,16 @@ namespace Reliability
                         Common::PerformanceCounterType::RateOfCountPerSecond64,
                         L"Enqueued Bytes/Sec",
                         L"Counter indicating the number of enqueued bytes/sec")
+                    COUNTER_DEFINITION(
+                        13,
+                        Common::PerformanceCounterType::RateOfCountPerSecond64,
+                        L"Send Window Reductions/Sec",
+                        L"Counter indicating the number of times/sec the adaptive send window to a secondary was reduced due to high ACK latency or missing ACKs")
+                    COUNTER_DEFINITION(
+                        14,
+                        Common::PerformanceCounterType::RateOfCountPerSecond64,
+                        L"Resent Operations/Sec",
+                        L"Counter indicating the number of replication operations resent/sec to secondaries that did not ACK them within the retry interval")
 
                 END_COUNTER_SET_DEFINITION()
                 
@@ -111,6 +121,8 @@ namespace Reliability
                 DECLARE_COUNTER_INSTANCE(Role)
                 DECLARE_COUNTER_INSTANCE(EnqueuedOpsPerSecond)
                 DECLARE_COUNTER_INSTANCE(EnqueuedBytesPerSecond)
+                DECLARE_COUNTER_INSTANCE(SendWindowReductionsPerSecond)
+                DECLARE_COUNTER_INSTANCE(ResentOperationsPerSecond)
 
                 BEGIN_COUNTER_SET_INSTANCE(REPerformanceCounters)
                     DEFINE_COUNTER_INSTANCE(
@@ -149,6 +161,12 @@ namespace Reliability
                     DEFINE_COUNTER_INSTANCE(
                         EnqueuedBytesPerSecond, 
                         12)
+                    DEFINE_COUNTER_INSTANCE(
+                        SendWindowReductionsPerSecond, 
+                        13)
+                    DEFINE_COUNTER_INSTANCE(
+                        ResentOperationsPerSecond, 
+                        14)
                 END_COUNTER_SET_INSTANCE()
 
         public:
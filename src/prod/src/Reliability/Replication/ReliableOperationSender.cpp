@@ -48,6 +48,9 @@ ReliableOperationSender::ReliableOperationSender(
     highestOperationSequenceNumber_(lastAckedSequenceNumber),
     sendWindowSize_(static_cast<size_t>(startSendWindowSize)),
     noAckSinceLastCallback_(false),
+    adaptiveSendWindow_(static_cast<size_t>(startSendWindowSize), static_cast<size_t>(maxSendWindowSize), config->BatchAcknowledgementInterval),
+    adaptiveSendWindowEnabled_(false),
+    perfCounters_(),
     isActive_(false),
     retrySendTimer_(),
     timerActive_(false),
@@ -69,6 +72,8 @@ ReliableOperationSender::ReliableOperationSender(
         if (maxSendWindowSize_ < sendWindowSize_)
             maxSendWindowSize_ = sendWindowSize_*DEFAULT_MAX_SWS_FACTOR_WHEN_0;
     }
+
+    adaptiveSendWindow_.SetMaxWindowSize(static_cast<size_t>(maxSendWindowSize_));
 }
 
 ReliableOperationSender::ReliableOperationSender(ReliableOperationSender && other)
@@ -86,6 +91,9 @@ ReliableOperationSender::ReliableOperationSender(ReliableOperationSender && othe
     highestOperationSequenceNumber_(other.highestOperationSequenceNumber_),
     sendWindowSize_(other.sendWindowSize_),
     noAckSinceLastCallback_(other.noAckSinceLastCallback_),
+    adaptiveSendWindow_(move(other.adaptiveSendWindow_)),
+    adaptiveSendWindowEnabled_(other.adaptiveSendWindowEnabled_),
+    perfCounters_(move(other.perfCounters_)),
     isActive_(other.isActive_),
     retrySendTimer_(move(other.retrySendTimer_)),
     timerActive_(other.timerActive_),
@@ -204,6 +212,52 @@ void ReliableOperationSender::ResetAverageStatistics()
     timeSinceLastAverageUpdate_.Restart();
 }
 
+void ReliableOperationSender::SetPerformanceCounters(REPerformanceCountersSPtr const & perfCounters)
+{
+    AcquireWriteLock lock(lock_);
+    perfCounters_ = perfCounters;
+}
+
+bool ReliableOperationSender::UseAdaptiveSendWindowCallerHoldsLock()
+{
+    // The config is dynamic, so continue from the current window when the controller is switched on
+    bool enabled = config_->EnableAdaptiveSendWindow;
+    if (enabled && !adaptiveSendWindowEnabled_)
+    {
+        adaptiveSendWindow_.Reset(sendWindowSize_);
+    }
+
+    adaptiveSendWindowEnabled_ = enabled;
+    return enabled;
+}
+
+void ReliableOperationSender::GetAckedSendLatencyCallerHoldsLock(
+    FABRIC_SEQUENCE_NUMBER ackedReceivedSequenceNumber,
+    __out size_t & ackedCount,
+    __out TimeSpan & latency) const
+{
+    // The stopwatches in ackDurationList_ start when the operation is added, so they include
+    // the time spent waiting for the send window. Measure from the last send instead, otherwise
+    // a smaller window would look like a slower replica and keep shrinking.
+    ackedCount = 0;
+    latency = TimeSpan::Zero;
+    DateTime lastSendTime = DateTime::Zero;
+
+    for (auto it = pendingOperations_.begin(); it != pendingOperations_.end() && it->first->SequenceNumber <= ackedReceivedSequenceNumber; ++it)
+    {
+        ++ackedCount;
+        if (it->second != DateTime::Zero)
+        {
+            lastSendTime = it->second;
+        }
+    }
+
+    if (lastSendTime != DateTime::Zero)
+    {
+        latency = DateTime::Now() - lastSendTime;
+    }
+}
+
 void ReliableOperationSender::Add(
     ComOperationRawPtrVector const & operations,
     FABRIC_SEQUENCE_NUMBER completedSeqNumber)
@@ -567,7 +621,18 @@ void ReliableOperationSender::OnTimerCallback()
         
         completedSeqNumber = completedSeqNumber_;
 
-        if (noAckSinceLastCallback_ && sendWindowSize_ > 1)
+        if (UseAdaptiveSendWindowCallerHoldsLock())
+        {
+            if (noAckSinceLastCallback_ && adaptiveSendWindow_.OnAckTimeout())
+            {
+                sendWindowSize_ = adaptiveSendWindow_.WindowSize;
+                if (perfCounters_)
+                {
+                    perfCounters_->SendWindowReductionsPerSecond.Increment();
+                }
+            }
+        }
+        else if (noAckSinceLastCallback_ && sendWindowSize_ > 1)
         {
             // Since it's been a while since the 
             // other side ACKed operations, it may be overwhelmed.
@@ -647,8 +712,17 @@ bool ReliableOperationSender::ProcessOnAck(
                 ackedQuorumSequenceNumber);
         }
         
+        bool useAdaptiveSendWindow = UseAdaptiveSendWindowCallerHoldsLock();
+        size_t ackedCount = 0;
+        TimeSpan ackLatency = TimeSpan::Zero;
+
         if (ackedReceivedSequenceNumber > lastAckedReceivedSequenceNumber_)
         {
+            if (useAdaptiveSendWindow)
+            {
+                GetAckedSendLatencyCallerHoldsLock(ackedReceivedSequenceNumber, ackedCount, ackLatency);
+            }
+
             // Remove the operations that are receive ACKed, since we don't have to send them anymore
             RemoveOperationsCallerHoldsLock(ackedReceivedSequenceNumber);
             lastAckedReceivedSequenceNumber_ = ackedReceivedSequenceNumber;
@@ -668,7 +742,17 @@ bool ReliableOperationSender::ProcessOnAck(
         if (progressQuorumDone || progressReceiveDone)
         {
             noAckSinceLastCallback_ = false;
-            if (sendWindowSize_ < static_cast<size_t>(maxSendWindowSize_))
+            if (useAdaptiveSendWindow)
+            {
+                if (adaptiveSendWindow_.OnAck(ackedCount, ackLatency, config_->AdaptiveSendWindowLatencyThreshold, Stopwatch::Now()) &&
+                    perfCounters_)
+                {
+                    perfCounters_->SendWindowReductionsPerSecond.Increment();
+                }
+
+                sendWindowSize_ = adaptiveSendWindow_.WindowSize;
+            }
+            else if (sendWindowSize_ < static_cast<size_t>(maxSendWindowSize_))
             {
                 // Since the session on the other side is making progress,
                 // allow to send more operations that the current window size.
@@ -769,8 +853,12 @@ void ReliableOperationSender::GetNextSendAndSetTimerCallerHoldsLock(
         ComOperationCPtr opPointer;
             
         // Loop through the operationsToSend and resend the ones that 
-        // have been sent more than the retry interval ago
+        // have been sent more than the retry interval ago.
+        // With the adaptive send window, resends are further limited to
+        // the burst size so that a slow replica is not flooded with retries.
         size_t maxSendOps = 0;
+        size_t resendOps = 0;
+        size_t maxResendOps = adaptiveSendWindowEnabled_ ? adaptiveSendWindow_.BurstSize : sendWindowSize_;
         for (auto it = pendingOperations_.begin(); it != pendingOperations_.end(); ++it)
         {
             if (it->second + config_->RetryInterval <= now)
@@ -780,6 +868,16 @@ void ReliableOperationSender::GetNextSendAndSetTimerCallerHoldsLock(
                     break;
                 }
 
+                if (it->second != DateTime::Zero)
+                {
+                    if (resendOps >= maxResendOps)
+                    {
+                        break;
+                    }
+
+                    ++resendOps;
+                }
+
                 opPointer.SetAndAddRef(it->first);
                 it->second = now;
                 operationsToSend.push_back(move(opPointer));
@@ -787,6 +885,11 @@ void ReliableOperationSender::GetNextSendAndSetTimerCallerHoldsLock(
             }
         }
 
+        if (resendOps > 0 && perfCounters_)
+        {
+            perfCounters_->ResentOperationsPerSecond.IncrementBy(static_cast<Common::PerformanceCounterValue>(resendOps));
+        }
+
         if (operationsToSend.empty())
         {
             ReplicatorEventSource::Events->OpSenderTimer(
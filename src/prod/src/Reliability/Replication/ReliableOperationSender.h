@@ -69,6 +69,9 @@ namespace Reliability
 
             void ResetAverageStatistics();
 
+            // Counters are only updated for senders of replication operations
+            void SetPerformanceCounters(REPerformanceCountersSPtr const & perfCounters);
+
             template <class T>
             void Open(
                 T const & root,
@@ -152,6 +155,12 @@ namespace Reliability
             
             FABRIC_SEQUENCE_NUMBER NotReceivedCountCallerHoldsLock() const;
             FABRIC_SEQUENCE_NUMBER ReceivedAndNotAppliedCountCallerHoldsLock() const;
+
+            bool UseAdaptiveSendWindowCallerHoldsLock();
+            void GetAckedSendLatencyCallerHoldsLock(
+                FABRIC_SEQUENCE_NUMBER ackedReceivedSequenceNumber,
+                __out size_t & ackedCount,
+                __out Common::TimeSpan & latency) const;
             
             REInternalSettingsSPtr const config_;
             ReplicationEndpointId const endpointUniqueId_;
@@ -185,6 +194,12 @@ namespace Reliability
             // the send window size will be increased.
             bool noAckSinceLastCallback_;
 
+            // When EnableAdaptiveSendWindow is set, the send window size is
+            // driven by the ACK latency and rate instead of doubling/halving.
+            AdaptiveSendWindow adaptiveSendWindow_;
+            bool adaptiveSendWindowEnabled_;
+            REPerformanceCountersSPtr perfCounters_;
+
             Common::DateTime lastAckProcessedTime_;
 
             // Bool set to false before opening and after close
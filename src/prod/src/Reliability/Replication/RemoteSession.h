@@ -59,6 +59,8 @@ namespace Reliability
             __declspec (property(get=get_AvgApplyAckDuration)) Common::TimeSpan AvgApplyAckDuration;
             Common::TimeSpan get_AvgApplyAckDuration() const { return replicationOperations_.AverageApplyAckDuration; }
 
+            void SetPerformanceCounters(REPerformanceCountersSPtr const & perfCounters) { replicationOperations_.SetPerformanceCounters(perfCounters); }
+
             Common::AsyncOperationSPtr BeginEstablishCopy(
                 FABRIC_SEQUENCE_NUMBER replicationStartSeq,
                 bool hasPersistedState,
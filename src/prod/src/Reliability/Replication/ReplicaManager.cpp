@@ -1212,6 +1212,7 @@ ReplicationSessionSPtr ReplicaManager::CreateReplica(
 
     ReplicationSessionSPtr session = std::make_shared<ReplicationSession>(
         config_, partition_, replica.Id, replica.ReplicatorAddress, replica.TransportEndpointId, replica.CurrentProgress, endpointUniqueId_, partitionId_, epoch_, apiMonitor_, transport_);
+    session->SetPerformanceCounters(perfCounters_);
     session->Open();
     
     return session;
@@ -39,8 +39,10 @@
 #include "Reliability/Replication/ComProxyStateProvider.h"
 #include "Reliability/Replication/ReplicatorState.h"
 #include "Reliability/Replication/DecayAverage.h"
+#include "Reliability/Replication/AdaptiveSendWindow.h"
 #include "Reliability/Replication/ReliableOperationSender.h"
 #include "Reliability/Replication/CopySender.h"
+#include "Reliability/Replication/OperationRingBuffer.h"
 #include "Reliability/Replication/OperationQueue.h"
 #include "Reliability/Replication/ReplicationQueueManager.h"
 #include "Reliability/Replication/standarddeviation.h"
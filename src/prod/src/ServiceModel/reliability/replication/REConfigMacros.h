@@ -10,7 +10,7 @@ namespace Reliability
     namespace ReplicationComponent
     {
 #define RE_GLOBAL_STATIC_SETTINGS_COUNT 0
-#define RE_GLOBAL_DYNAMIC_SETTINGS_COUNT 20
+#define RE_GLOBAL_DYNAMIC_SETTINGS_COUNT 22
 
 #define RE_GLOBAL_SETTINGS_COUNT RE_GLOBAL_STATIC_SETTINGS_COUNT + RE_GLOBAL_DYNAMIC_SETTINGS_COUNT
 
@@ -60,6 +60,10 @@ namespace Reliability
             Common::TimeSpan get_IdleReplicaMaxLagDurationBeforePromotion() const ;\
             __declspec(property(get=get_SecondaryReplicatorBatchTracingArraySize)) int64 SecondaryReplicatorBatchTracingArraySize ; \
             int64 get_SecondaryReplicatorBatchTracingArraySize() const; \
+            __declspec(property(get=get_EnableAdaptiveSendWindow)) bool EnableAdaptiveSendWindow; \
+            bool get_EnableAdaptiveSendWindow() const; \
+            __declspec(property(get=get_AdaptiveSendWindowLatencyThreshold)) double AdaptiveSendWindowLatencyThreshold ; \
+            double get_AdaptiveSendWindowLatencyThreshold() const; \
 
 // This macro defines all the settings in the replicator config that are overridable by the user using the CreateReplicator() API
 #define DECLARE_RE_OVERRIDABLE_SETTINGS_PROPERTIES() \
@@ -176,6 +180,8 @@ namespace Reliability
             INTERNAL_CONFIG_ENTRY(double, section_name, SecondaryProgressRateDecayFactor, 0.5, Common::ConfigEntryUpgradePolicy::Dynamic); \
             INTERNAL_CONFIG_ENTRY(Common::TimeSpan, section_name, IdleReplicaMaxLagDurationBeforePromotion, Common::TimeSpan::FromSeconds(60), Common::ConfigEntryUpgradePolicy::Dynamic); \
             INTERNAL_CONFIG_ENTRY(uint, section_name, SecondaryReplicatorBatchTracingArraySize, 32, Common::ConfigEntryUpgradePolicy::Dynamic); \
+            INTERNAL_CONFIG_ENTRY(bool, section_name, EnableAdaptiveSendWindow, false, Common::ConfigEntryUpgradePolicy::Dynamic); \
+            INTERNAL_CONFIG_ENTRY(double, section_name, AdaptiveSendWindowLatencyThreshold, 2.0, Common::ConfigEntryUpgradePolicy::Dynamic); \
 
 // -----------------------------------------------------------------------------------------
             // NOTE - Update the list of configs in ReplicatorSettings.cpp when new configs that 
@@ -225,6 +231,8 @@ namespace Reliability
             DEPRECATED_CONFIG_ENTRY(double, section_name, SecondaryProgressRateDecayFactor, 0.5, Common::ConfigEntryUpgradePolicy::Dynamic); \
             DEPRECATED_CONFIG_ENTRY(Common::TimeSpan, section_name, IdleReplicaMaxLagDurationBeforePromotion, Common::TimeSpan::FromSeconds(60), Common::ConfigEntryUpgradePolicy::Dynamic); \
             DEPRECATED_CONFIG_ENTRY(uint, section_name, SecondaryReplicatorBatchTracingArraySize, 32, Common::ConfigEntryUpgradePolicy::Dynamic); \
+            DEPRECATED_CONFIG_ENTRY(bool, section_name, EnableAdaptiveSendWindow, false, Common::ConfigEntryUpgradePolicy::Dynamic); \
+            DEPRECATED_CONFIG_ENTRY(double, section_name, AdaptiveSendWindowLatencyThreshold, 2.0, Common::ConfigEntryUpgradePolicy::Dynamic); \
             \
             \
             DEFINE_GETCONFIG_METHOD()
@@ -40,6 +40,7 @@ namespace Store
     public:
         ComCopyOperationContext(__in ComCopyOperationEnumerator & owner)
             : copyOperation_()
+            , fileStreamChunkSize_(0)
             , waitForLsnRetryCount_(0)
             , stopwatch_()
         {
@@ -87,7 +88,10 @@ namespace Store
         void ScheduleGetFileStreamFullCopyContext(AsyncOperationSPtr const &);
         void GetFileStreamFullCopyContext(AsyncOperationSPtr const &);
         void OnGetFileStreamFullCopyContextComplete(AsyncOperationSPtr const &, bool expectedCompletedSynchronously);
-        ErrorCode ReadNextFileStreamChunk(bool isFirstChunk);
+        void ReadNextFileStreamChunk(AsyncOperationSPtr const &, bool isFirstChunk);
+        void OnReadNextFileStreamChunkComplete(AsyncOperationSPtr const &, bool isFirstChunk, bool expectedCompletedSynchronously);
+        ErrorCode OnFileStreamChunkRead(bool isFirstChunk, unique_ptr<FileStreamCopyOperationData> &&);
+        void CompleteFileStreamChunk(AsyncOperationSPtr const &, ErrorCode const &);
 
         ErrorCode EnumerateCopyOperations(
             ILocalStore::TransactionSPtr const & txSPtr,
@@ -125,6 +129,7 @@ namespace Store
 
         ComPointer<ComCopyOperationEnumerator> owner_;
         CopyOperation copyOperation_;
+        size_t fileStreamChunkSize_;
         int waitForLsnRetryCount_;
         Stopwatch stopwatch_;
     };
@@ -413,9 +418,7 @@ namespace Store
         }
         else if (owner_->isFileStreamFullCopy_)
         {
-            auto error = ReadNextFileStreamChunk(false); // isFirstChunk
-
-            this->TryComplete(proxySPtr, error);
+            this->ReadNextFileStreamChunk(proxySPtr, false); // isFirstChunk
         }
         else
         {
@@ -929,7 +932,9 @@ namespace Store
 
         if (error.IsSuccess())
         {
-            error = this->ReadNextFileStreamChunk(true); // isFirstChunk
+            this->ReadNextFileStreamChunk(thisSPtr, true); // isFirstChunk
+
+            return;
         }
         else if (error.IsError(ErrorCodeValue::MaxFileStreamFullCopyWaiters))
         {
@@ -963,26 +968,84 @@ namespace Store
         this->TryComplete(thisSPtr, error);
     }
 
-    ErrorCode ComCopyOperationEnumerator::ComCopyOperationContext::ReadNextFileStreamChunk(bool isFirstChunk)
+    void ComCopyOperationEnumerator::ComCopyOperationContext::CompleteFileStreamChunk(
+        AsyncOperationSPtr const & thisSPtr,
+        ErrorCode const & error)
     {
+        auto delay = TimeSpan::Zero;
+
+        if (error.IsSuccess() && fileStreamChunkSize_ > 0)
+        {
+            delay = FileStreamFullCopyThrottle::GetThrottle().ReserveChunk(fileStreamChunkSize_);
+        }
+
+        if (delay <= TimeSpan::Zero)
+        {
+            this->TryComplete(thisSPtr, error);
+
+            return;
+        }
+
+        WriteNoise(
+            TraceComponent,
+            "{0} throttling file stream chunk: bytes={1} delay={2}",
+            owner_->TraceId,
+            fileStreamChunkSize_,
+            delay);
+
+        auto root = owner_->root_->CreateAsyncOperationRoot();
+        Threadpool::Post(
+            [this, thisSPtr, root, error]() { this->TryComplete(thisSPtr, error); },
+            delay);
+    }
+
+    void ComCopyOperationEnumerator::ComCopyOperationContext::ReadNextFileStreamChunk(
+        AsyncOperationSPtr const & thisSPtr,
+        bool isFirstChunk)
+    {
+        fileStreamChunkSize_ = 0;
+
         if (!owner_->fileStreamFullCopyContextSPtr_)
         {
             TRACE_ERROR_AND_TESTASSERT(TraceComponent, "{0}: FileStreamFullCopyContext is null", owner_->TraceId);
 
-            return ErrorCodeValue::Success;
+            this->CompleteFileStreamChunk(thisSPtr, ErrorCodeValue::Success);
+
+            return;
         }
 
-        unique_ptr<FileStreamCopyOperationData> fileStreamDataUPtr;
-        auto error = owner_->fileStreamFullCopyContextSPtr_->ReadNextFileStreamChunk(
+        auto operation = owner_->fileStreamFullCopyContextSPtr_->BeginReadNextFileStreamChunk(
             isFirstChunk,
             owner_->replicatedStore_.TargetCopyOperationSize,
-            fileStreamDataUPtr);
+            [this, isFirstChunk](AsyncOperationSPtr const & operation) { this->OnReadNextFileStreamChunkComplete(operation, isFirstChunk, false); },
+            thisSPtr);
+        this->OnReadNextFileStreamChunkComplete(operation, isFirstChunk, true);
+    }
 
-        if (!error.IsSuccess())
+    void ComCopyOperationEnumerator::ComCopyOperationContext::OnReadNextFileStreamChunkComplete(
+        AsyncOperationSPtr const & operation,
+        bool isFirstChunk,
+        bool expectedCompletedSynchronously)
+    {
+        if (operation->CompletedSynchronously != expectedCompletedSynchronously) { return; }
+
+        unique_ptr<FileStreamCopyOperationData> fileStreamDataUPtr;
+        auto error = owner_->fileStreamFullCopyContextSPtr_->EndReadNextFileStreamChunk(operation, fileStreamDataUPtr);
+
+        if (error.IsSuccess())
         {
-            return error;
+            error = this->OnFileStreamChunkRead(isFirstChunk, move(fileStreamDataUPtr));
         }
 
+        this->CompleteFileStreamChunk(operation->Parent, error);
+    }
+
+    ErrorCode ComCopyOperationEnumerator::ComCopyOperationContext::OnFileStreamChunkRead(
+        bool isFirstChunk,
+        unique_ptr<FileStreamCopyOperationData> && fileStreamDataUPtr)
+    {
+        ErrorCode error(ErrorCodeValue::Success);
+
         if (fileStreamDataUPtr)
         {
             auto copyType = owner_->replicatedStore_.Settings.FullCopyMode;
@@ -1006,6 +1069,8 @@ namespace Store
                 }
             }
 
+            fileStreamChunkSize_ = fileStreamDataUPtr->DataSize;
+
             copyOperation_ = CopyOperation(move(fileStreamDataUPtr), isRebuildMode);
         }
         else
@@ -33,6 +33,9 @@ namespace Store
         __declspec(property(get=get_IsLastChunk)) bool IsLastChunk;
         bool get_IsLastChunk() const { return isLastChunk_; }
 
+        __declspec(property(get=get_DataSize)) size_t DataSize;
+        size_t get_DataSize() const { return data_.size(); }
+
         Common::ErrorCode TakeData(__out std::vector<byte> & data)
         {
             data = std::move(data_);
@@ -0,0 +1,187 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace Store
+{
+    using namespace Common;
+    using namespace std;
+
+    class FileStreamFullCopyContextTest
+    {
+    protected:
+
+        FileStreamFullCopyContextTest() { BOOST_REQUIRE(MethodSetup()); }
+        TEST_METHOD_SETUP(MethodSetup);
+
+        ~FileStreamFullCopyContextTest() { BOOST_REQUIRE(MethodCleanup()); }
+        TEST_METHOD_CLEANUP(MethodCleanup);
+
+        void ReadAllChunks(size_t targetCopyOperationSize);
+
+        wstring fileName_;
+        vector<byte> fileData_;
+        bool enableReadAhead_;
+        int throttleInMBPerSecond_;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(FileStreamFullCopyContextTestSuite, FileStreamFullCopyContextTest)
+
+    BOOST_AUTO_TEST_CASE(ReadChunksTest)
+    {
+        StoreConfig::GetConfig().EnableFileStreamFullCopyReadAhead = false;
+
+        ReadAllChunks(100 * 1024);
+        ReadAllChunks(fileData_.size() * 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(ReadAheadTest)
+    {
+        // Every chunk after the first is read on the threadpool while the previous one is returned.
+        // The chunks must come back complete and in order whether or not the read-ahead finished
+        // before the next chunk was requested.
+        StoreConfig::GetConfig().EnableFileStreamFullCopyReadAhead = true;
+
+        ReadAllChunks(100 * 1024);
+        ReadAllChunks(64 * 1024);
+        ReadAllChunks(fileData_.size() * 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrottleTest)
+    {
+        size_t const chunkSize = 512 * 1024;
+
+        {
+            StoreConfig::GetConfig().FileStreamFullCopyThrottleInMBPerSecond = 0;
+
+            FileStreamFullCopyThrottle throttle;
+            VERIFY_ARE_EQUAL(TimeSpan::Zero, throttle.ReserveChunk(chunkSize));
+            VERIFY_ARE_EQUAL(TimeSpan::Zero, throttle.ReserveChunk(chunkSize));
+        }
+
+        {
+            StoreConfig::GetConfig().FileStreamFullCopyThrottleInMBPerSecond = 1;
+
+            FileStreamFullCopyThrottle throttle;
+
+            // The first chunk is sent immediately, each following chunk waits for the ones reserved before it
+            VERIFY_ARE_EQUAL(TimeSpan::Zero, throttle.ReserveChunk(chunkSize));
+
+            auto delay = throttle.ReserveChunk(chunkSize);
+            VERIFY_IS_TRUE(delay > TimeSpan::FromMilliseconds(400) && delay <= TimeSpan::FromMilliseconds(500));
+
+            delay = throttle.ReserveChunk(chunkSize);
+            VERIFY_IS_TRUE(delay > TimeSpan::FromMilliseconds(900) && delay <= TimeSpan::FromMilliseconds(1000));
+
+            // Unused budget does not accumulate while idle
+            Sleep(1500);
+            VERIFY_ARE_EQUAL(TimeSpan::Zero, throttle.ReserveChunk(chunkSize));
+
+            delay = throttle.ReserveChunk(chunkSize);
+            VERIFY_IS_TRUE(delay > TimeSpan::FromMilliseconds(400) && delay <= TimeSpan::FromMilliseconds(500));
+        }
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    void FileStreamFullCopyContextTest::ReadAllChunks(size_t targetCopyOperationSize)
+    {
+        File file;
+        auto error = file.TryOpen(fileName_, FileMode::Open, FileAccess::Read, FileShare::Read, FileAttributes::Normal);
+        VERIFY_IS_TRUE(error.IsSuccess());
+
+        auto context = make_shared<FileStreamFullCopyContext>(
+            ReplicaActivityId(PartitionedReplicaId(Guid::NewGuid(), 1), ActivityId()),
+            move(file),
+            1, // lsn
+            static_cast<int64>(fileData_.size()));
+
+        vector<byte> received;
+        bool isFirstChunk = true;
+        bool isLastChunk = false;
+
+        while (true)
+        {
+            ManualResetEvent completed(false);
+            unique_ptr<FileStreamCopyOperationData> chunk;
+
+            context->BeginReadNextFileStreamChunk(
+                isFirstChunk,
+                targetCopyOperationSize,
+                [&context, &chunk, &error, &completed](AsyncOperationSPtr const & operation)
+                {
+                    error = context->EndReadNextFileStreamChunk(operation, chunk);
+                    completed.Set();
+                },
+                AsyncOperationSPtr());
+
+            VERIFY_IS_TRUE(completed.WaitOne(TimeSpan::FromSeconds(30)));
+            VERIFY_IS_TRUE(error.IsSuccess());
+
+            if (!chunk)
+            {
+                break;
+            }
+
+            VERIFY_IS_FALSE(isLastChunk);
+            VERIFY_ARE_EQUAL(isFirstChunk, chunk->IsFirstChunk);
+            VERIFY_IS_TRUE(chunk->DataSize > 0 && chunk->DataSize <= targetCopyOperationSize);
+
+            isFirstChunk = false;
+            isLastChunk = chunk->IsLastChunk;
+
+            vector<byte> data;
+            chunk->TakeData(data);
+            received.insert(received.end(), data.begin(), data.end());
+        }
+
+        VERIFY_IS_TRUE(isLastChunk);
+        VERIFY_IS_TRUE(received == fileData_);
+    }
+
+    bool FileStreamFullCopyContextTest::MethodSetup()
+    {
+        enableReadAhead_ = StoreConfig::GetConfig().EnableFileStreamFullCopyReadAhead;
+        throttleInMBPerSecond_ = StoreConfig::GetConfig().FileStreamFullCopyThrottleInMBPerSecond;
+
+        // Not a multiple of the 64KB read size, so that the last chunk is partial
+        Random random(0);
+        fileData_.resize(5 * 64 * 1024 + 123);
+        for (auto & value : fileData_)
+        {
+            value = static_cast<byte>(random.Next(256));
+        }
+
+        fileName_ = L"FileStreamFullCopyContext.Test.dat";
+
+        File file;
+        auto error = file.TryOpen(fileName_, FileMode::Create, FileAccess::Write, FileShare::None, FileAttributes::Normal);
+        if (!error.IsSuccess())
+        {
+            return false;
+        }
+
+        DWORD bytesWritten = 0;
+        error = file.TryWrite2(fileData_.data(), static_cast<int>(fileData_.size()), bytesWritten);
+        if (!error.IsSuccess() || bytesWritten != fileData_.size())
+        {
+            return false;
+        }
+
+        return file.Close2().IsSuccess();
+    }
+
+    bool FileStreamFullCopyContextTest::MethodCleanup()
+    {
+        StoreConfig::GetConfig().EnableFileStreamFullCopyReadAhead = enableReadAhead_;
+        StoreConfig::GetConfig().FileStreamFullCopyThrottleInMBPerSecond = throttleInMBPerSecond_;
+
+        return File::Delete2(fileName_).IsSuccess();
+    }
+}
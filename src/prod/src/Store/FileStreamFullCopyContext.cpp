@@ -22,64 +22,175 @@ FileStreamFullCopyContext::FileStreamFullCopyContext(
     , lsn_(lsn)
     , fileSize_(fileSize)
     , totalBytesRead_(0)
+    , readAhead_()
 {
+#if defined(PLATFORM_UNIX)
+    // Let the kernel read ahead aggressively since the archive is always read sequentially
+    //
+    posix_fadvise(static_cast<int>(reinterpret_cast<intptr_t>(file_.GetHandle())), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
 }
 
-ErrorCode FileStreamFullCopyContext::ReadNextFileStreamChunk(
-    bool isFirstChunk, 
-    size_t targetCopyOperationSize,
-    __out unique_ptr<FileStreamCopyOperationData> & result)
+//
+// *** ReadNextFileStreamChunkAsyncOperation
+//
+
+class FileStreamFullCopyContext::ReadNextFileStreamChunkAsyncOperation : public AsyncOperation
 {
-    result = nullptr;
+public:
+    ReadNextFileStreamChunkAsyncOperation(
+        FileStreamFullCopyContextSPtr const & owner,
+        bool isFirstChunk,
+        size_t targetCopyOperationSize,
+        AsyncCallback const & callback,
+        AsyncOperationSPtr const & parent)
+        : AsyncOperation(callback, parent)
+        , owner_(owner)
+        , isFirstChunk_(isFirstChunk)
+        , targetCopyOperationSize_(targetCopyOperationSize)
+        , result_()
+    {
+    }
+
+    static ErrorCode End(AsyncOperationSPtr const & operation, __out unique_ptr<FileStreamCopyOperationData> & result)
+    {
+        auto casted = AsyncOperation::End<ReadNextFileStreamChunkAsyncOperation>(operation);
+
+        if (casted->Error.IsSuccess())
+        {
+            result = move(casted->result_);
+        }
 
-    if (totalBytesRead_ >= fileSize_)
+        return casted->Error;
+    }
+
+protected:
+
+    void OnStart(AsyncOperationSPtr const & thisSPtr)
     {
-        auto error = file_.Close2();
-        
-        if (error.IsSuccess()) 
-        { 
-            WriteInfo(
-                TraceComponent, 
-                "{0}: closed {1}",
-                this->TraceId,
-                file_.FileName);
+        if (owner_->totalBytesRead_ >= owner_->fileSize_)
+        {
+            this->TryComplete(thisSPtr, owner_->CloseFile());
+
+            return;
+        }
+
+        auto chunkSize = GetAlignedChunkSize(targetCopyOperationSize_);
+
+        if (owner_->readAhead_)
+        {
+            // Continue on the read-ahead thread rather than waiting for it
+            //
+            auto readAhead = move(owner_->readAhead_);
+
+            readAhead->OnCompleted([this, thisSPtr, readAhead, chunkSize]()
+            {
+                this->OnChunkRead(thisSPtr, chunkSize, readAhead->Error, move(readAhead->Buffer));
+            });
         }
         else
         {
-            WriteWarning(
-                TraceComponent, 
-                "{0}: failed to close {1}: error={2}",
-                this->TraceId,
-                file_.FileName,
-                error);
+            vector<byte> buffer;
+            auto error = owner_->ReadChunk(chunkSize, buffer);
+
+            this->OnChunkRead(thisSPtr, chunkSize, error, move(buffer));
         }
+    }
 
-        return error;
+private:
+
+    void OnChunkRead(
+        AsyncOperationSPtr const & thisSPtr,
+        size_t chunkSize,
+        ErrorCode const & readError,
+        vector<byte> && buffer)
+    {
+        auto error = owner_->OnChunkRead(isFirstChunk_, chunkSize, readError, move(buffer), result_);
+
+        this->TryComplete(thisSPtr, error);
     }
 
-    vector<byte> buffer;
-    buffer.resize(targetCopyOperationSize);
-    DWORD bytesRead = 0;
+    FileStreamFullCopyContextSPtr owner_;
+    bool isFirstChunk_;
+    size_t targetCopyOperationSize_;
+    unique_ptr<FileStreamCopyOperationData> result_;
+};
 
-    auto error = file_.TryRead2(buffer.data(), static_cast<int>(buffer.size()), bytesRead);
+//
+// *** FileStreamFullCopyContext
+//
 
-    if (!error.IsSuccess()) 
+AsyncOperationSPtr FileStreamFullCopyContext::BeginReadNextFileStreamChunk(
+    bool isFirstChunk, 
+    size_t targetCopyOperationSize,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    return AsyncOperation::CreateAndStart<ReadNextFileStreamChunkAsyncOperation>(
+        this->shared_from_this(),
+        isFirstChunk,
+        targetCopyOperationSize,
+        callback,
+        parent);
+}
+
+ErrorCode FileStreamFullCopyContext::EndReadNextFileStreamChunk(
+    AsyncOperationSPtr const & operation,
+    __out unique_ptr<FileStreamCopyOperationData> & result)
+{
+    result = nullptr;
+
+    return ReadNextFileStreamChunkAsyncOperation::End(operation, result);
+}
+
+ErrorCode FileStreamFullCopyContext::CloseFile()
+{
+    auto error = file_.Close2();
+    
+    if (error.IsSuccess()) 
     { 
+        WriteInfo(
+            TraceComponent, 
+            "{0}: closed {1}",
+            this->TraceId,
+            file_.FileName);
+    }
+    else
+    {
         WriteWarning(
             TraceComponent, 
-            "{0}: failed to read {1}: error={2}",
+            "{0}: failed to close {1}: error={2}",
             this->TraceId,
             file_.FileName,
             error);
-
-        return error; 
     }
 
-    if (buffer.size() > bytesRead)
-    {
-        buffer.resize(bytesRead);
+    return error;
+}
+
+ErrorCode FileStreamFullCopyContext::OnChunkRead(
+    bool isFirstChunk,
+    size_t chunkSize,
+    ErrorCode const & readError,
+    vector<byte> && buffer,
+    __out unique_ptr<FileStreamCopyOperationData> & result)
+{
+    result = nullptr;
+
+    if (!readError.IsSuccess()) 
+    { 
+        WriteWarning(
+            TraceComponent, 
+            "{0}: failed to read {1}: error={2}",
+            this->TraceId,
+            file_.FileName,
+            readError);
+
+        return readError; 
     }
 
+    DWORD bytesRead = static_cast<DWORD>(buffer.size());
+
     totalBytesRead_ += bytesRead;
 
     WriteNoise(
@@ -87,7 +198,7 @@ ErrorCode FileStreamFullCopyContext::ReadNextFileStreamChunk(
         "{0}: read file stream chunk (bytes): read={1}/{2} total={3}/{4}",
         this->TraceId,
         bytesRead,
-        targetCopyOperationSize,
+        chunkSize,
         totalBytesRead_,
         fileSize_);
 
@@ -103,6 +214,11 @@ ErrorCode FileStreamFullCopyContext::ReadNextFileStreamChunk(
 
     bool isLastChunk = (totalBytesRead_ >= fileSize_);
 
+    if (!isLastChunk && bytesRead > 0 && StoreConfig::GetConfig().EnableFileStreamFullCopyReadAhead)
+    {
+        this->StartReadAhead(chunkSize);
+    }
+
     result = make_unique<FileStreamCopyOperationData>(
         isFirstChunk,
         move(buffer),
@@ -110,3 +226,88 @@ ErrorCode FileStreamFullCopyContext::ReadNextFileStreamChunk(
 
     return ErrorCodeValue::Success;
 }
+
+size_t FileStreamFullCopyContext::GetAlignedChunkSize(size_t targetCopyOperationSize)
+{
+    // Read in multiples of 64KB to keep reads aligned on the underlying storage
+    //
+    size_t const alignment = 64 * 1024;
+
+    if (targetCopyOperationSize <= alignment)
+    {
+        return targetCopyOperationSize;
+    }
+
+    return (targetCopyOperationSize / alignment) * alignment;
+}
+
+ErrorCode FileStreamFullCopyContext::ReadChunk(size_t chunkSize, __out vector<byte> & buffer)
+{
+    buffer.resize(chunkSize);
+    DWORD bytesRead = 0;
+
+    auto error = file_.TryRead2(buffer.data(), static_cast<int>(buffer.size()), bytesRead);
+
+    if (!error.IsSuccess()) 
+    { 
+        buffer.clear();
+
+        return error; 
+    }
+
+    if (buffer.size() > bytesRead)
+    {
+        buffer.resize(bytesRead);
+    }
+
+    return ErrorCodeValue::Success;
+}
+
+void FileStreamFullCopyContext::StartReadAhead(size_t chunkSize)
+{
+    auto readAhead = make_shared<ReadAheadChunk>();
+    readAhead_ = readAhead;
+
+    auto thisSPtr = this->shared_from_this();
+
+    Threadpool::Post([thisSPtr, readAhead, chunkSize]()
+    {
+        readAhead->Error = thisSPtr->ReadChunk(chunkSize, readAhead->Buffer);
+
+        readAhead->Complete();
+    });
+}
+
+void FileStreamFullCopyContext::ReadAheadChunk::OnCompleted(function<void()> && continuation)
+{
+    {
+        AcquireExclusiveLock lock(lock_);
+
+        if (!isCompleted_)
+        {
+            continuation_ = move(continuation);
+
+            return;
+        }
+    }
+
+    continuation();
+}
+
+void FileStreamFullCopyContext::ReadAheadChunk::Complete()
+{
+    function<void()> continuation;
+
+    {
+        AcquireExclusiveLock lock(lock_);
+
+        isCompleted_ = true;
+
+        continuation = move(continuation_);
+    }
+
+    if (continuation)
+    {
+        continuation();
+    }
+}
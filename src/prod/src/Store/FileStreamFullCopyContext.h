@@ -7,7 +7,9 @@
 
 namespace Store
 {
-    class FileStreamFullCopyContext : public ReplicaActivityTraceComponent<Common::TraceTaskCodes::ReplicatedStore>
+    class FileStreamFullCopyContext 
+        : public std::enable_shared_from_this<FileStreamFullCopyContext>
+        , public ReplicaActivityTraceComponent<Common::TraceTaskCodes::ReplicatedStore>
     {
     public:
         FileStreamFullCopyContext(
@@ -19,17 +21,63 @@ namespace Store
         __declspec(property(get=get_Lsn)) ::FABRIC_SEQUENCE_NUMBER Lsn;
         ::FABRIC_SEQUENCE_NUMBER get_Lsn() const { return lsn_; }
 
-        Common::ErrorCode ReadNextFileStreamChunk(
+        // Completes without blocking a thread on a pending read-ahead. The result
+        // is null once the whole file has been read and the file is closed.
+        //
+        Common::AsyncOperationSPtr BeginReadNextFileStreamChunk(
             bool isFirstChunk, 
             size_t targetCopyOperationSize,
+            Common::AsyncCallback const &,
+            Common::AsyncOperationSPtr const &);
+
+        Common::ErrorCode EndReadNextFileStreamChunk(
+            Common::AsyncOperationSPtr const &,
             __out std::unique_ptr<FileStreamCopyOperationData> &);
 
     private:
+        class ReadNextFileStreamChunkAsyncOperation;
+
+        // Holds the next chunk, which is read on a threadpool thread while the
+        // current chunk is being sent (EnableFileStreamFullCopyReadAhead)
+        //
+        class ReadAheadChunk
+        {
+        public:
+            ReadAheadChunk() : Error(), Buffer(), lock_(), isCompleted_(false), continuation_() { }
+
+            // Runs the continuation on the calling thread if the read has already
+            // completed, otherwise on the threadpool thread once it completes
+            //
+            void OnCompleted(std::function<void()> && continuation);
+            void Complete();
+
+            Common::ErrorCode Error;
+            std::vector<byte> Buffer;
+
+        private:
+            Common::ExclusiveLock lock_;
+            bool isCompleted_;
+            std::function<void()> continuation_;
+        };
+
+        static size_t GetAlignedChunkSize(size_t targetCopyOperationSize);
+
+        Common::ErrorCode CloseFile();
+        Common::ErrorCode ReadChunk(size_t chunkSize, __out std::vector<byte> & buffer);
+        Common::ErrorCode OnChunkRead(
+            bool isFirstChunk,
+            size_t chunkSize,
+            Common::ErrorCode const & readError,
+            std::vector<byte> && buffer,
+            __out std::unique_ptr<FileStreamCopyOperationData> &);
+        void StartReadAhead(size_t chunkSize);
+
         std::wstring traceId_;
         Common::File file_;
         ::FABRIC_SEQUENCE_NUMBER lsn_;
         int64 fileSize_;
         int64 totalBytesRead_;
+        std::shared_ptr<ReadAheadChunk> readAhead_;
     };
 
     typedef std::shared_ptr<FileStreamFullCopyContext> FileStreamFullCopyContextSPtr;
@@ -552,7 +552,7 @@ private:
         {
             // Schedule thread for each waiter since TryAttachToExistingArchiveFile may
             // complete into ComCopyOperationEnumerator, which will then call back into
-            // FileStreamFullCopyContext::ReadNextFileStreamChunk. We want to dispatch
+            // FileStreamFullCopyContext::BeginReadNextFileStreamChunk. We want to dispatch
             // these subsequent copies to occur in parallel without blocking on reading
             // any file chunks.
             //
@@ -0,0 +1,53 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+using namespace Common;
+using namespace std;
+using namespace Store;
+
+FileStreamFullCopyThrottle::FileStreamFullCopyThrottle()
+    : lock_()
+    , nextAvailableTime_()
+{
+}
+
+FileStreamFullCopyThrottle & FileStreamFullCopyThrottle::GetThrottle()
+{
+    static FileStreamFullCopyThrottle throttle;
+
+    return throttle;
+}
+
+TimeSpan FileStreamFullCopyThrottle::ReserveChunk(size_t chunkSize)
+{
+    int64 bytesPerSecond = static_cast<int64>(StoreConfig::GetConfig().FileStreamFullCopyThrottleInMBPerSecond) * 1024 * 1024;
+
+    if (bytesPerSecond <= 0)
+    {
+        return TimeSpan::Zero;
+    }
+
+    auto duration = TimeSpan::FromTicks(static_cast<int64>(
+        static_cast<double>(chunkSize) * TimeSpan::TicksPerSecond / bytesPerSecond));
+
+    AcquireExclusiveLock lock(lock_);
+
+    auto now = Stopwatch::Now();
+
+    // Unused budget does not accumulate while idle
+    //
+    if (nextAvailableTime_ < now)
+    {
+        nextAvailableTime_ = now;
+    }
+
+    auto delay = nextAvailableTime_ - now;
+
+    nextAvailableTime_ += duration;
+
+    return delay;
+}
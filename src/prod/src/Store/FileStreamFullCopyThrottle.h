@@ -0,0 +1,32 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Store
+{
+    // Process-wide bandwidth budget shared by all file stream full copies sent from this process,
+    // so that many concurrent builds (e.g. after an upgrade domain walk) do not saturate the disk.
+    // Each chunk reserves its bytes against the budget and is delayed until the budget allows it.
+    //
+    class FileStreamFullCopyThrottle
+    {
+        DENY_COPY(FileStreamFullCopyThrottle);
+
+    public:
+        FileStreamFullCopyThrottle();
+
+        static FileStreamFullCopyThrottle & GetThrottle();
+
+        // Returns the delay before a chunk of the given size may be sent.
+        // Zero if throttling is disabled (FileStreamFullCopyThrottleInMBPerSecond <= 0).
+        //
+        Common::TimeSpan ReserveChunk(size_t chunkSize);
+
+    private:
+        Common::ExclusiveLock lock_;
+        Common::StopwatchTime nextAvailableTime_;
+    };
+}
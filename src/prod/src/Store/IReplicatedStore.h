@@ -115,6 +115,169 @@ namespace Store
             __in std::wstring const & key,
             __in _int64 checkOperationNumber = ILocalStore::SequenceNumberIgnore) = 0;
 
+    public:
+
+        //
+        // Asynchronous ReadExact, Insert, Update and Delete. Stores backed by an asynchronous
+        // engine override these so that callers do not block a thread while the operation waits
+        // on locks or I/O. The defaults complete synchronously by calling the synchronous methods.
+        //
+        // Value buffers passed to Begin* are copied before Begin* returns.
+        //
+
+        class ReadExactAsyncOperation : public Common::AsyncOperation
+        {
+            DENY_COPY(ReadExactAsyncOperation)
+
+        public:
+            ReadExactAsyncOperation(
+                Common::AsyncCallback const & callback,
+                Common::AsyncOperationSPtr const & parent)
+                : Common::AsyncOperation(callback, parent)
+                , value_()
+                , operationLsn_(0)
+            {
+            }
+
+            static Common::ErrorCode End(
+                Common::AsyncOperationSPtr const & operation,
+                __out std::vector<byte> & value,
+                __out __int64 & operationLsn)
+            {
+                auto casted = Common::AsyncOperation::End<ReadExactAsyncOperation>(operation);
+                if (casted->Error.IsSuccess())
+                {
+                    value = std::move(casted->value_);
+                    operationLsn = casted->operationLsn_;
+                }
+                return casted->Error;
+            }
+
+            void Complete(
+                Common::AsyncOperationSPtr const & thisSPtr,
+                Common::ErrorCode const & error,
+                std::vector<byte> && value,
+                __int64 operationLsn)
+            {
+                value_ = std::move(value);
+                operationLsn_ = operationLsn;
+                this->TryComplete(thisSPtr, error);
+            }
+
+        protected:
+            void OnStart(Common::AsyncOperationSPtr const &) override { }
+
+        private:
+            std::vector<byte> value_;
+            __int64 operationLsn_;
+        };
+
+        class WriteAsyncOperation : public Common::AsyncOperation
+        {
+            DENY_COPY(WriteAsyncOperation)
+
+        public:
+            WriteAsyncOperation(
+                Common::AsyncCallback const & callback,
+                Common::AsyncOperationSPtr const & parent)
+                : Common::AsyncOperation(callback, parent)
+            {
+            }
+
+            static Common::ErrorCode End(Common::AsyncOperationSPtr const & operation)
+            {
+                return Common::AsyncOperation::End<WriteAsyncOperation>(operation)->Error;
+            }
+
+        protected:
+            void OnStart(Common::AsyncOperationSPtr const &) override { }
+        };
+
+        virtual Common::AsyncOperationSPtr BeginReadExact(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent)
+        {
+            std::vector<byte> value;
+            __int64 operationLsn = 0;
+            auto error = this->ReadExact(transaction, type, key, value, operationLsn);
+
+            auto operation = Common::AsyncOperation::CreateAndStart<ReadExactAsyncOperation>(callback, parent);
+            Common::AsyncOperation::Get<ReadExactAsyncOperation>(operation)->Complete(operation, error, std::move(value), operationLsn);
+            return operation;
+        }
+
+        virtual Common::ErrorCode EndReadExact(
+            Common::AsyncOperationSPtr const & operation,
+            __out std::vector<byte> & value,
+            __out __int64 & operationLsn)
+        {
+            return ReadExactAsyncOperation::End(operation, value, operationLsn);
+        }
+
+        virtual Common::AsyncOperationSPtr BeginInsert(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in void const * value,
+            __in size_t valueSizeInBytes,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent)
+        {
+            auto error = this->Insert(transaction, type, key, value, valueSizeInBytes);
+            return CreateCompletedWriteOperation(error, callback, parent);
+        }
+
+        virtual Common::AsyncOperationSPtr BeginUpdate(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 checkOperationNumber,
+            __in std::wstring const & newKey,
+            __in_opt void const * newValue,
+            __in size_t valueSizeInBytes,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent)
+        {
+            auto error = this->Update(transaction, type, key, checkOperationNumber, newKey, newValue, valueSizeInBytes);
+            return CreateCompletedWriteOperation(error, callback, parent);
+        }
+
+        virtual Common::AsyncOperationSPtr BeginDelete(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 checkOperationNumber,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent)
+        {
+            auto error = this->Delete(transaction, type, key, checkOperationNumber);
+            return CreateCompletedWriteOperation(error, callback, parent);
+        }
+
+        // Completes BeginInsert, BeginUpdate and BeginDelete
+        //
+        virtual Common::ErrorCode EndWrite(Common::AsyncOperationSPtr const & operation)
+        {
+            return WriteAsyncOperation::End(operation);
+        }
+
+    protected:
+
+        static Common::AsyncOperationSPtr CreateCompletedWriteOperation(
+            Common::ErrorCode const & error,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent)
+        {
+            auto operation = Common::AsyncOperation::CreateAndStart<WriteAsyncOperation>(callback, parent);
+            operation->TryComplete(operation, error);
+            return operation;
+        }
+
+    public:
+
         /// <summary>
         /// Creates a full backup of the replicated store to the specified directory.
         /// </summary>
@@ -240,5 +403,10 @@ namespace Store
         {
             CODING_ASSERT("Test_SetTestHookContext not implemented");
         }
+
+        virtual ILocalStoreSPtr Test_GetLocalStore()
+        {
+            CODING_ASSERT("Test_GetLocalStore not implemented");
+        }
     };
 }
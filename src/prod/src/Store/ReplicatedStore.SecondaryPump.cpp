@@ -34,6 +34,14 @@ namespace Store
         , isCanceled_(false)
         , isStreamFaulted_(false)
         , pendingOperationsCount_(1) // Start with count of 1 to control lifetime
+        , parallelApplyLock_()
+        , parallelApplies_()
+        , isCommittingParallelApplies_(false)
+        , parallelApplyFailed_(false)
+        , shouldFlushOnParallelAppliesDrained_(false)
+        , deferredPump_()
+        , deferredPumpKeys_()
+        , pumpDeferralCount_(0)
     {
         WriteNoise(
             TraceComponent, 
@@ -81,20 +89,30 @@ namespace Store
     {
         if (this->ApproveNewOperationCreation())
         {
-            // Drain replication queue synchronously
+            // Drain replication queue synchronously. A deferred pump restarts
+            // draining once it resumes.
+            //
             AsyncOperationSPtr pumpOperation;
+            bool isDeferred = false;
             do
             {
+                auto deferralCount = pumpDeferralCount_.load();
+
                 pumpOperation = this->PumpOperation();
 
-            } while (pumpOperation && pumpOperation->CompletedSynchronously);
+                isDeferred = (pumpDeferralCount_.load() != deferralCount);
+
+            } while (pumpOperation && pumpOperation->CompletedSynchronously && !isDeferred);
 
             // Once the replication queue is drained, create a dummy transaction and commit it.
             // This causes ESE to flush changes from pending async commits to disk.
             //
-            if (replicatedStore_.Settings.EnableFlushOnDrain && pumpOperation)
+            if (replicatedStore_.Settings.EnableFlushOnDrain && pumpOperation && !isDeferred)
             {
-                this->FlushCurrentLocalStore();
+                if (!this->TryDeferFlushToParallelApplies())
+                {
+                    this->FlushCurrentLocalStore();
+                }
             }
 
             this->OnPendingOperationCompletion();
@@ -111,6 +129,16 @@ namespace Store
             return;
         }
 
+        // Commits of parallel applies update lastLsnProcessed_ and flush
+        // from threadpool threads, concurrently with the pump
+        //
+        ::FABRIC_SEQUENCE_NUMBER lastLsnProcessed = 0;
+        {
+            AcquireExclusiveLock lock(parallelApplyLock_);
+
+            lastLsnProcessed = lastLsnProcessed_;
+        }
+
         TransactionSPtr txSPtr;
         ErrorCode error;
 
@@ -133,12 +161,22 @@ namespace Store
 
         if (error.IsSuccess())
         {
+            ::FABRIC_SEQUENCE_NUMBER lsnAtLastSyncCommit = 0;
+            {
+                AcquireExclusiveLock lock(parallelApplyLock_);
+
+                lsnAtLastSyncCommit = lsnAtLastSyncCommit_;
+
+                if (lastLsnProcessed > lsnAtLastSyncCommit_)
+                {
+                    lsnAtLastSyncCommit_ = lastLsnProcessed;
+                }
+            }
+
             ReplicatedStoreEventSource::Trace->SecondaryDummyCommit(
                 this->PartitionedReplicaId,
-                lastLsnProcessed_,
-                lsnAtLastSyncCommit_);
-
-            lsnAtLastSyncCommit_ = lastLsnProcessed_;
+                lastLsnProcessed,
+                lsnAtLastSyncCommit);
         }
         else if (error.IsError(ErrorCodeValue::StoreFatalError))
         {
@@ -231,11 +269,30 @@ namespace Store
             return;
         }
 
+        this->ProcessPumpedOperation(pumpOperation, operationCPtr, pumpOperation->CompletedSynchronously);
+    }
+
+    void ReplicatedStore::SecondaryPump::ProcessPumpedOperation(
+        AsyncOperationSPtr const & pumpOperation, 
+        ComPointer<IFabricOperation> const & operationCPtr,
+        bool completedSynchronously)
+    {
+        bool scheduleDrainOnFault = !completedSynchronously;
+
+        ErrorCode error;
         wstring errorMessage;
         auto pumpState = this->get_PumpState();
 
         if (!operationCPtr  || operationCPtr->get_Metadata()->Type == FABRIC_OPERATION_TYPE_END_OF_STREAM)
         {
+            // End of stream waits for all outstanding parallel applies
+            //
+            auto continuation = [this, pumpOperation, operationCPtr]() { this->ProcessPumpedOperation(pumpOperation, operationCPtr, false); };
+            if (this->TryDeferPump(nullptr, continuation))
+            {
+                return;
+            }
+
             switch (pumpState)
             {
             case PumpCopy:
@@ -249,7 +306,7 @@ namespace Store
                 {
                     // Restart pump on replication stream
                     //
-                    this->RestartDrainOperationsIfNeeded(pumpOperation);
+                    this->RestartDrainOperationsIfNeeded(completedSynchronously);
                 }
 
                 break;
@@ -280,7 +337,7 @@ namespace Store
         {
             // Drain and drop remaining copy/replication operations once the stream is faulted
             //
-            this->RestartDrainOperationsIfNeeded(pumpOperation);
+            this->RestartDrainOperationsIfNeeded(completedSynchronously);
 
             return;
         }
@@ -331,13 +388,81 @@ namespace Store
         } // switch pumpState
 
         if (error.IsSuccess() && !replicationOperations.empty())
+        {
+            this->ApplyPumpedOperations(
+                operationCPtr,
+                make_shared<vector<ReplicationOperation>>(move(replicationOperations)),
+                operationLsn,
+                lastQuorumAcked,
+                pumpState,
+                completedSynchronously);
+
+            return;
+        }
+
+        if (error.IsSuccess())
+        {
+            this->RestartDrainOperationsIfNeeded(completedSynchronously);
+        }
+        else
+        {
+            this->TransientFaultReplica(error, errorMessage, scheduleDrainOnFault);
+        }
+    }
+
+    void ReplicatedStore::SecondaryPump::ApplyPumpedOperations(
+        ComPointer<IFabricOperation> const & operationCPtr,
+        shared_ptr<vector<ReplicationOperation>> const & replicationOperations,
+        ::FABRIC_SEQUENCE_NUMBER operationLsn,
+        ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+        SecondaryPumpState pumpState,
+        bool completedSynchronously)
+    {
+        bool scheduleDrainOnFault = !completedSynchronously;
+
+        bool isParallel = (pumpState == PumpReplication && this->CanApplyInParallel(*replicationOperations));
+
+        // Operations that cannot be applied in parallel act as a barrier for
+        // all outstanding parallel applies. Parallel applies wait for earlier
+        // applies of the same keys and for a free slot.
+        //
+        ParallelApplyKeys keys;
+        if (isParallel)
+        {
+            keys = GetParallelApplyKeys(*replicationOperations);
+        }
+
+        auto continuation = [this, operationCPtr, replicationOperations, operationLsn, lastQuorumAcked, pumpState]()
+        {
+            this->ApplyPumpedOperations(operationCPtr, replicationOperations, operationLsn, lastQuorumAcked, pumpState, false);
+        };
+
+        if (this->TryDeferPump(isParallel ? &keys : nullptr, continuation))
+        {
+            return;
+        }
+
+        ErrorCode error;
+        wstring errorMessage;
+
+        if (isParallel)
+        {
+            error = this->DispatchParallelApply(
+                operationCPtr,
+                move(*replicationOperations),
+                operationLsn,
+                lastQuorumAcked,
+                move(keys),
+                errorMessage);
+        }
+        else
         {
             // Operations are applied serially on the secondary, so there is only one active transaction
             // at a time.
             //
             error = this->ApplyOperationsWithRetry(
                 operationCPtr, 
-                replicationOperations, 
+                *replicationOperations, 
                 operationLsn, 
                 lastQuorumAcked, 
                 errorMessage);
@@ -356,7 +481,7 @@ namespace Store
 
         if (error.IsSuccess())
         {
-            this->RestartDrainOperationsIfNeeded(pumpOperation);
+            this->RestartDrainOperationsIfNeeded(completedSynchronously);
         }
         else
         {
@@ -1115,6 +1240,31 @@ namespace Store
             return ErrorCodeValue::InvalidOperation;
         }
 
+        auto error = this->NotifyReplication(
+            replicationOperations,
+            operationLsn,
+            lastQuorumAcked,
+            errorMessage);
+
+        if (!error.IsSuccess())
+        {
+            return error;
+        }
+
+        return this->ApplyAndCommitWithRetry(
+            operationCPtr,
+            replicationOperations,
+            operationLsn,
+            lastQuorumAcked,
+            errorMessage);
+    }
+
+    ErrorCode ReplicatedStore::SecondaryPump::NotifyReplication(
+        vector<ReplicationOperation> const & replicationOperations,
+        ::FABRIC_SEQUENCE_NUMBER operationLsn,
+        ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+        __out wstring & errorMessage)
+    {
         // Process notification before applying on secondary (notification 
         // may or may not block depending on mode requested by application)
         //
@@ -1138,6 +1288,16 @@ namespace Store
             break;
         }}
 
+        return ErrorCodeValue::Success;
+    }
+
+    ErrorCode ReplicatedStore::SecondaryPump::ApplyAndCommitWithRetry(
+        ComPointer<IFabricOperation> const & operationCPtr,
+        vector<ReplicationOperation> const & replicationOperations,
+        ::FABRIC_SEQUENCE_NUMBER operationLsn,
+        ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+        __out wstring & errorMessage)
+    {
         int retryCount = StoreConfig::GetConfig().SecondaryApplyRetryCount;
         int retryRemaining = retryCount;
 
@@ -1171,34 +1331,12 @@ namespace Store
 
             if (error.IsSuccess())
             {
-                if (this->ApproveNewOperationCreation())
-                {
-                    auto commitOperation = std::make_shared<CommitAndAcknowledgeAsyncOperation>(
-                        *this,
-                        move(txSPtr),
-                        operationCPtr,
-                        operationLsn,
-                        updatedTombstoneCount,
-                        [this](AsyncOperationSPtr const & operation){ this->OnCommitComplete(operation, false); },
-                        this->CreateAsyncOperationRoot());
-
-                    lastLsnProcessed_ = operationLsn;
-
-                    commitOperation->Start(commitOperation);
-
-                    this->OnCommitComplete(commitOperation, true);
-#if defined(PLATFORM_UNIX) && defined(SYNC_COMMIT)
-                    this->commitCompleteEvent_.WaitOne(TimeSpan::MaxValue);
-                    this->commitCompleteEvent_.Reset();
-#endif
-                }
-                else
-                {
-                    errorMessage = L"pump closed while committing";
-                    error = ErrorCodeValue::ObjectClosed;
-                }
-
-                return error;
+                return this->StartCommit(
+                    move(txSPtr),
+                    operationCPtr,
+                    operationLsn,
+                    updatedTombstoneCount,
+                    errorMessage);
             }
             else
             {
@@ -1244,6 +1382,442 @@ namespace Store
         return error;
     }
 
+    ErrorCode ReplicatedStore::SecondaryPump::StartCommit(
+        TransactionSPtr && txSPtr,
+        ComPointer<IFabricOperation> const & operationCPtr,
+        ::FABRIC_SEQUENCE_NUMBER operationLsn,
+        size_t updatedTombstoneCount,
+        __out wstring & errorMessage)
+    {
+        if (!this->ApproveNewOperationCreation())
+        {
+            errorMessage = L"pump closed while committing";
+
+            return ErrorCodeValue::ObjectClosed;
+        }
+
+        auto commitOperation = std::make_shared<CommitAndAcknowledgeAsyncOperation>(
+            *this,
+            move(txSPtr),
+            operationCPtr,
+            operationLsn,
+            updatedTombstoneCount,
+            [this](AsyncOperationSPtr const & operation){ this->OnCommitComplete(operation, false); },
+            this->CreateAsyncOperationRoot());
+
+        {
+            AcquireExclusiveLock lock(parallelApplyLock_);
+
+            lastLsnProcessed_ = operationLsn;
+        }
+
+        commitOperation->Start(commitOperation);
+
+        this->OnCommitComplete(commitOperation, true);
+#if defined(PLATFORM_UNIX) && defined(SYNC_COMMIT)
+        this->commitCompleteEvent_.WaitOne(TimeSpan::MaxValue);
+        this->commitCompleteEvent_.Reset();
+#endif
+
+        return ErrorCodeValue::Success;
+    }
+
+    bool ReplicatedStore::SecondaryPump::CanApplyInParallel(vector<ReplicationOperation> const & replicationOperations) const
+    {
+#if defined(PLATFORM_UNIX) && defined(SYNC_COMMIT)
+        UNREFERENCED_PARAMETER(replicationOperations);
+
+        return false;
+#else
+        if (StoreConfig::GetConfig().SecondaryApplyParallelism <= 1)
+        {
+            return false;
+        }
+
+        // Only data writes are applied in parallel. Tombstone, epoch and copy
+        // operations are applied serially.
+        //
+        for (auto const & operation : replicationOperations)
+        {
+            switch (operation.Operation)
+            {
+            case ReplicationOperationType::Insert:
+            case ReplicationOperationType::Update:
+            case ReplicationOperationType::Delete:
+                if (operation.Type == Constants::TombstoneDataType)
+                {
+                    return false;
+                }
+                break;
+
+            default:
+                return false;
+            }
+        }
+
+        return true;
+#endif
+    }
+
+    ReplicatedStore::SecondaryPump::ParallelApplyKeys ReplicatedStore::SecondaryPump::GetParallelApplyKeys(
+        vector<ReplicationOperation> const & replicationOperations)
+    {
+        ParallelApplyKeys keys;
+        for (auto const & operation : replicationOperations)
+        {
+            keys.insert(make_pair(operation.Type, operation.Key));
+
+            if (operation.Operation == ReplicationOperationType::Update && operation.NewKey != operation.Key)
+            {
+                keys.insert(make_pair(operation.Type, operation.NewKey));
+            }
+        }
+
+        return keys;
+    }
+
+    bool ReplicatedStore::SecondaryPump::TryDeferPump(
+        ParallelApplyKeys const * keys,
+        function<void()> const & continuation)
+    {
+        AcquireExclusiveLock lock(parallelApplyLock_);
+
+        if (!this->IsPumpBlockedCallerHoldsLock(keys))
+        {
+            return false;
+        }
+
+        ++pumpDeferralCount_;
+
+        // Keeps the pump alive until the continuation runs. The pump is
+        // closing otherwise, so the operation is dropped.
+        //
+        if (this->ApproveNewOperationCreation())
+        {
+            WriteNoise(
+                TraceComponent,
+                "{0} deferring pump: outstanding parallel applies={1} barrier={2}",
+                this->TraceId,
+                parallelApplies_.size(),
+                keys == nullptr);
+
+            deferredPump_ = continuation;
+            deferredPumpKeys_ = (keys == nullptr ? nullptr : make_unique<ParallelApplyKeys>(*keys));
+        }
+
+        return true;
+    }
+
+    bool ReplicatedStore::SecondaryPump::IsPumpBlockedCallerHoldsLock(ParallelApplyKeys const * keys) const
+    {
+        if (parallelApplies_.empty())
+        {
+            return false;
+        }
+
+        if (keys == nullptr)
+        {
+            return true;
+        }
+
+        if (parallelApplies_.size() >= static_cast<size_t>(StoreConfig::GetConfig().SecondaryApplyParallelism))
+        {
+            return true;
+        }
+
+        for (auto const & entry : parallelApplies_)
+        {
+            for (auto const & key : *keys)
+            {
+                if (entry->Keys.find(key) != entry->Keys.end())
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    ErrorCode ReplicatedStore::SecondaryPump::DispatchParallelApply(
+        ComPointer<IFabricOperation> const & operationCPtr,
+        vector<ReplicationOperation> && replicationOperations,
+        ::FABRIC_SEQUENCE_NUMBER operationLsn,
+        ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+        ParallelApplyKeys && keys,
+        __out wstring & errorMessage)
+    {
+        // Notifications are still dispatched in LSN order from the pump. Earlier
+        // operations on the same keys have already started committing since the
+        // pump defers conflicting operations.
+        //
+        auto error = this->NotifyReplication(
+            replicationOperations,
+            operationLsn,
+            lastQuorumAcked,
+            errorMessage);
+
+        if (!error.IsSuccess())
+        {
+            return error;
+        }
+
+        if (!this->ApproveNewOperationCreation())
+        {
+            errorMessage = L"pump closed while applying";
+
+            return ErrorCodeValue::ObjectClosed;
+        }
+
+        auto entry = make_shared<ParallelApplyEntry>(
+            operationCPtr,
+            move(replicationOperations),
+            operationLsn,
+            lastQuorumAcked,
+            move(keys));
+
+        entry->RetryRemaining = StoreConfig::GetConfig().SecondaryApplyRetryCount;
+
+        {
+            AcquireExclusiveLock lock(parallelApplyLock_);
+
+            parallelApplies_.push_back(entry);
+        }
+
+        auto selfRoot = this->CreateComponentRoot();
+        Threadpool::Post([this, selfRoot, entry]() { this->ParallelApply(entry); });
+
+        return ErrorCodeValue::Success;
+    }
+
+    void ReplicatedStore::SecondaryPump::ParallelApply(ParallelApplyEntrySPtr const & entry)
+    {
+        TransactionSPtr txSPtr;
+        wstring errorMessage;
+        auto error = this->GetCurrentLocalStore()->CreateTransaction(txSPtr);
+
+        if (!error.IsSuccess())
+        {
+            errorMessage = L"CreateTransaction() failed";
+        }
+        else
+        {
+            size_t updatedTombstoneCount = 0;
+            error = this->ApplyOperations(
+                txSPtr, 
+                entry->Operations, 
+                entry->OperationLsn, 
+                entry->LastQuorumAcked, 
+                updatedTombstoneCount, // out
+                errorMessage); // out
+
+            if (error.IsSuccess())
+            {
+                entry->UpdatedTombstoneCount = updatedTombstoneCount;
+            }
+            else
+            {
+                txSPtr->Rollback();
+                txSPtr.reset();
+
+                // Retry on a timer instead of sleeping on the threadpool thread
+                //
+                if (IsRetryable(error) && entry->RetryRemaining > 0)
+                {
+                    WriteInfo(
+                        TraceComponent,
+                        "{0} retrying parallel apply: remaining={1} LSN={2}",
+                        this->TraceId,
+                        entry->RetryRemaining,
+                        entry->OperationLsn);
+
+                    --entry->RetryRemaining;
+
+                    auto selfRoot = this->CreateComponentRoot();
+                    Threadpool::Post(
+                        [this, selfRoot, entry]() { this->ParallelApply(entry); },
+                        TimeSpan::FromMilliseconds(StoreConfig::GetConfig().SecondaryApplyRetryDelayMilliseconds));
+
+                    return;
+                }
+                else if (IsRetryable(error))
+                {
+                    errorMessage = wformatString("retries exhausted: LSN={0}", entry->OperationLsn);
+                }
+                else if (errorMessage.empty())
+                {
+                    errorMessage = wformatString("error details missing: LSN={0}", entry->OperationLsn);
+
+                    Assert::TestAssert("{0}", errorMessage);
+                }
+            }
+        }
+
+        entry->TxSPtr = move(txSPtr);
+        entry->Error = error;
+        entry->ErrorMessage = move(errorMessage);
+
+        this->OnParallelApplyCompleted(entry);
+    }
+
+    void ReplicatedStore::SecondaryPump::OnParallelApplyCompleted(ParallelApplyEntrySPtr const & entry)
+    {
+        {
+            AcquireExclusiveLock lock(parallelApplyLock_);
+
+            entry->IsApplied = true;
+
+            // Another thread is already starting commits in LSN order and
+            // will pick up this entry once it reaches it
+            //
+            if (isCommittingParallelApplies_)
+            {
+                return;
+            }
+
+            isCommittingParallelApplies_ = true;
+        }
+
+        this->CommitParallelApplies();
+    }
+
+    void ReplicatedStore::SecondaryPump::CommitParallelApplies()
+    {
+        while (true)
+        {
+            // Commits are started in LSN order, so only the applied prefix of
+            // outstanding parallel applies can be committed. Entries stay in
+            // parallelApplies_ until their commits have started so that the
+            // pump keeps treating them as outstanding.
+            //
+            vector<ParallelApplyEntrySPtr> readyEntries;
+            {
+                AcquireExclusiveLock lock(parallelApplyLock_);
+
+                for (auto const & entry : parallelApplies_)
+                {
+                    if (!entry->IsApplied) { break; }
+
+                    readyEntries.push_back(entry);
+                }
+
+                if (readyEntries.empty())
+                {
+                    isCommittingParallelApplies_ = false;
+
+                    return;
+                }
+            }
+
+            for (auto const & entry : readyEntries)
+            {
+                this->CommitParallelApply(*entry);
+            }
+
+            function<void()> deferredPump;
+            bool shouldFlush = false;
+            {
+                AcquireExclusiveLock lock(parallelApplyLock_);
+
+                parallelApplies_.erase(parallelApplies_.begin(), parallelApplies_.begin() + readyEntries.size());
+
+                if (parallelApplies_.empty())
+                {
+                    // Applies dispatched after this point are unaffected by earlier failures
+                    //
+                    parallelApplyFailed_ = false;
+
+                    shouldFlush = shouldFlushOnParallelAppliesDrained_;
+                    shouldFlushOnParallelAppliesDrained_ = false;
+                }
+
+                if (deferredPump_ && !this->IsPumpBlockedCallerHoldsLock(deferredPumpKeys_.get()))
+                {
+                    deferredPump = move(deferredPump_);
+                    deferredPump_ = nullptr;
+                    deferredPumpKeys_.reset();
+                }
+            }
+
+            if (shouldFlush)
+            {
+                this->FlushCurrentLocalStore();
+            }
+
+            if (deferredPump)
+            {
+                // Releases the reference taken when the pump was deferred
+                //
+                auto selfRoot = this->CreateComponentRoot();
+                Threadpool::Post([this, selfRoot, deferredPump]()
+                {
+                    deferredPump();
+
+                    this->OnPendingOperationCompletion();
+                });
+            }
+
+            for (size_t ix = 0; ix < readyEntries.size(); ++ix)
+            {
+                this->OnPendingOperationCompletion();
+            }
+        }
+    }
+
+    void ReplicatedStore::SecondaryPump::CommitParallelApply(ParallelApplyEntry & entry)
+    {
+        auto error = entry.Error;
+        auto errorMessage = move(entry.ErrorMessage);
+
+        if (error.IsSuccess() && parallelApplyFailed_)
+        {
+            // Keep applies after a failed one from committing
+            //
+            entry.TxSPtr->Rollback();
+
+            WriteInfo(
+                TraceComponent,
+                "{0} rolled back parallel apply after previous failure: LSN={1}",
+                this->TraceId,
+                entry.OperationLsn);
+        }
+        else if (error.IsSuccess())
+        {
+            error = this->StartCommit(
+                move(entry.TxSPtr),
+                entry.OperationCPtr,
+                entry.OperationLsn,
+                entry.UpdatedTombstoneCount,
+                errorMessage);
+        }
+
+        entry.TxSPtr.reset();
+
+        replicatedStore_.PerfCounters.AvgLatencyOfApplyReplicationBase.Increment();
+        replicatedStore_.PerfCounters.AvgLatencyOfApplyReplication.IncrementBy(entry.Stopwatch.ElapsedMilliseconds);
+
+        if (!error.IsSuccess() && !parallelApplyFailed_)
+        {
+            parallelApplyFailed_ = true;
+
+            this->TransientFaultReplica(error, errorMessage, false); // scheduleDrain
+        }
+    }
+
+    bool ReplicatedStore::SecondaryPump::TryDeferFlushToParallelApplies()
+    {
+        AcquireExclusiveLock lock(parallelApplyLock_);
+
+        if (parallelApplies_.empty())
+        {
+            return false;
+        }
+
+        shouldFlushOnParallelAppliesDrained_ = true;
+
+        return true;
+    }
+
     ErrorCode ReplicatedStore::SecondaryPump::ApplyOperations(
         TransactionSPtr const & txSPtr,
         vector<ReplicationOperation> const & replicationOperations,
@@ -107,11 +107,72 @@ namespace Store
 
         enum SecondaryPumpState { PumpNotStarted, PumpCopy, PumpReplication, PumpClosed };
 
+        typedef std::set<std::pair<std::wstring, std::wstring>> ParallelApplyKeys;
+
+        // Tracks a replication operation being applied in parallel from dispatch until
+        // its commit has been started (or it has been rolled back), which happens in LSN order.
+        //
+        struct ParallelApplyEntry
+        {
+            ParallelApplyEntry(
+                Common::ComPointer<IFabricOperation> const & operationCPtr,
+                std::vector<ReplicationOperation> && operations,
+                ::FABRIC_SEQUENCE_NUMBER operationLsn,
+                ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+                ParallelApplyKeys && keys)
+                : OperationCPtr(operationCPtr)
+                , Operations(std::move(operations))
+                , OperationLsn(operationLsn)
+                , LastQuorumAcked(lastQuorumAcked)
+                , Keys(std::move(keys))
+                , RetryRemaining(0)
+                , Stopwatch()
+                , IsApplied(false)
+                , TxSPtr()
+                , UpdatedTombstoneCount(0)
+                , Error(Common::ErrorCodeValue::Success)
+                , ErrorMessage()
+            {
+                Stopwatch.Start();
+            }
+
+            Common::ComPointer<IFabricOperation> OperationCPtr;
+            std::vector<ReplicationOperation> Operations;
+            ::FABRIC_SEQUENCE_NUMBER OperationLsn;
+            ::FABRIC_SEQUENCE_NUMBER LastQuorumAcked;
+            ParallelApplyKeys Keys;
+            int RetryRemaining;
+            Common::Stopwatch Stopwatch;
+
+            // Set under parallelApplyLock_ once the operations have been applied to TxSPtr
+            // or failed with Error
+            //
+            bool IsApplied;
+            TransactionSPtr TxSPtr;
+            size_t UpdatedTombstoneCount;
+            Common::ErrorCode Error;
+            std::wstring ErrorMessage;
+        };
+
+        typedef std::shared_ptr<ParallelApplyEntry> ParallelApplyEntrySPtr;
+
         void ScheduleDrainOperations();
         void DrainOperations();
         Common::AsyncOperationSPtr PumpOperation();
         void OnPumpOperationComplete(Common::AsyncOperationSPtr const &, bool expectedCompletedSynchronously);
 
+        void ProcessPumpedOperation(
+            Common::AsyncOperationSPtr const &,
+            Common::ComPointer<IFabricOperation> const & operationCPtr,
+            bool completedSynchronously);
+        void ApplyPumpedOperations(
+            Common::ComPointer<IFabricOperation> const & operationCPtr,
+            std::shared_ptr<std::vector<ReplicationOperation>> const &,
+            ::FABRIC_SEQUENCE_NUMBER replicationLSN,
+            ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+            SecondaryPumpState,
+            bool completedSynchronously);
+
         Common::ErrorCode ProcessEndOfCopyStream(
             Common::AsyncOperationSPtr const &, 
             Common::ComPointer<IFabricOperation> const & operationCPtr,
@@ -149,7 +210,7 @@ namespace Store
             __out ::FABRIC_SEQUENCE_NUMBER & lastQuorumAcked,
             __out std::wstring & errorMessage);
 
-        void RestartDrainOperationsIfNeeded(Common::AsyncOperationSPtr const &);
+        void RestartDrainOperationsIfNeeded(bool completedSynchronously);
 
         Common::ErrorCode TryCleanupCopyLocalStore(Common::AsyncOperationSPtr const& pumpOperation);
 
@@ -165,6 +226,41 @@ namespace Store
             ::FABRIC_SEQUENCE_NUMBER replicationLSN,
             ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
             __out std::wstring & errorMessage);
+        Common::ErrorCode NotifyReplication(
+            std::vector<ReplicationOperation> const &,
+            ::FABRIC_SEQUENCE_NUMBER replicationLSN,
+            ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+            __out std::wstring & errorMessage);
+        Common::ErrorCode ApplyAndCommitWithRetry(
+            Common::ComPointer<IFabricOperation> const &,
+            std::vector<ReplicationOperation> const &,
+            ::FABRIC_SEQUENCE_NUMBER replicationLSN,
+            ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+            __out std::wstring & errorMessage);
+        Common::ErrorCode StartCommit(
+            TransactionSPtr &&,
+            Common::ComPointer<IFabricOperation> const &,
+            ::FABRIC_SEQUENCE_NUMBER replicationLSN,
+            size_t updatedTombstoneCount,
+            __out std::wstring & errorMessage);
+
+        bool CanApplyInParallel(std::vector<ReplicationOperation> const &) const;
+        static ParallelApplyKeys GetParallelApplyKeys(std::vector<ReplicationOperation> const &);
+        bool TryDeferPump(ParallelApplyKeys const *, std::function<void()> const & continuation);
+        bool IsPumpBlockedCallerHoldsLock(ParallelApplyKeys const *) const;
+        Common::ErrorCode DispatchParallelApply(
+            Common::ComPointer<IFabricOperation> const &,
+            std::vector<ReplicationOperation> &&,
+            ::FABRIC_SEQUENCE_NUMBER replicationLSN,
+            ::FABRIC_SEQUENCE_NUMBER lastQuorumAcked,
+            ParallelApplyKeys &&,
+            __out std::wstring & errorMessage);
+        void ParallelApply(ParallelApplyEntrySPtr const &);
+        void OnParallelApplyCompleted(ParallelApplyEntrySPtr const &);
+        void CommitParallelApplies();
+        void CommitParallelApply(ParallelApplyEntry &);
+        bool TryDeferFlushToParallelApplies();
+
         Common::ErrorCode ApplyOperations(
             TransactionSPtr const &,
             std::vector<ReplicationOperation> const &,
@@ -263,6 +359,8 @@ namespace Store
         SecondaryPumpState pumpState_;
         Common::Stopwatch stopwatch_;
 
+        // Protected by parallelApplyLock_
+        //
         ::FABRIC_SEQUENCE_NUMBER lastLsnProcessed_;
         ::FABRIC_SEQUENCE_NUMBER lsnAtLastSyncCommit_;
 
@@ -274,6 +372,24 @@ namespace Store
         Common::atomic_bool isStreamFaulted_;
         mutable Common::atomic_long pendingOperationsCount_;
 
+        // Replication operations with data writes only are applied on multiple threads
+        // when SecondaryApplyParallelism > 1. Operations writing the same keys are applied
+        // in order and all other operations wait for outstanding parallel applies.
+        //
+        // Nothing blocks while waiting: the pump defers the rest of its processing to
+        // deferredPump_, which runs once the outstanding applies no longer block it, and
+        // applies that finish early leave their commits to whichever thread completes the
+        // apply before them (isCommittingParallelApplies_).
+        //
+        Common::ExclusiveLock parallelApplyLock_;
+        std::deque<ParallelApplyEntrySPtr> parallelApplies_;
+        bool isCommittingParallelApplies_;
+        bool parallelApplyFailed_;
+        bool shouldFlushOnParallelAppliesDrained_;
+        std::function<void()> deferredPump_;
+        std::unique_ptr<ParallelApplyKeys> deferredPumpKeys_;
+        Common::atomic_uint64 pumpDeferralCount_;
+
         std::unique_ptr<Common::File> fullCopyFileUPtr_;
     };
 }
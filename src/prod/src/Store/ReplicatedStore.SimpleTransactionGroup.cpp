@@ -168,6 +168,8 @@ namespace Store
         ASSERT_IFNOT(committedTxCount == commitAsyncOperationsSize, "committedTxCount_");
         ASSERT_IFNOT(commitAsyncOperationsSize > 0, "commitMap_.size()");
 
+        this->UpdateGroupSizeCounters(commitAsyncOperationsSize);
+
         if (txReplicatorSPtr_)
         {
             WriteInfo(
@@ -374,6 +376,31 @@ namespace Store
         }
     }
 
+    void ReplicatedStore::SimpleTransactionGroup::UpdateGroupSizeCounters(size_t groupSize)
+    {
+        auto const & counters = replicatedStore_.PerfCounters;
+
+        counters.AvgCommitGroupSizeBase.Increment();
+        counters.AvgCommitGroupSize.IncrementBy(groupSize);
+
+        if (groupSize < 2)
+        {
+            counters.CommitGroupSize1.Increment();
+        }
+        else if (groupSize < 16)
+        {
+            counters.CommitGroupSize2To15.Increment();
+        }
+        else if (groupSize < 128)
+        {
+            counters.CommitGroupSize16To127.Increment();
+        }
+        else
+        {
+            counters.CommitGroupSize128OrMore.Increment();
+        }
+    }
+
     bool ReplicatedStore::SimpleTransactionGroup::IsBatchLimitExceeded() const
     {
         return (replicationSize_ > commitBatchingSizeLimit_);
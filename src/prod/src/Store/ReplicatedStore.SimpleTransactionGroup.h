@@ -86,6 +86,7 @@ namespace Store
         bool IsBatchLimitExceeded() const;
         bool CanCreateTransaction() const;
         void PostCompletions(Common::ErrorCode const &, ::FABRIC_SEQUENCE_NUMBER);
+        void UpdateGroupSizeCounters(size_t groupSize);
 
         Common::ComponentRootSPtr storeRoot_;
         Store::ReplicatedStore & replicatedStore_;
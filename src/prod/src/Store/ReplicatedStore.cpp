@@ -458,16 +458,38 @@ namespace Store
 
     void ReplicatedStore::SimpleTransactionGroupTimerCallback()
     {
-        if (settings_.TransactionHighWatermark >= 0 && pendingTransactions_ >= settings_.TransactionHighWatermark)
+        auto extension = TimeSpan::FromMilliseconds(settings_.CommitBatchingPeriodExtension);
+
+        // Bound the total batching delay of a group so that sustained load cannot
+        // hold its commits indefinitely
+        //
+        auto maxDelay = StoreConfig::GetConfig().CommitBatchingMaxDelay;
+        if (maxDelay > TimeSpan::Zero)
+        {
+            StopwatchTime startTime;
+            {
+                AcquireReadLock grab(transactionGroupLock_);
+
+                startTime = simpleTransactionGroupStartTime_;
+            }
+
+            auto remaining = maxDelay - (Stopwatch::Now() - startTime);
+            if (remaining < extension)
+            {
+                extension = remaining;
+            }
+        }
+
+        if (settings_.TransactionHighWatermark >= 0 && pendingTransactions_ >= settings_.TransactionHighWatermark && extension > TimeSpan::Zero)
         {
             WriteInfo(
                 TraceComponent, 
                 "{0} ReplicatedStore::SimpleTransactionGroupTimerCallback. Pending completion transactions {1}.  Batching period extended by {2} ms",
                 this->TraceId,
                 pendingTransactions_,
-                settings_.CommitBatchingPeriodExtension);
+                extension.TotalMilliseconds());
 
-            simpleTransactionGroupTimer_->Change(TimeSpan::FromMilliseconds(settings_.CommitBatchingPeriodExtension));
+            simpleTransactionGroupTimer_->Change(extension);
         }
         else
         {
@@ -616,12 +638,24 @@ namespace Store
 
                     groupToCloseSPtr = move(simpleTransactionGroupSPtr_);
 
+                    // Let groups grow larger while the store is under load to replicate
+                    // fewer, larger operations
+                    //
+                    int sizeLimit = settings_.CommitBatchingSizeLimit;
+                    if (settings_.TransactionHighWatermark >= 0 && pendingTransactions_ >= settings_.TransactionHighWatermark)
+                    {
+                        sizeLimit = static_cast<int>(min(
+                            static_cast<int64>(sizeLimit) * StoreConfig::GetConfig().CommitBatchingSizeLimitLoadMultiplier,
+                            static_cast<int64>(numeric_limits<int>::max())));
+                    }
+
                     simpleTransactionGroupSPtr_ = make_shared<SimpleTransactionGroup>(
                         *this,
-                        settings_.CommitBatchingSizeLimit,
+                        sizeLimit,
                         this->TryGetTxReplicator(),
                         move(innerTxSPtr),
                         activityId);
+                    simpleTransactionGroupStartTime_ = Stopwatch::Now();
                     simpleTransactionGroupTimer_->Change(TimeSpan::FromMilliseconds(settings_.CommitBatchingPeriod));
 
                     simpleTxSPtr = simpleTransactionGroupSPtr_->CreateSimpleTransaction(activityId);
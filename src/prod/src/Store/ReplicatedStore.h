@@ -826,6 +826,7 @@ namespace Store
         
         // SimpleTransactions
         Common::DateTime lastSimpleTransactionTimestamp_;
+        Common::StopwatchTime simpleTransactionGroupStartTime_;
         Common::TimerSPtr simpleTransactionGroupTimer_;
         std::shared_ptr<SimpleTransactionGroup> simpleTransactionGroupSPtr_;
         RWLOCK(StoreTranscationGroup, transactionGroupLock_);
@@ -47,6 +47,9 @@ namespace Store
         INTERNAL_CONFIG_ENTRY(int, L"EseStore", InvalidSessionThreadRetryCount, 10, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(int, L"EseStore", SecondaryApplyRetryCount, 50, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(int, L"EseStore", SecondaryApplyRetryDelayMilliseconds, 100, Common::ConfigEntryUpgradePolicy::Dynamic);
+        // Number of replication operations a secondary applies concurrently. Operations writing the same keys are still
+        // applied in order and local commits are always started in LSN order. 1 applies all operations serially.
+        INTERNAL_CONFIG_ENTRY(int, L"EseStore", SecondaryApplyParallelism, 1, Common::ConfigEntryUpgradePolicy::Dynamic, Common::InRange<int>(1, 16));
 
         //
         // Settings that are to control ESE resource use, intended to catch bugs
@@ -127,6 +130,10 @@ namespace Store
         INTERNAL_CONFIG_ENTRY(bool, L"ReplicatedStore", EnableFileStreamFullCopy, true, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(int, L"ReplicatedStore", MaxFileStreamFullCopyWaiters, -1, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"ReplicatedStore", FileStreamFullCopyRetryDelay, Common::TimeSpan::FromSeconds(30), Common::ConfigEntryUpgradePolicy::Dynamic);
+        // Bandwidth budget in MB/sec shared by all file stream full copies sent from this process (<= 0 to disable)
+        INTERNAL_CONFIG_ENTRY(int, L"ReplicatedStore", FileStreamFullCopyThrottleInMBPerSecond, 0, Common::ConfigEntryUpgradePolicy::Dynamic);
+        // Reads the next file stream full copy chunk in the background while the current chunk is being sent
+        INTERNAL_CONFIG_ENTRY(bool, L"ReplicatedStore", EnableFileStreamFullCopyReadAhead, false, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(int, L"ReplicatedStore", WaitForCopyLsnRetryDelayInMillis, 500, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(int, L"ReplicatedStore", MaxWaitForCopyLsnRetry, 120, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(bool, L"ReplicatedStore", EnableSystemServiceFlushOnDrain, true, Common::ConfigEntryUpgradePolicy::Dynamic);
@@ -140,6 +147,13 @@ namespace Store
         INTERNAL_CONFIG_ENTRY(bool, L"ReplicatedStore", EnableSlowCommitTest, false, Common::ConfigEntryUpgradePolicy::Dynamic);
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"ReplicatedStore", DefaultHealthReportTimeToLive, Common::TimeSpan::FromSeconds(60), Common::ConfigEntryUpgradePolicy::Dynamic);
 
+        // Upper bound on how long a simple transaction group stays open while its batching period keeps getting
+        // extended under load (pending transactions above the high watermark). Zero disables the cap.
+        INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"ReplicatedStore", CommitBatchingMaxDelay, Common::TimeSpan::Zero, Common::ConfigEntryUpgradePolicy::Dynamic);
+        // Multiplier applied to the commit batching size limit of new simple transaction groups while pending
+        // transactions are above the high watermark, so that fewer and larger replication operations are sent under load.
+        INTERNAL_CONFIG_ENTRY(int, L"ReplicatedStore", CommitBatchingSizeLimitLoadMultiplier, 1, Common::ConfigEntryUpgradePolicy::Dynamic, Common::InRange<int>(1, 64));
+
         // Tracks lifecycle operations and asserts if this timeout expires waiting for the operation to complete (0 to disable)
         //
         DEPRECATED_CONFIG_ENTRY(Common::TimeSpan, L"ReplicatedStore", LifecycleAssertTimeout, Common::TimeSpan::Zero, Common::ConfigEntryUpgradePolicy::Dynamic);
@@ -180,6 +194,10 @@ namespace Store
         // Retry delay during TStore initialization
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"ReplicatedStore", TStoreInitializationRetryDelay, Common::TimeSpan::FromSeconds(1), Common::ConfigEntryUpgradePolicy::Dynamic);
 
+        // When true, TStore-based local stores maintain an operation LSN index so that they can be enumerated by operation LSN.
+        // Every write pays for additional index reads and writes. Stores created before the index was enabled only support full copies.
+        INTERNAL_CONFIG_ENTRY(bool, L"ReplicatedStore", EnableTStoreOperationLsnIndex, false, Common::ConfigEntryUpgradePolicy::Static);
+
         // The lock timeout passed to TStore operations
         TEST_CONFIG_ENTRY(Common::TimeSpan, L"ReplicatedStore", TStoreLockTimeout, Common::TimeSpan::MaxValue, Common::ConfigEntryUpgradePolicy::Dynamic);
         
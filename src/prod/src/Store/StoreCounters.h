@@ -149,6 +149,10 @@ namespace Store
 
             S_RAW_COUNTER( 1, L"Tombstone Count", L"Number of tombstone entries" )
             S_RAW_COUNTER( 2, L"Notification Dispatch Queue Size", L"Number of replication operations pending dispatch in the notification queue" )
+            S_RAW_COUNTER( 3, L"Commit groups (1 tx)", L"Number of simple transaction groups committed with a single transaction" )
+            S_RAW_COUNTER( 4, L"Commit groups (2-15 tx)", L"Number of simple transaction groups committed with 2 to 15 transactions" )
+            S_RAW_COUNTER( 5, L"Commit groups (16-127 tx)", L"Number of simple transaction groups committed with 16 to 127 transactions" )
+            S_RAW_COUNTER( 6, L"Commit groups (128+ tx)", L"Number of simple transaction groups committed with 128 or more transactions" )
 
             S_RATE_COUNTER( 1, L"Replication operations/sec", L"Replication operations sent per second" )
             S_RATE_COUNTER( 2, L"Copy operation reads/sec", L"Copy operations read per second" )
@@ -162,6 +166,7 @@ namespace Store
             S_AVG_BASE( 6, L"Base for Average size of a copy operation" )
             S_AVG_BASE( 7, L"Base for Average time to apply a copy operation" )
             S_AVG_BASE( 8, L"Base for Average time to apply a replication operation" )
+            S_AVG_BASE( 9, L"Base for Avg. commit group size" )
 
             S_AVG_COUNTER( 1, L"Avg. commit latency (us)", L"Average time to commit a transaction in microseconds" )
             S_AVG_COUNTER( 2, L"Avg. replication latency (us)", L"Average time to replicate a transaction in microseconds" )
@@ -171,10 +176,15 @@ namespace Store
             S_AVG_COUNTER( 6, L"Avg. copy size (bytes)", L"Average size of a copy operation" )
             S_AVG_COUNTER( 7, L"Avg. copy apply latency (ms)", L"Average time to apply a copy operation" )
             S_AVG_COUNTER( 8, L"Avg. replication apply latency (ms)", L"Average time to apply a replication operation" )
+            S_AVG_COUNTER( 9, L"Avg. commit group size", L"Average number of simple transactions committed in each replication operation" )
         END_COUNTER_SET_DEFINITION()
 
         DECLARE_COUNTER_INSTANCE( TombstoneCount )
         DECLARE_COUNTER_INSTANCE( NotificationQueueSize )
+        DECLARE_COUNTER_INSTANCE( CommitGroupSize1 )
+        DECLARE_COUNTER_INSTANCE( CommitGroupSize2To15 )
+        DECLARE_COUNTER_INSTANCE( CommitGroupSize16To127 )
+        DECLARE_COUNTER_INSTANCE( CommitGroupSize128OrMore )
 
         DECLARE_COUNTER_INSTANCE( RateOfReplication )
         DECLARE_COUNTER_INSTANCE( RateOfCopy )
@@ -188,6 +198,7 @@ namespace Store
         DECLARE_COUNTER_INSTANCE( AvgSizeOfCopyBase )
         DECLARE_COUNTER_INSTANCE( AvgLatencyOfApplyCopyBase )
         DECLARE_COUNTER_INSTANCE( AvgLatencyOfApplyReplicationBase )
+        DECLARE_COUNTER_INSTANCE( AvgCommitGroupSizeBase )
 
         DECLARE_COUNTER_INSTANCE( AvgLatencyOfCommit )
         DECLARE_COUNTER_INSTANCE( AvgLatencyOfReplication )
@@ -197,10 +208,15 @@ namespace Store
         DECLARE_COUNTER_INSTANCE( AvgSizeOfCopy )
         DECLARE_COUNTER_INSTANCE( AvgLatencyOfApplyCopy )
         DECLARE_COUNTER_INSTANCE( AvgLatencyOfApplyReplication )
+        DECLARE_COUNTER_INSTANCE( AvgCommitGroupSize )
 
         BEGIN_COUNTER_SET_INSTANCE(ReplicatedStorePerformanceCounters)
             S_DEFINE_RAW_COUNTER( 1, TombstoneCount )
             S_DEFINE_RAW_COUNTER( 2, NotificationQueueSize )
+            S_DEFINE_RAW_COUNTER( 3, CommitGroupSize1 )
+            S_DEFINE_RAW_COUNTER( 4, CommitGroupSize2To15 )
+            S_DEFINE_RAW_COUNTER( 5, CommitGroupSize16To127 )
+            S_DEFINE_RAW_COUNTER( 6, CommitGroupSize128OrMore )
 
             S_DEFINE_RATE_COUNTER( 1, RateOfReplication )
             S_DEFINE_RATE_COUNTER( 2, RateOfCopy )
@@ -214,6 +230,7 @@ namespace Store
             S_DEFINE_AVG_BASE_COUNTER( 6, AvgSizeOfCopyBase )
             S_DEFINE_AVG_BASE_COUNTER( 7, AvgLatencyOfApplyCopyBase )
             S_DEFINE_AVG_BASE_COUNTER( 8, AvgLatencyOfApplyReplicationBase )
+            S_DEFINE_AVG_BASE_COUNTER( 9, AvgCommitGroupSizeBase )
 
             S_DEFINE_AVG_COUNTER( 1, AvgLatencyOfCommit )
             S_DEFINE_AVG_COUNTER( 2, AvgLatencyOfReplication )
@@ -223,6 +240,7 @@ namespace Store
             S_DEFINE_AVG_COUNTER( 6, AvgSizeOfCopy )
             S_DEFINE_AVG_COUNTER( 7, AvgLatencyOfApplyCopy )
             S_DEFINE_AVG_COUNTER( 8, AvgLatencyOfApplyReplication )
+            S_DEFINE_AVG_COUNTER( 9, AvgCommitGroupSize )
         END_COUNTER_SET_INSTANCE()
     };
 
@@ -80,6 +80,25 @@ ktl::Awaitable<ErrorCode> TSComponent::TryCatchAsync(StringLiteral const & tag,
     }
 }
 
+ktl::Awaitable<ErrorCode> TSComponent::TryCatchAsync(StringLiteral const & tag, __in ktl::Awaitable<bool> && awaitable, __out bool & result) const
+{
+    return this->TryCatchAsync(tag, awaitable, result);
+}
+
+ktl::Awaitable<ErrorCode> TSComponent::TryCatchAsync(StringLiteral const & tag, __in ktl::Awaitable<bool> & awaitable, __out bool & result) const
+{
+    try
+    {
+        result = co_await awaitable;
+
+        co_return ErrorCodeValue::Success;
+    }
+    catch (ktl::Exception const & ex)
+    {
+        co_return FromException(tag, ex);
+    }
+}
+
 ErrorCode TSComponent::FromNtStatus(StringLiteral const & tag, NTSTATUS status) const
 {
     if (NT_SUCCESS(status))
@@ -61,6 +61,8 @@ namespace Store
         ktl::Awaitable<Common::ErrorCode> TryCatchAsync(StringLiteral const & tag, __in ktl::Awaitable<void> &) const;
         ktl::Awaitable<Common::ErrorCode> TryCatchAsync(StringLiteral const & tag, __in ktl::Awaitable<void> &&) const;
         ktl::Awaitable<Common::ErrorCode> TryCatchAsync(StringLiteral const & tag, __in ktl::Awaitable<Common::ErrorCode> &) const;
+        ktl::Awaitable<Common::ErrorCode> TryCatchAsync(StringLiteral const & tag, __in ktl::Awaitable<bool> &, __out bool & result) const;
+        ktl::Awaitable<Common::ErrorCode> TryCatchAsync(StringLiteral const & tag, __in ktl::Awaitable<bool> &&, __out bool & result) const;
 
         Common::ErrorCode FromNtStatus(StringLiteral const & tag, NTSTATUS) const;
 
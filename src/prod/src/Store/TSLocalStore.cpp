@@ -527,6 +527,7 @@ TSLocalStore::TSLocalStore(
     , mockReplicaId_(0)
     , innerStore_()
     , innerStoreLock_()
+    , lsnIndex_()
     , isActive_(false)
     , test_ShouldCleanup_(false)
 {
@@ -593,7 +594,20 @@ ErrorCode TSLocalStore::CreateEnumerationByTypeAndKey(
 {
     TRY_GET_STORE_ROOT()
 
-    return storeRoot->GetReplicatedStore()->CreateEnumerationByTypeAndKey(transaction, type, keyStart, enumSPtr);
+    auto & store = *storeRoot->GetReplicatedStore();
+
+    if (!lsnIndex_.IsEnabled)
+    {
+        return store.CreateEnumerationByTypeAndKey(transaction, type, keyStart, enumSPtr);
+    }
+
+    EnumerationSPtr innerEnum;
+    auto error = store.CreateEnumerationByTypeAndKey(transaction, type, keyStart, innerEnum);
+    if (!error.IsSuccess()) { return error; }
+
+    enumSPtr = TSOperationLsnIndex::WrapEnumerationByTypeAndKey(store, transaction, move(innerEnum));
+
+    return error;
 }
 
 ErrorCode TSLocalStore::Initialize(wstring const &)
@@ -653,6 +667,21 @@ ErrorCode TSLocalStore::Initialize(std::wstring const & instanceName, Federation
     //
     storeRoot->GetReplicatedStore()->WaitForInitialization();
 
+    error = lsnIndex_.Open(
+        *storeRoot->GetReplicatedStore(),
+        StoreConfig::GetConfig().EnableTStoreOperationLsnIndex,
+        storeRoot->GetReplicatedStore()->IsNewStore);
+    if (!error.IsSuccess())
+    {
+        WriteWarning(
+            TraceComponent,
+            "{0} failed to open operation LSN index: {1}",
+            this->TraceId,
+            error);
+
+        return error;
+    }
+
     WriteInfo(
         TraceComponent,
         "{0} inner store and replicator initialized",
@@ -786,12 +815,32 @@ ErrorCode TSLocalStore::Insert(
     _int64 operationNumber,
     FILETIME const * lastModifiedOnPrimaryUtc)
 {
-    UNREFERENCED_PARAMETER(operationNumber);
     UNREFERENCED_PARAMETER(lastModifiedOnPrimaryUtc);
 
     TRY_GET_STORE_ROOT()
 
-    return storeRoot->GetReplicatedStore()->Insert(transaction, type, key, value, valueSizeInBytes);
+    auto & store = *storeRoot->GetReplicatedStore();
+
+    auto error = store.Insert(transaction, type, key, value, valueSizeInBytes);
+    if (!error.IsSuccess() || !lsnIndex_.IsEnabled) { return error; }
+
+    // The row did not exist, so neither did its index entry unless the row was
+    // deleted while the index was disabled
+    //
+    _int64 currentLsn = TSOperationLsnIndex::NotIndexed;
+    if (!lsnIndex_.IsComplete)
+    {
+        error = TSOperationLsnIndex::GetOperationLSN(store, transaction, type, key, currentLsn);
+        if (!error.IsSuccess()) { return error; }
+    }
+
+    return TSOperationLsnIndex::SetOperationLSN(
+        store, 
+        transaction, 
+        type, 
+        key, 
+        currentLsn, 
+        operationNumber);
 }
 
 ErrorCode TSLocalStore::Update(
@@ -805,12 +854,31 @@ ErrorCode TSLocalStore::Update(
     __in _int64 operationNumber,
     __in FILETIME const * lastModifiedOnPrimaryUtc)
 {
-    UNREFERENCED_PARAMETER(operationNumber);
     UNREFERENCED_PARAMETER(lastModifiedOnPrimaryUtc);
 
     TRY_GET_STORE_ROOT()
 
-    return storeRoot->GetReplicatedStore()->Update(transaction, type, key, checkOperationNumber, newKey, newValue, valueSizeInBytes);
+    auto & store = *storeRoot->GetReplicatedStore();
+
+    if (!lsnIndex_.IsEnabled)
+    {
+        return store.Update(transaction, type, key, checkOperationNumber, newKey, newValue, valueSizeInBytes);
+    }
+
+    _int64 currentLsn = 0;
+    auto error = TSOperationLsnIndex::GetOperationLSN(store, transaction, type, key, currentLsn);
+    if (!error.IsSuccess()) { return error; }
+
+    error = TSOperationLsnIndex::ResolveCheckOperationNumber(currentLsn, checkOperationNumber);
+    if (!error.IsSuccess()) { return error; }
+
+    error = store.Update(transaction, type, key, checkOperationNumber, newKey, newValue, valueSizeInBytes);
+    if (!error.IsSuccess()) { return error; }
+
+    // An unspecified operation number moves the row to UnassignedLSN until
+    // UpdateOperationLSN() is called (e.g. on commit by ReplicatedStore)
+    //
+    return TSOperationLsnIndex::SetOperationLSN(store, transaction, type, key, currentLsn, operationNumber);
 }
 
 ErrorCode TSLocalStore::Delete(
@@ -821,46 +889,108 @@ ErrorCode TSLocalStore::Delete(
 {
     TRY_GET_STORE_ROOT()
 
-    return storeRoot->GetReplicatedStore()->Delete(transaction, type, key, checkOperationNumber);
+    auto & store = *storeRoot->GetReplicatedStore();
+
+    if (!lsnIndex_.IsEnabled)
+    {
+        return store.Delete(transaction, type, key, checkOperationNumber);
+    }
+
+    _int64 currentLsn = 0;
+    auto error = TSOperationLsnIndex::GetOperationLSN(store, transaction, type, key, currentLsn);
+    if (!error.IsSuccess()) { return error; }
+
+    error = TSOperationLsnIndex::ResolveCheckOperationNumber(currentLsn, checkOperationNumber);
+    if (!error.IsSuccess()) { return error; }
+
+    error = store.Delete(transaction, type, key, checkOperationNumber);
+    if (!error.IsSuccess()) { return error; }
+
+    return TSOperationLsnIndex::Remove(store, transaction, type, key, currentLsn);
 }
 
 ErrorCode TSLocalStore::UpdateOperationLSN(
-    TransactionSPtr const &,
-    std::wstring const &,
-    std::wstring const &,
-    ::FABRIC_SEQUENCE_NUMBER)
+    TransactionSPtr const & transaction,
+    std::wstring const & type,
+    std::wstring const & key,
+    ::FABRIC_SEQUENCE_NUMBER operationLSN)
 {
-    WriteWarning(
-        TraceComponent,
-        "{0} UpdateOperationLSN not implemented",
-        this->TraceId);
+    if (!lsnIndex_.IsEnabled)
+    {
+        WriteWarning(
+            TraceComponent,
+            "{0} UpdateOperationLSN not supported: operation LSN index disabled",
+            this->TraceId);
 
-    return ErrorCodeValue::NotImplemented;
+        return ErrorCodeValue::NotImplemented;
+    }
+
+    TRY_GET_STORE_ROOT()
+
+    auto & store = *storeRoot->GetReplicatedStore();
+
+    _int64 currentLsn = 0;
+    auto error = TSOperationLsnIndex::GetOperationLSN(store, transaction, type, key, currentLsn);
+    if (!error.IsSuccess()) { return error; }
+
+    // An index entry implies the row exists. Otherwise, check the row itself.
+    //
+    if (currentLsn == TSOperationLsnIndex::NotIndexed)
+    {
+        vector<byte> unusedValue;
+        _int64 unusedLsn;
+        error = store.ReadExact(transaction, type, key, unusedValue, unusedLsn);
+        if (!error.IsSuccess()) { return error; }
+    }
+
+    return TSOperationLsnIndex::SetOperationLSN(store, transaction, type, key, currentLsn, operationLSN);
 }
 
 ErrorCode TSLocalStore::CreateEnumerationByOperationLSN(
-    TransactionSPtr const &,
-    _int64,
-    __out EnumerationSPtr &)
+    TransactionSPtr const & transaction,
+    _int64 fromOperationNumber,
+    __out EnumerationSPtr & enumSPtr)
 {
-    WriteWarning(
-        TraceComponent,
-        "{0} CreateEnumerationByOperationLSN not implemented",
-        this->TraceId);
+    if (!lsnIndex_.IsComplete)
+    {
+        WriteWarning(
+            TraceComponent,
+            "{0} CreateEnumerationByOperationLSN not supported: operation LSN index enabled={1} complete={2}",
+            this->TraceId,
+            lsnIndex_.IsEnabled,
+            lsnIndex_.IsComplete);
 
-    return ErrorCodeValue::NotImplemented;
+        return ErrorCodeValue::NotImplemented;
+    }
+
+    TRY_GET_STORE_ROOT()
+
+    return TSOperationLsnIndex::CreateEnumerationByOperationLSN(
+        *storeRoot->GetReplicatedStore(), 
+        transaction, 
+        fromOperationNumber, 
+        enumSPtr);
 }
 
 ErrorCode TSLocalStore::GetLastChangeOperationLSN(
-    TransactionSPtr const &,
-    __out ::FABRIC_SEQUENCE_NUMBER &)
+    TransactionSPtr const & transaction,
+    __out ::FABRIC_SEQUENCE_NUMBER & operationLSN)
 {
-    WriteWarning(
-        TraceComponent,
-        "{0} GetLastChangeOperationLSN not implemented",
-        this->TraceId);
+    if (!lsnIndex_.IsComplete)
+    {
+        WriteWarning(
+            TraceComponent,
+            "{0} GetLastChangeOperationLSN not supported: operation LSN index enabled={1} complete={2}",
+            this->TraceId,
+            lsnIndex_.IsEnabled,
+            lsnIndex_.IsComplete);
 
-    return ErrorCodeValue::NotImplemented;
+        return ErrorCodeValue::NotImplemented;
+    }
+
+    TRY_GET_STORE_ROOT()
+
+    return lsnIndex_.GetLastOperationLSN(*storeRoot->GetReplicatedStore(), transaction, operationLSN);
 }
 
 #if defined(PLATFORM_UNIX)
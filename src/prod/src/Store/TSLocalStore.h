@@ -158,6 +158,8 @@ namespace Store
         mutable Common::RwLock innerStoreLock_;
         Common::ComPointer<IFabricReplicator> replicator_;
 
+        TSOperationLsnIndex lsnIndex_;
+
         Common::atomic_bool isActive_;
 
         bool test_ShouldCleanup_;
@@ -0,0 +1,577 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+using namespace Common;
+using namespace std;
+using namespace Store;
+
+StringLiteral const TraceComponent("TSOperationLsnIndex");
+
+GlobalWString TSOperationLsnIndex::IndexDataType = make_global<wstring>(L"TSOperationLsnIndex");
+GlobalWString TSOperationLsnIndex::KeyMapDataType = make_global<wstring>(L"TSOperationLsnByKey");
+GlobalWString TSOperationLsnIndex::StateDataType = make_global<wstring>(L"TSOperationLsnIndexState");
+GlobalWString TSOperationLsnIndex::CompleteStateKey = make_global<wstring>(L"Complete");
+
+//
+// Enumerates rows in operation LSN order by scanning the index. Row values are
+// read lazily since most consumers only look at the type and key of each row.
+//
+class TSOperationLsnIndex::LsnOrderEnumeration : public IStoreBase::EnumerationBase
+{
+    DENY_COPY(LsnOrderEnumeration)
+
+public:
+    LsnOrderEnumeration(
+        TSReplicatedStore & store,
+        IStoreBase::TransactionSPtr const & txSPtr,
+        IStoreBase::EnumerationSPtr && indexEnum)
+        : root_(store.Root.CreateComponentRoot())
+        , store_(store)
+        , txSPtr_(txSPtr)
+        , indexEnum_(move(indexEnum))
+        , currentLsn_(0)
+        , currentType_()
+        , currentKey_()
+        , currentValue_()
+        , isValueLoaded_(false)
+    {
+    }
+
+    ErrorCode MoveNext() override
+    {
+        ErrorCode error;
+        while ((error = indexEnum_->MoveNext()).IsSuccess())
+        {
+            wstring indexKey;
+            error = indexEnum_->CurrentKey(indexKey);
+            if (!error.IsSuccess()) { return error; }
+
+            if (TryParseIndexKey(indexKey, currentLsn_, currentType_, currentKey_))
+            {
+                currentValue_.clear();
+                isValueLoaded_ = false;
+
+                return ErrorCodeValue::Success;
+            }
+
+            WriteWarning(
+                TraceComponent,
+                "skipping invalid index key '{0}'",
+                indexKey);
+        }
+
+        return error;
+    }
+
+    ErrorCode CurrentOperationLSN(__inout _int64 & operationNumber) override
+    {
+        operationNumber = currentLsn_;
+
+        return ErrorCodeValue::Success;
+    }
+
+    ErrorCode CurrentLastModifiedFILETIME(__inout FILETIME & fileTime) override
+    {
+        FILETIME result = {0};
+        fileTime = result;
+
+        return ErrorCodeValue::Success;
+    }
+
+    ErrorCode CurrentLastModifiedOnPrimaryFILETIME(__inout FILETIME & fileTime) override
+    {
+        FILETIME result = {0};
+        fileTime = result;
+
+        return ErrorCodeValue::Success;
+    }
+
+    ErrorCode CurrentType(__inout wstring & type) override
+    {
+        type = currentType_;
+
+        return ErrorCodeValue::Success;
+    }
+
+    ErrorCode CurrentKey(__inout wstring & key) override
+    {
+        key = currentKey_;
+
+        return ErrorCodeValue::Success;
+    }
+
+    ErrorCode CurrentValue(__inout vector<byte> & value) override
+    {
+        auto error = this->LoadValueIfNeeded();
+        if (!error.IsSuccess()) { return error; }
+
+        value = currentValue_;
+
+        return ErrorCodeValue::Success;
+    }
+
+    ErrorCode CurrentValueSize(__inout size_t & size) override
+    {
+        auto error = this->LoadValueIfNeeded();
+        if (!error.IsSuccess()) { return error; }
+
+        size = currentValue_.size();
+
+        return ErrorCodeValue::Success;
+    }
+
+private:
+    ErrorCode LoadValueIfNeeded()
+    {
+        if (isValueLoaded_) { return ErrorCodeValue::Success; }
+
+        _int64 unusedLsn;
+        auto error = store_.ReadExact(txSPtr_, currentType_, currentKey_, currentValue_, unusedLsn);
+        if (!error.IsSuccess()) { return error; }
+
+        isValueLoaded_ = true;
+
+        return ErrorCodeValue::Success;
+    }
+
+    ComponentRootSPtr root_;
+    TSReplicatedStore & store_;
+    IStoreBase::TransactionSPtr txSPtr_;
+    IStoreBase::EnumerationSPtr indexEnum_;
+
+    _int64 currentLsn_;
+    wstring currentType_;
+    wstring currentKey_;
+    vector<byte> currentValue_;
+    bool isValueLoaded_;
+};
+
+//
+// Enumerates rows in type and key order, reporting indexed LSNs where available.
+// Index rows are internal and skipped, which also keeps them out of full copies.
+//
+class TSOperationLsnIndex::KeyOrderEnumeration : public IStoreBase::EnumerationBase
+{
+    DENY_COPY(KeyOrderEnumeration)
+
+public:
+    KeyOrderEnumeration(
+        TSReplicatedStore & store,
+        IStoreBase::TransactionSPtr const & txSPtr,
+        IStoreBase::EnumerationSPtr && innerEnum)
+        : root_(store.Root.CreateComponentRoot())
+        , store_(store)
+        , txSPtr_(txSPtr)
+        , innerEnum_(move(innerEnum))
+    {
+    }
+
+    ErrorCode MoveNext() override
+    {
+        ErrorCode error;
+        while ((error = innerEnum_->MoveNext()).IsSuccess())
+        {
+            wstring type;
+            error = innerEnum_->CurrentType(type);
+            if (!error.IsSuccess()) { return error; }
+
+            if (!IsIndexDataType(type)) { break; }
+        }
+
+        return error;
+    }
+
+    ErrorCode CurrentOperationLSN(__inout _int64 & operationNumber) override
+    {
+        wstring type;
+        auto error = innerEnum_->CurrentType(type);
+        if (!error.IsSuccess()) { return error; }
+
+        wstring key;
+        error = innerEnum_->CurrentKey(key);
+        if (!error.IsSuccess()) { return error; }
+
+        error = GetOperationLSN(store_, txSPtr_, type, key, operationNumber);
+        if (!error.IsSuccess()) { return error; }
+
+        if (operationNumber == NotIndexed || operationNumber == UnassignedLSN)
+        {
+            return innerEnum_->CurrentOperationLSN(operationNumber);
+        }
+
+        return error;
+    }
+
+    ErrorCode CurrentLastModifiedFILETIME(__inout FILETIME & fileTime) override { return innerEnum_->CurrentLastModifiedFILETIME(fileTime); }
+    ErrorCode CurrentLastModifiedOnPrimaryFILETIME(__inout FILETIME & fileTime) override { return innerEnum_->CurrentLastModifiedOnPrimaryFILETIME(fileTime); }
+    ErrorCode CurrentType(__inout wstring & type) override { return innerEnum_->CurrentType(type); }
+    ErrorCode CurrentKey(__inout wstring & key) override { return innerEnum_->CurrentKey(key); }
+    ErrorCode CurrentValue(__inout vector<byte> & value) override { return innerEnum_->CurrentValue(value); }
+    ErrorCode CurrentValueSize(__inout size_t & size) override { return innerEnum_->CurrentValueSize(size); }
+
+private:
+    ComponentRootSPtr root_;
+    TSReplicatedStore & store_;
+    IStoreBase::TransactionSPtr txSPtr_;
+    IStoreBase::EnumerationSPtr innerEnum_;
+};
+
+TSOperationLsnIndex::TSOperationLsnIndex()
+    : isEnabled_(false)
+    , isComplete_(false)
+    , lastOperationLsnHint_(0)
+{
+}
+
+ErrorCode TSOperationLsnIndex::Open(
+    TSReplicatedStore & store,
+    bool isEnabled,
+    bool isNewStore)
+{
+    isEnabled_ = isEnabled;
+    isComplete_ = false;
+
+    IStoreBase::TransactionSPtr txSPtr;
+    auto error = store.CreateTransaction(txSPtr);
+    if (!error.IsSuccess()) { return error; }
+
+    vector<byte> unusedValue;
+    _int64 unusedLsn;
+    error = store.ReadExact(txSPtr, *StateDataType, *CompleteStateKey, unusedValue, unusedLsn);
+
+    bool markerExists = error.IsSuccess();
+    if (!markerExists && !error.IsError(ErrorCodeValue::NotFound)) { return error; }
+
+    if (isEnabled && !markerExists && isNewStore)
+    {
+        byte marker = 1;
+        error = store.Insert(txSPtr, *StateDataType, *CompleteStateKey, &marker, sizeof(marker));
+        if (!error.IsSuccess()) { return error; }
+
+        error = txSPtr->Commit();
+        if (!error.IsSuccess()) { return error; }
+
+        markerExists = true;
+    }
+    else if (!isEnabled && markerExists)
+    {
+        // Writes are no longer indexed, so the index can never become complete again
+        //
+        error = store.Delete(txSPtr, *StateDataType, *CompleteStateKey);
+        if (!error.IsSuccess()) { return error; }
+
+        error = txSPtr->Commit();
+        if (!error.IsSuccess()) { return error; }
+
+        markerExists = false;
+    }
+    else
+    {
+        txSPtr->Rollback();
+    }
+
+    isComplete_ = (isEnabled && markerExists);
+
+    if (isEnabled && !isComplete_)
+    {
+        WriteWarning(
+            TraceComponent,
+            "index is incomplete since the store predates it: enumeration by operation LSN is not supported");
+    }
+    else
+    {
+        WriteInfo(
+            TraceComponent,
+            "opened: enabled={0} complete={1} new={2}",
+            isEnabled_,
+            isComplete_,
+            isNewStore);
+    }
+
+    return ErrorCodeValue::Success;
+}
+
+bool TSOperationLsnIndex::IsIndexDataType(wstring const & type)
+{
+    return (type == *IndexDataType || type == *KeyMapDataType || type == *StateDataType);
+}
+
+ErrorCode TSOperationLsnIndex::GetOperationLSN(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    wstring const & type,
+    wstring const & key,
+    __out _int64 & operationLSN)
+{
+    auto error = ReadOperationLSN(store, txSPtr, *KeyMapDataType, CreateKeyMapKey(type, key), operationLSN);
+
+    if (error.IsError(ErrorCodeValue::NotFound))
+    {
+        operationLSN = NotIndexed;
+
+        return ErrorCodeValue::Success;
+    }
+
+    return error;
+}
+
+ErrorCode TSOperationLsnIndex::SetOperationLSN(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    wstring const & type,
+    wstring const & key,
+    _int64 currentLSN,
+    _int64 operationLSN)
+{
+    if (operationLSN == ILocalStore::OperationNumberUnspecified) { operationLSN = UnassignedLSN; }
+
+    if (currentLSN == operationLSN) { return ErrorCodeValue::Success; }
+
+    auto keyMapKey = CreateKeyMapKey(type, key);
+    auto const * lsnBytes = reinterpret_cast<void const *>(&operationLSN);
+
+    ErrorCode error;
+    if (currentLSN == NotIndexed)
+    {
+        error = store.Insert(txSPtr, *KeyMapDataType, keyMapKey, lsnBytes, sizeof(operationLSN));
+    }
+    else
+    {
+        error = store.Delete(txSPtr, *IndexDataType, CreateIndexKey(currentLSN, keyMapKey));
+        if (!error.IsSuccess() && !error.IsError(ErrorCodeValue::StoreRecordNotFound)) { return error; }
+
+        error = store.Update(
+            txSPtr,
+            *KeyMapDataType,
+            keyMapKey,
+            ILocalStore::SequenceNumberIgnore,
+            keyMapKey,
+            lsnBytes,
+            sizeof(operationLSN));
+    }
+
+    if (!error.IsSuccess()) { return error; }
+
+    return store.Insert(txSPtr, *IndexDataType, CreateIndexKey(operationLSN, keyMapKey), lsnBytes, sizeof(operationLSN));
+}
+
+ErrorCode TSOperationLsnIndex::Remove(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    wstring const & type,
+    wstring const & key,
+    _int64 currentLSN)
+{
+    if (currentLSN == NotIndexed) { return ErrorCodeValue::Success; }
+
+    auto keyMapKey = CreateKeyMapKey(type, key);
+
+    auto error = store.Delete(txSPtr, *IndexDataType, CreateIndexKey(currentLSN, keyMapKey));
+    if (!error.IsSuccess() && !error.IsError(ErrorCodeValue::StoreRecordNotFound)) { return error; }
+
+    return store.Delete(txSPtr, *KeyMapDataType, keyMapKey);
+}
+
+ErrorCode TSOperationLsnIndex::ResolveCheckOperationNumber(
+    _int64 currentLSN,
+    __inout _int64 & checkOperationNumber)
+{
+    // Both SequenceNumberIgnore and OperationNumberUnspecified skip the check.
+    // Rows without an assigned LSN are checked by TStore against its own LSN.
+    //
+    if (checkOperationNumber <= ILocalStore::SequenceNumberIgnore) { return ErrorCodeValue::Success; }
+
+    if (currentLSN == NotIndexed || currentLSN == UnassignedLSN) { return ErrorCodeValue::Success; }
+
+    if (currentLSN != checkOperationNumber)
+    {
+        return ErrorCodeValue::StoreWriteConflict;
+    }
+
+    checkOperationNumber = ILocalStore::SequenceNumberIgnore;
+
+    return ErrorCodeValue::Success;
+}
+
+ErrorCode TSOperationLsnIndex::CreateEnumerationByOperationLSN(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    _int64 fromOperationLSN,
+    __out IStoreBase::EnumerationSPtr & enumSPtr)
+{
+    IStoreBase::EnumerationSPtr indexEnum;
+    auto error = store.CreateEnumerationByTypeAndKey(
+        txSPtr,
+        *IndexDataType,
+        CreateIndexKeyPrefix(fromOperationLSN),
+        indexEnum);
+    if (!error.IsSuccess()) { return error; }
+
+    enumSPtr = make_shared<LsnOrderEnumeration>(store, txSPtr, move(indexEnum));
+
+    return ErrorCodeValue::Success;
+}
+
+IStoreBase::EnumerationSPtr TSOperationLsnIndex::WrapEnumerationByTypeAndKey(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    IStoreBase::EnumerationSPtr && innerEnum)
+{
+    return make_shared<KeyOrderEnumeration>(store, txSPtr, move(innerEnum));
+}
+
+ErrorCode TSOperationLsnIndex::GetLastOperationLSN(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    __out _int64 & operationLSN)
+{
+    auto hint = static_cast<_int64>(lastOperationLsnHint_.load());
+
+    auto error = this->ScanLastOperationLSN(store, txSPtr, hint, operationLSN);
+
+    // Nothing at or past the hint, which can happen when the transaction's snapshot
+    // predates the hint or index entries were removed. Fall back to a full scan.
+    //
+    if (error.IsSuccess() && operationLSN == 0 && hint > 0)
+    {
+        WriteInfo(
+            TraceComponent,
+            "no index entries at or past hint {0}: performing full scan",
+            hint);
+
+        error = this->ScanLastOperationLSN(store, txSPtr, 0, operationLSN);
+    }
+
+    if (error.IsSuccess())
+    {
+        lastOperationLsnHint_.store(static_cast<uint64>(operationLSN));
+    }
+
+    return error;
+}
+
+ErrorCode TSOperationLsnIndex::ScanLastOperationLSN(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    _int64 fromOperationLSN,
+    __out _int64 & operationLSN)
+{
+    operationLSN = 0;
+
+    IStoreBase::EnumerationSPtr indexEnum;
+    auto error = store.CreateEnumerationByTypeAndKey(
+        txSPtr,
+        *IndexDataType,
+        CreateIndexKeyPrefix(fromOperationLSN),
+        indexEnum);
+    if (!error.IsSuccess()) { return error; }
+
+    wstring lastIndexKey;
+    while ((error = indexEnum->MoveNext()).IsSuccess())
+    {
+        error = indexEnum->CurrentKey(lastIndexKey);
+        if (!error.IsSuccess()) { return error; }
+    }
+
+    if (!error.IsError(ErrorCodeValue::EnumerationCompleted)) { return error; }
+
+    if (!lastIndexKey.empty())
+    {
+        wstring unusedType;
+        wstring unusedKey;
+        if (!TryParseIndexKey(lastIndexKey, operationLSN, unusedType, unusedKey))
+        {
+            WriteWarning(
+                TraceComponent,
+                "invalid index key '{0}'",
+                lastIndexKey);
+
+            return ErrorCodeValue::StoreUnexpectedError;
+        }
+    }
+
+    return ErrorCodeValue::Success;
+}
+
+ErrorCode TSOperationLsnIndex::ReadOperationLSN(
+    TSReplicatedStore & store,
+    IStoreBase::TransactionSPtr const & txSPtr,
+    wstring const & dataType,
+    wstring const & dataKey,
+    __out _int64 & operationLSN)
+{
+    vector<byte> value;
+    _int64 unusedLsn;
+    auto error = store.ReadExact(txSPtr, dataType, dataKey, value, unusedLsn);
+    if (!error.IsSuccess()) { return error; }
+
+    if (value.size() != sizeof(operationLSN))
+    {
+        WriteWarning(
+            TraceComponent,
+            "invalid LSN value size {0}: type='{1}' key='{2}'",
+            value.size(),
+            dataType,
+            dataKey);
+
+        return ErrorCodeValue::StoreUnexpectedError;
+    }
+
+    memcpy(&operationLSN, value.data(), sizeof(operationLSN));
+
+    return ErrorCodeValue::Success;
+}
+
+wstring TSOperationLsnIndex::CreateKeyMapKey(wstring const & type, wstring const & key)
+{
+    // Length prefix keeps the encoding unambiguous for types containing ':'
+    //
+    return wformatString("{0}:{1}:{2}", type.size(), type, key);
+}
+
+wstring TSOperationLsnIndex::CreateIndexKey(_int64 operationLSN, wstring const & keyMapKey)
+{
+    return wformatString("{0}_{1}", CreateIndexKeyPrefix(operationLSN), keyMapKey);
+}
+
+wstring TSOperationLsnIndex::CreateIndexKeyPrefix(_int64 operationLSN)
+{
+    // Fixed width so that lexicographic key order matches LSN order
+    //
+    auto hex = wformatString("{0:x}", static_cast<uint64>(operationLSN < 0 ? 0 : operationLSN));
+
+    return wstring(16 - hex.size(), L'0') + hex;
+}
+
+bool TSOperationLsnIndex::TryParseIndexKey(
+    wstring const & indexKey,
+    __out _int64 & operationLSN,
+    __out wstring & type,
+    __out wstring & key)
+{
+    size_t const prefixLength = 16;
+
+    if (indexKey.size() <= prefixLength || indexKey[prefixLength] != L'_') { return false; }
+
+    uint64 lsn = 0;
+    if (!StringUtility::TryFromWString<uint64>(indexKey.substr(0, prefixLength), lsn, 16)) { return false; }
+
+    auto typeLengthEnd = indexKey.find(L':', prefixLength + 1);
+    if (typeLengthEnd == wstring::npos) { return false; }
+
+    size_t typeLength = 0;
+    if (!StringUtility::TryFromWString<size_t>(indexKey.substr(prefixLength + 1, typeLengthEnd - prefixLength - 1), typeLength)) { return false; }
+
+    auto typeStart = typeLengthEnd + 1;
+    if (typeStart + typeLength >= indexKey.size() || indexKey[typeStart + typeLength] != L':') { return false; }
+
+    operationLSN = static_cast<_int64>(lsn);
+    type = indexKey.substr(typeStart, typeLength);
+    key = indexKey.substr(typeStart + typeLength + 1);
+
+    return true;
+}
@@ -0,0 +1,155 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Store
+{
+    // TStore only tracks the LSNs of its own single-replica replicator, so the
+    // operation LSNs assigned by the caller of TSLocalStore (e.g. ReplicatedStore)
+    // are maintained as a secondary index in two internal types stored in the same
+    // transaction as the data:
+    //
+    //   IndexDataType:  <lsn as 16 hex digits>_<type length>:<type>:<key> -> lsn
+    //   KeyMapDataType: <type length>:<type>:<key> -> lsn
+    //
+    // Index keys sort in LSN order, so enumerating by operation LSN is a range
+    // scan of IndexDataType starting at the requested LSN. Rows written without
+    // an operation LSN are indexed at UnassignedLSN so that a scan from LSN 0
+    // still returns every row. Only rows written before the index existed have
+    // no index entry (NotIndexed).
+    //
+    // None of the internal types is visible through enumerations by type and key.
+    //
+    // Maintaining the index is opt-in (StoreConfig::EnableTStoreOperationLsnIndex).
+    // The index is only complete if it has been maintained since the store was
+    // created, which is recorded by a marker row in StateDataType. Enumeration
+    // by operation LSN is not supported on incomplete indexes so that consumers
+    // fall back to full copies.
+    //
+    class TSOperationLsnIndex : private Common::TextTraceComponent<Common::TraceTaskCodes::ReplicatedStore>
+    {
+        DENY_COPY(TSOperationLsnIndex)
+
+    public:
+
+        static Common::GlobalWString IndexDataType;
+        static Common::GlobalWString KeyMapDataType;
+        static Common::GlobalWString StateDataType;
+
+        static const _int64 NotIndexed = -1;
+        static const _int64 UnassignedLSN = 0;
+
+        TSOperationLsnIndex();
+
+        __declspec(property(get=get_IsEnabled)) bool IsEnabled;
+        bool get_IsEnabled() const { return isEnabled_; }
+
+        __declspec(property(get=get_IsComplete)) bool IsComplete;
+        bool get_IsComplete() const { return isComplete_; }
+
+        // Must be called once the store is ready and before it is used. Marks
+        // the index as complete for new stores and removes the marker when the
+        // index is disabled since writes will no longer be indexed.
+        //
+        Common::ErrorCode Open(
+            __in TSReplicatedStore &,
+            __in bool isEnabled,
+            __in bool isNewStore);
+
+        static bool IsIndexDataType(std::wstring const & type);
+
+        // Returns NotIndexed in operationLSN if the row has no index entry
+        //
+        static Common::ErrorCode GetOperationLSN(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __out _int64 & operationLSN);
+
+        // currentLSN is the result of GetOperationLSN() for the row (or NotIndexed
+        // for a newly inserted row) so that callers only read the index once per
+        // write. OperationNumberUnspecified indexes the row at UnassignedLSN.
+        //
+        static Common::ErrorCode SetOperationLSN(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 currentLSN,
+            __in _int64 operationLSN);
+
+        static Common::ErrorCode Remove(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 currentLSN);
+
+        // Performs the optimistic concurrency check against the indexed LSN since the
+        // caller only sees indexed LSNs. On success, checkOperationNumber is either
+        // unchanged (no assigned LSN) or cleared (check already performed).
+        //
+        static Common::ErrorCode ResolveCheckOperationNumber(
+            __in _int64 currentLSN,
+            __inout _int64 & checkOperationNumber);
+
+        static Common::ErrorCode CreateEnumerationByOperationLSN(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __in _int64 fromOperationLSN,
+            __out IStoreBase::EnumerationSPtr &);
+
+        // Wraps an enumeration by type and key so that CurrentOperationLSN()
+        // reports indexed LSNs.
+        //
+        static IStoreBase::EnumerationSPtr WrapEnumerationByTypeAndKey(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __in IStoreBase::EnumerationSPtr &&);
+
+        Common::ErrorCode GetLastOperationLSN(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __out _int64 & operationLSN);
+
+    private:
+
+        class LsnOrderEnumeration;
+        class KeyOrderEnumeration;
+
+        static Common::GlobalWString CompleteStateKey;
+
+        static std::wstring CreateKeyMapKey(std::wstring const & type, std::wstring const & key);
+        static std::wstring CreateIndexKey(_int64 operationLSN, std::wstring const & keyMapKey);
+        static std::wstring CreateIndexKeyPrefix(_int64 operationLSN);
+        static Common::ErrorCode ReadOperationLSN(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __in std::wstring const & dataType,
+            __in std::wstring const & dataKey,
+            __out _int64 & operationLSN);
+        static bool TryParseIndexKey(
+            std::wstring const & indexKey,
+            __out _int64 & operationLSN,
+            __out std::wstring & type,
+            __out std::wstring & key);
+
+        Common::ErrorCode ScanLastOperationLSN(
+            __in TSReplicatedStore &,
+            __in IStoreBase::TransactionSPtr const &,
+            __in _int64 fromOperationLSN,
+            __out _int64 & operationLSN);
+
+        bool isEnabled_;
+        bool isComplete_;
+
+        // Highest LSN returned by GetLastOperationLSN(). Used as the starting point of
+        // the next scan, falling back to a full scan if no index entries exist past it.
+        //
+        Common::atomic_uint64 lastOperationLsnHint_;
+    };
+}
@@ -400,6 +400,7 @@ TSReplicatedStore::TSReplicatedStore(
     , initializationTimer_()
     , initializationTimerLock_()
     , initializedEvent_(false)
+    , isNewStore_(false)
     , replicaRole_(FABRIC_REPLICA_ROLE_NONE)
     , isActive_(true)
     , testHookContext_()
@@ -520,28 +521,83 @@ ErrorCode TSReplicatedStore::ReadExact(
     auto error = this->CreateKey(type, key, kKey);
     if (!error.IsSuccess()) { return error; }
 
-    auto storeTx = this->GetTStoreTransaction(txSPtr);
-    auto innerStore = this->TryGetTStore();
+    return SyncAwait(this->ReadExactAsync(this->GetTStoreTransaction(txSPtr), kKey, value, operationLsn));
+}
+
+AsyncOperationSPtr TSReplicatedStore::BeginReadExact(
+    __in TransactionSPtr const & txSPtr,
+    __in wstring const & type,
+    __in wstring const & key,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    auto operation = AsyncOperation::CreateAndStart<ReadExactAsyncOperation>(callback, parent);
+
+    KString::SPtr kKey;
+    ErrorCode error = this->HasReadStatus() ? this->CreateKey(type, key, kKey) : ErrorCode(ErrorCodeValue::NotPrimary);
+
+    if (error.IsSuccess())
+    {
+        this->ReadExactTask(operation, txSPtr, move(kKey));
+    }
+    else
+    {
+        AsyncOperation::Get<ReadExactAsyncOperation>(operation)->Complete(operation, error, vector<byte>(), 0);
+    }
+
+    return operation;
+}
+
+ktl::Task TSReplicatedStore::ReadExactTask(
+    AsyncOperationSPtr operation,
+    TransactionSPtr txSPtr,
+    KString::SPtr kKey)
+{
+    auto selfRoot = this->Root.CreateComponentRoot();
+
+    vector<byte> value;
+    __int64 operationLsn = 0;
+    auto error = co_await this->ReadExactAsync(this->GetTStoreTransaction(txSPtr), kKey, value, operationLsn);
 
+    // Do not TryComplete in a coroutine. This will call back into a thread
+    // that may use SyncAwait(), which can cause deadlocks when used on a 
+    // KTL thread.
+    //
+    Threadpool::Post([operation, selfRoot, error, value = move(value), operationLsn]() mutable
+    {
+        AsyncOperation::Get<ReadExactAsyncOperation>(operation)->Complete(operation, error, move(value), operationLsn);
+    });
+
+    co_return;
+}
+
+ktl::Awaitable<ErrorCode> TSReplicatedStore::ReadExactAsync(
+    IKvsTransaction::SPtr const & storeTx,
+    KString::SPtr const & kKey,
+    __out vector<byte> & value,
+    __out __int64 & operationLsn)
+{
     bool exists = false;
     IKvsGetEntry entry;
-    TRY_CATCH_VOID( exists = SyncAwait(innerStore->ConditionalGetAsync(
+    auto error = co_await this->TryCatchAsync("ConditionalGetAsync", this->TryGetTStore()->ConditionalGetAsync(
         *storeTx, 
         kKey,
         TimeSpan::MaxValue,
         entry, // out
-        CancellationToken::None)) );
+        CancellationToken::None), exists);
+
+    CO_RETURN_IF_ERROR( error )
 
     if (exists)
     {
         value = ToByteVector(entry.Value);
         operationLsn = entry.Key;
 
-        return ErrorCodeValue::Success;
+        co_return ErrorCodeValue::Success;
     }
     else
     {
-        return ErrorCodeValue::NotFound;
+        co_return ErrorCodeValue::NotFound;
     }
 }
 
@@ -589,12 +645,68 @@ ErrorCode TSReplicatedStore::Insert(
     error = this->CreateBuffer(value, valueSize, buffer);
     if (!error.IsSuccess()) { return error; }
 
-    TRY_CATCH_VOID( SyncAwait(this->TryGetTStore()->AddAsync(
-        *this->GetTStoreTransaction(txSPtr),
+    return SyncAwait(this->InsertAsync(this->GetTStoreTransaction(txSPtr), type, key, kKey, buffer));
+}
+
+AsyncOperationSPtr TSReplicatedStore::BeginInsert(
+    __in TransactionSPtr const & txSPtr,
+    __in wstring const & type,
+    __in wstring const & key,
+    __in void const * value,
+    __in size_t valueSize,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    auto operation = AsyncOperation::CreateAndStart<WriteAsyncOperation>(callback, parent);
+
+    KString::SPtr kKey;
+    KBuffer::SPtr buffer;
+    auto error = this->PrepareWrite(type, key, value, valueSize, kKey, buffer);
+
+    if (error.IsSuccess())
+    {
+        this->InsertTask(operation, txSPtr, type, key, move(kKey), move(buffer));
+    }
+    else
+    {
+        operation->TryComplete(operation, error);
+    }
+
+    return operation;
+}
+
+ktl::Task TSReplicatedStore::InsertTask(
+    AsyncOperationSPtr operation,
+    TransactionSPtr txSPtr,
+    wstring type,
+    wstring key,
+    KString::SPtr kKey,
+    KBuffer::SPtr buffer)
+{
+    auto selfRoot = this->Root.CreateComponentRoot();
+
+    auto error = co_await this->InsertAsync(this->GetTStoreTransaction(txSPtr), type, key, kKey, buffer);
+
+    this->PostWriteCompletion(operation, selfRoot, error);
+
+    co_return;
+}
+
+ktl::Awaitable<ErrorCode> TSReplicatedStore::InsertAsync(
+    IKvsTransaction::SPtr const & storeTx,
+    wstring const & type,
+    wstring const & key,
+    KString::SPtr const & kKey,
+    KBuffer::SPtr const & buffer)
+{
+    auto error = co_await this->TryCatchAsync("AddAsync", this->TryGetTStore()->AddAsync(
+        *storeTx,
         kKey,
         buffer,
         storeSettings_->TStoreLockTimeout,
-        CancellationToken::None)) );
+        CancellationToken::None));
+
+    CO_RETURN_IF_ERROR( error )
 
     WriteNoise(
         TraceComponent, 
@@ -602,9 +714,9 @@ ErrorCode TSReplicatedStore::Insert(
         this->TraceId,
         type,
         key,
-        valueSize);
+        buffer->QuerySize());
 
-    return error;
+    co_return error;
 }
 
 ErrorCode TSReplicatedStore::Update(
@@ -626,30 +738,86 @@ ErrorCode TSReplicatedStore::Update(
     error = this->CreateBuffer(value, valueSize, buffer);
     if (!error.IsSuccess()) { return error; }
 
+    return SyncAwait(this->UpdateAsync(this->GetTStoreTransaction(txSPtr), type, key, kKey, buffer, checkSequenceNumber));
+}
+
+AsyncOperationSPtr TSReplicatedStore::BeginUpdate(
+    __in TransactionSPtr const & txSPtr,
+    __in wstring const & type,
+    __in wstring const & key,
+    __in _int64 checkSequenceNumber,
+    __in wstring const &,
+    __in_opt void const * value,
+    __in size_t valueSize,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    auto operation = AsyncOperation::CreateAndStart<WriteAsyncOperation>(callback, parent);
+
+    KString::SPtr kKey;
+    KBuffer::SPtr buffer;
+    auto error = this->PrepareWrite(type, key, value, valueSize, kKey, buffer);
+
+    if (error.IsSuccess())
+    {
+        this->UpdateTask(operation, txSPtr, type, key, move(kKey), move(buffer), checkSequenceNumber);
+    }
+    else
+    {
+        operation->TryComplete(operation, error);
+    }
+
+    return operation;
+}
+
+ktl::Task TSReplicatedStore::UpdateTask(
+    AsyncOperationSPtr operation,
+    TransactionSPtr txSPtr,
+    wstring type,
+    wstring key,
+    KString::SPtr kKey,
+    KBuffer::SPtr buffer,
+    _int64 checkSequenceNumber)
+{
+    auto selfRoot = this->Root.CreateComponentRoot();
+
+    auto error = co_await this->UpdateAsync(this->GetTStoreTransaction(txSPtr), type, key, kKey, buffer, checkSequenceNumber);
+
+    this->PostWriteCompletion(operation, selfRoot, error);
+
+    co_return;
+}
+
+ktl::Awaitable<ErrorCode> TSReplicatedStore::UpdateAsync(
+    IKvsTransaction::SPtr const & storeTx,
+    wstring const & type,
+    wstring const & key,
+    KString::SPtr const & kKey,
+    KBuffer::SPtr const & buffer,
+    _int64 checkSequenceNumber)
+{
     // TStore accepts 0 as a valid LSN for conditional checks.
     // EseLocalStore reserves 0 to mean ignore conditional checks.
     //
     bool success = false;
-    TRY_CATCH_VOID( success = SyncAwait(this->TryGetTStore()->ConditionalUpdateAsync(
-        *this->GetTStoreTransaction(txSPtr),
+    auto error = co_await this->TryCatchAsync("ConditionalUpdateAsync", this->TryGetTStore()->ConditionalUpdateAsync(
+        *storeTx,
         kKey,
         buffer,
         storeSettings_->TStoreLockTimeout,
         CancellationToken::None,
-        (checkSequenceNumber == ILocalStore::SequenceNumberIgnore) ? -1 : checkSequenceNumber)) );
+        (checkSequenceNumber == ILocalStore::SequenceNumberIgnore) ? -1 : checkSequenceNumber), success);
+
+    CO_RETURN_IF_ERROR( error )
 
     // TODO: Optimize in TStore by distinguishing version mismatch and not found in ConditionalUpdateAsync()
     //
     bool exists = true;
     if (!success)
     {
-        IKvsGetEntry unusedEntry;
-        TRY_CATCH_VOID( exists = SyncAwait(this->TryGetTStore()->ConditionalGetAsync(
-            *this->GetTStoreTransaction(txSPtr),
-            kKey,
-            storeSettings_->TStoreLockTimeout,
-            unusedEntry,
-            CancellationToken::None)) );
+        error = co_await this->ExistsAsync(storeTx, kKey, exists);
+
+        CO_RETURN_IF_ERROR( error )
     }
 
     WriteNoise(
@@ -659,11 +827,11 @@ ErrorCode TSReplicatedStore::Update(
         type,
         key,
         checkSequenceNumber,
-        valueSize,
+        buffer->QuerySize(),
         success,
         exists);
 
-    return success ? ErrorCodeValue::Success : (exists ? ErrorCodeValue::StoreWriteConflict : ErrorCodeValue::StoreRecordNotFound);
+    co_return success ? ErrorCodeValue::Success : (exists ? ErrorCodeValue::StoreWriteConflict : ErrorCodeValue::StoreRecordNotFound);
 }
 
 ErrorCode TSReplicatedStore::Delete(
@@ -678,26 +846,76 @@ ErrorCode TSReplicatedStore::Delete(
     auto error = this->CreateKey(type, key, kKey);
     if (!error.IsSuccess()) { return error; }
 
+    return SyncAwait(this->DeleteAsync(this->GetTStoreTransaction(txSPtr), type, key, kKey, checkSequenceNumber));
+}
+
+AsyncOperationSPtr TSReplicatedStore::BeginDelete(
+    __in TransactionSPtr const & txSPtr,
+    __in wstring const & type,
+    __in wstring const & key,
+    __in _int64 checkSequenceNumber,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    auto operation = AsyncOperation::CreateAndStart<WriteAsyncOperation>(callback, parent);
+
+    KString::SPtr kKey;
+    ErrorCode error = this->HasWriteStatus() ? this->CreateKey(type, key, kKey) : ErrorCode(ErrorCodeValue::NotPrimary);
+
+    if (error.IsSuccess())
+    {
+        this->DeleteTask(operation, txSPtr, type, key, move(kKey), checkSequenceNumber);
+    }
+    else
+    {
+        operation->TryComplete(operation, error);
+    }
+
+    return operation;
+}
+
+ktl::Task TSReplicatedStore::DeleteTask(
+    AsyncOperationSPtr operation,
+    TransactionSPtr txSPtr,
+    wstring type,
+    wstring key,
+    KString::SPtr kKey,
+    _int64 checkSequenceNumber)
+{
+    auto selfRoot = this->Root.CreateComponentRoot();
+
+    auto error = co_await this->DeleteAsync(this->GetTStoreTransaction(txSPtr), type, key, kKey, checkSequenceNumber);
+
+    this->PostWriteCompletion(operation, selfRoot, error);
+
+    co_return;
+}
+
+ktl::Awaitable<ErrorCode> TSReplicatedStore::DeleteAsync(
+    IKvsTransaction::SPtr const & storeTx,
+    wstring const & type,
+    wstring const & key,
+    KString::SPtr const & kKey,
+    _int64 checkSequenceNumber)
+{
     bool success = false;
-    TRY_CATCH_VOID( success = SyncAwait(this->TryGetTStore()->ConditionalRemoveAsync(
-        *this->GetTStoreTransaction(txSPtr),
+    auto error = co_await this->TryCatchAsync("ConditionalRemoveAsync", this->TryGetTStore()->ConditionalRemoveAsync(
+        *storeTx,
         kKey,
         storeSettings_->TStoreLockTimeout,
         CancellationToken::None,
-        (checkSequenceNumber == ILocalStore::SequenceNumberIgnore) ? -1 : checkSequenceNumber)) );
+        (checkSequenceNumber == ILocalStore::SequenceNumberIgnore) ? -1 : checkSequenceNumber), success);
+
+    CO_RETURN_IF_ERROR( error )
 
     // TODO: Optimize in TStore by distinguishing version mismatch and not found in ConditionalRemoveAsync()
     //
     bool exists = true;
     if (!success)
     {
-        IKvsGetEntry unusedEntry;
-        TRY_CATCH_VOID( exists = SyncAwait(this->TryGetTStore()->ConditionalGetAsync(
-            *this->GetTStoreTransaction(txSPtr),
-            kKey,
-            storeSettings_->TStoreLockTimeout,
-            unusedEntry,
-            CancellationToken::None)) );
+        error = co_await this->ExistsAsync(storeTx, kKey, exists);
+
+        CO_RETURN_IF_ERROR( error )
     }
 
     WriteNoise(
@@ -710,7 +928,49 @@ ErrorCode TSReplicatedStore::Delete(
         success,
         exists);
 
-    return success ? ErrorCodeValue::Success : (exists ? ErrorCodeValue::StoreWriteConflict : ErrorCodeValue::StoreRecordNotFound);
+    co_return success ? ErrorCodeValue::Success : (exists ? ErrorCodeValue::StoreWriteConflict : ErrorCodeValue::StoreRecordNotFound);
+}
+
+ktl::Awaitable<ErrorCode> TSReplicatedStore::ExistsAsync(
+    IKvsTransaction::SPtr const & storeTx,
+    KString::SPtr const & kKey,
+    __out bool & exists)
+{
+    IKvsGetEntry unusedEntry;
+    co_return co_await this->TryCatchAsync("ConditionalGetAsync", this->TryGetTStore()->ConditionalGetAsync(
+        *storeTx,
+        kKey,
+        storeSettings_->TStoreLockTimeout,
+        unusedEntry,
+        CancellationToken::None), exists);
+}
+
+ErrorCode TSReplicatedStore::PrepareWrite(
+    wstring const & type,
+    wstring const & key,
+    void const * value,
+    size_t valueSize,
+    __out KString::SPtr & kKey,
+    __out KBuffer::SPtr & buffer)
+{
+    if (!this->HasWriteStatus()) { return ErrorCodeValue::NotPrimary; }
+
+    auto error = this->CreateKey(type, key, kKey);
+    if (!error.IsSuccess()) { return error; }
+
+    return this->CreateBuffer(value, valueSize, buffer);
+}
+
+void TSReplicatedStore::PostWriteCompletion(
+    AsyncOperationSPtr const & operation,
+    ComponentRootSPtr const & selfRoot,
+    ErrorCode const & error)
+{
+    // Do not TryComplete in a coroutine. This will call back into a thread
+    // that may use SyncAwait(), which can cause deadlocks when used on a 
+    // KTL thread.
+    //
+    Threadpool::Post([operation, selfRoot, error] { operation->TryComplete(operation, error); });
 }
 
 // TODO: Used by HM
@@ -1230,6 +1490,8 @@ ktl::Awaitable<ErrorCode> TSReplicatedStore::InitializeStoreAsync(ComponentRootS
             {
                 co_return this->FromNtStatus("CommitAsync", status);
             }
+
+            isNewStore_.store(true);
         }
 
         status = txReplicator->Get(TStoreProviderName, stateProvider);
@@ -42,6 +42,12 @@ namespace Store
 
         void WaitForInitialization();
 
+        // True if the TStore state provider was created (rather than recovered)
+        // by this instance. Only meaningful after WaitForInitialization() returns.
+        //
+        __declspec(property(get=get_IsNewStore)) bool IsNewStore;
+        bool get_IsNewStore() const { return isNewStore_.load(); }
+
         void TransientFault(std::wstring const & message, Common::ErrorCode const & error);
 
     public:
@@ -111,6 +117,41 @@ namespace Store
             __in std::wstring const & key,
             __in _int64 checkOperationNumber = ILocalStore::SequenceNumberIgnore) override;
 
+        virtual Common::AsyncOperationSPtr BeginReadExact(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
+        virtual Common::AsyncOperationSPtr BeginInsert(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in void const * value,
+            __in size_t valueSizeInBytes,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
+        virtual Common::AsyncOperationSPtr BeginUpdate(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 checkOperationNumber,
+            __in std::wstring const & newKey,
+            __in_opt void const * newValue,
+            __in size_t valueSizeInBytes,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
+        virtual Common::AsyncOperationSPtr BeginDelete(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 checkOperationNumber,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
         virtual Common::ErrorCode SetThrottleCallback(ThrottleCallback const &) override;
 
         virtual Common::ErrorCode GetCurrentEpoch(__out FABRIC_EPOCH &) const override;
@@ -221,6 +262,54 @@ namespace Store
         Common::ErrorCode CreateKey(std::wstring const & type, std::wstring const & key, __out KString::SPtr &);
         Common::ErrorCode CreateBuffer(void const * value, size_t valueSize, __out KBuffer::SPtr &);
 
+        //
+        // Shared by the synchronous (SyncAwait) and asynchronous (Begin/End) data operations.
+        // The *Task functions take their arguments by value to keep them alive until completion.
+        //
+
+        ktl::Task ReadExactTask(Common::AsyncOperationSPtr, TransactionSPtr, KString::SPtr);
+        ktl::Awaitable<Common::ErrorCode> ReadExactAsync(
+            IKvsTransaction::SPtr const &,
+            KString::SPtr const &,
+            __out std::vector<byte> & value,
+            __out __int64 & operationLsn);
+
+        ktl::Task InsertTask(Common::AsyncOperationSPtr, TransactionSPtr, std::wstring type, std::wstring key, KString::SPtr, KBuffer::SPtr);
+        ktl::Awaitable<Common::ErrorCode> InsertAsync(
+            IKvsTransaction::SPtr const &,
+            std::wstring const & type,
+            std::wstring const & key,
+            KString::SPtr const &,
+            KBuffer::SPtr const &);
+
+        ktl::Task UpdateTask(Common::AsyncOperationSPtr, TransactionSPtr, std::wstring type, std::wstring key, KString::SPtr, KBuffer::SPtr, _int64 checkSequenceNumber);
+        ktl::Awaitable<Common::ErrorCode> UpdateAsync(
+            IKvsTransaction::SPtr const &,
+            std::wstring const & type,
+            std::wstring const & key,
+            KString::SPtr const &,
+            KBuffer::SPtr const &,
+            _int64 checkSequenceNumber);
+
+        ktl::Task DeleteTask(Common::AsyncOperationSPtr, TransactionSPtr, std::wstring type, std::wstring key, KString::SPtr, _int64 checkSequenceNumber);
+        ktl::Awaitable<Common::ErrorCode> DeleteAsync(
+            IKvsTransaction::SPtr const &,
+            std::wstring const & type,
+            std::wstring const & key,
+            KString::SPtr const &,
+            _int64 checkSequenceNumber);
+
+        ktl::Awaitable<Common::ErrorCode> ExistsAsync(IKvsTransaction::SPtr const &, KString::SPtr const &, __out bool & exists);
+
+        Common::ErrorCode PrepareWrite(
+            std::wstring const & type,
+            std::wstring const & key,
+            void const * value,
+            size_t valueSize,
+            __out KString::SPtr &,
+            __out KBuffer::SPtr &);
+        void PostWriteCompletion(Common::AsyncOperationSPtr const &, Common::ComponentRootSPtr const &, Common::ErrorCode const &);
+
         TSReplicatedStoreSettingsUPtr storeSettings_;
         Reliability::ReplicationComponent::ReplicatorSettingsUPtr replicatorSettings_;
 
@@ -240,6 +329,7 @@ namespace Store
         Common::TimerSPtr initializationTimer_;
         Common::RwLock initializationTimerLock_;
         Common::ManualResetEvent initializedEvent_;
+        Common::atomic_bool isNewStore_;
 
         Common::ComPointer<::IFabricStatefulServicePartition> partition_;
         Common::RwLock partitionLock_;
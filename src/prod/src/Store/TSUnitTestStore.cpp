@@ -239,6 +239,80 @@ ErrorCode TSUnitTestStore::Delete(
         checkOperationNumber);
 }
 
+AsyncOperationSPtr TSUnitTestStore::BeginReadExact(
+    __in TransactionSPtr const & txSPtr,
+    __in std::wstring const & type,
+    __in std::wstring const & key,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    return localStore_->Test_GetReplicatedStore()->BeginReadExact(
+        txSPtr,
+        type,
+        key,
+        callback,
+        parent);
+}
+
+AsyncOperationSPtr TSUnitTestStore::BeginInsert(
+    __in TransactionSPtr const & txSPtr,
+    __in std::wstring const & type,
+    __in std::wstring const & key,
+    __in void const * value,
+    __in size_t valueSizeInBytes,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    return localStore_->Test_GetReplicatedStore()->BeginInsert(
+        txSPtr,
+        type,
+        key,
+        value,
+        valueSizeInBytes,
+        callback,
+        parent);
+}
+
+AsyncOperationSPtr TSUnitTestStore::BeginUpdate(
+    __in TransactionSPtr const & txSPtr,
+    __in std::wstring const & type,
+    __in std::wstring const & key,
+    __in _int64 checkOperationNumber,
+    __in std::wstring const & newKey,
+    __in_opt void const * newValue,
+    __in size_t valueSizeInBytes,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    return localStore_->Test_GetReplicatedStore()->BeginUpdate(
+        txSPtr,
+        type,
+        key,
+        checkOperationNumber,
+        newKey,
+        newValue,
+        valueSizeInBytes,
+        callback,
+        parent);
+}
+
+AsyncOperationSPtr TSUnitTestStore::BeginDelete(
+    __in TransactionSPtr const & txSPtr,
+    __in std::wstring const & type,
+    __in std::wstring const & key,
+    __in _int64 checkOperationNumber,
+    AsyncCallback const & callback,
+    AsyncOperationSPtr const & parent)
+{
+    return localStore_->Test_GetReplicatedStore()->BeginDelete(
+        txSPtr,
+        type,
+        key,
+        checkOperationNumber,
+        callback,
+        parent);
+}
+
 ErrorCode TSUnitTestStore::SetThrottleCallback(ThrottleCallback const & callback)
 {
     return localStore_->Test_GetReplicatedStore()->SetThrottleCallback(callback);
@@ -96,6 +96,41 @@ namespace Store
             __in std::wstring const & key,
             __in _int64 checkOperationNumber = ILocalStore::SequenceNumberIgnore) override;
 
+        virtual Common::AsyncOperationSPtr BeginReadExact(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
+        virtual Common::AsyncOperationSPtr BeginInsert(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in void const * value,
+            __in size_t valueSizeInBytes,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
+        virtual Common::AsyncOperationSPtr BeginUpdate(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 checkOperationNumber,
+            __in std::wstring const & newKey,
+            __in_opt void const * newValue,
+            __in size_t valueSizeInBytes,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
+        virtual Common::AsyncOperationSPtr BeginDelete(
+            __in TransactionSPtr const & transaction,
+            __in std::wstring const & type,
+            __in std::wstring const & key,
+            __in _int64 checkOperationNumber,
+            Common::AsyncCallback const & callback,
+            Common::AsyncOperationSPtr const & parent) override;
+
         virtual Common::ErrorCode SetThrottleCallback(ThrottleCallback const &) override;
 
         virtual Common::ErrorCode GetCurrentEpoch(__out FABRIC_EPOCH &) const override;
@@ -138,6 +173,10 @@ namespace Store
 
         virtual void Abort() override;
 
+    public:
+
+        virtual ILocalStoreSPtr Test_GetLocalStore() override { return localStore_; }
+
     private:
 
         class CloseAsyncOperation;
@@ -44,6 +44,7 @@ this assumption, we fail compilation here if that assumption is no longer valid.
 #include "Store/FileStreamCopyOperationData.h"
 #include "Store/FileStreamFullCopyContext.h"
 #include "Store/FileStreamFullCopyManager.h"
+#include "Store/FileStreamFullCopyThrottle.h"
 #include "Store/ProgressVectorData.h"
 #include "Store/CopyContextData.h"
 #include "Store/CurrentEpochData.h"
@@ -126,6 +127,7 @@ namespace Store
 #include "Store/TSEnumeration.h"
 #include "Store/TSChangeHandler.h"
 #include "Store/TSReplicatedStore.h"
+#include "Store/TSOperationLsnIndex.h"
 #include "Store/TSLocalStore.h"
 #include "Store/TSUnitTestStore.h"
 
@@ -144,6 +144,8 @@ namespace Transport
         virtual void SetEventLoopPool(Common::EventLoopPool* pool) = 0;
         virtual void SetEventLoopReadDispatch(bool asyncDispatch) = 0;
         virtual void SetEventLoopWriteDispatch(bool asyncDispatch) = 0;
+        // SO_PRIORITY of connection sockets, negative value leaves the system default
+        virtual void SetSocketPriority(int priority) = 0;
         static Common::EventLoopPool* GetDefaultTransportEventLoopPool();
 #endif
 
@@ -0,0 +1,176 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+
+namespace TransportUnitTest
+{
+    using namespace Transport;
+    using namespace Common;
+    using namespace std;
+
+    BOOST_AUTO_TEST_SUITE2(LatencyHistogramTests)
+
+    BOOST_AUTO_TEST_CASE(SmallValuesAreExact)
+    {
+        LatencyHistogram histogram;
+        for (int64 i = 0; i < 10; ++i)
+        {
+            histogram.RecordMicroseconds(i);
+        }
+
+        VERIFY_ARE_EQUAL(histogram.Count(), 10u);
+        VERIFY_ARE_EQUAL(histogram.PercentileMicroseconds(50), 4);
+        VERIFY_ARE_EQUAL(histogram.PercentileMicroseconds(100), 9);
+        VERIFY_ARE_EQUAL(histogram.MaxMicroseconds(), 9);
+    }
+
+    BOOST_AUTO_TEST_CASE(PercentilesWithinBucketPrecision)
+    {
+        LatencyHistogram histogram;
+        for (int64 i = 1; i <= 100000; ++i)
+        {
+            histogram.RecordMicroseconds(i);
+        }
+
+        int64 const expected[] = { 50000, 90000, 99000 };
+        double const percentiles[] = { 50, 90, 99 };
+        for (int i = 0; i < 3; ++i)
+        {
+            auto reported = histogram.PercentileMicroseconds(percentiles[i]);
+            Trace.WriteInfo(TraceType, "p{0} = {1}, expected {2}", percentiles[i], reported, expected[i]);
+            VERIFY_IS_TRUE(reported >= expected[i]);
+            VERIFY_IS_TRUE(reported <= expected[i] + expected[i] / 16);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(OutOfRangeValuesAreClamped)
+    {
+        LatencyHistogram histogram;
+        histogram.RecordMicroseconds(-5);
+        histogram.Record(TimeSpan::FromMinutes(600));
+
+        VERIFY_ARE_EQUAL(histogram.Count(), 2u);
+        VERIFY_ARE_EQUAL(histogram.PercentileMicroseconds(0), 0);
+        VERIFY_ARE_EQUAL(histogram.MaxMicroseconds(), (int64)LatencyHistogram::MaxTrackableMicroseconds);
+    }
+
+    BOOST_AUTO_TEST_CASE(MergeAndReset)
+    {
+        LatencyHistogram first;
+        LatencyHistogram second;
+        first.Record(TimeSpan::FromMilliseconds(1));
+        second.Record(TimeSpan::FromMilliseconds(100));
+        second.Record(TimeSpan::FromMilliseconds(100));
+
+        first.Merge(second);
+        VERIFY_ARE_EQUAL(first.Count(), 3u);
+        VERIFY_IS_TRUE(first.PercentileMicroseconds(99) >= 100000);
+
+        first.Reset();
+        VERIFY_ARE_EQUAL(first.Count(), 0u);
+        VERIFY_ARE_EQUAL(first.PercentileMicroseconds(99), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(MoveToKeepsSamplesOnce)
+    {
+        LatencyHistogram source;
+        LatencyHistogram target;
+        source.Record(TimeSpan::FromMilliseconds(1));
+        source.Record(TimeSpan::FromMilliseconds(100));
+        target.Record(TimeSpan::FromMilliseconds(10));
+
+        source.MoveTo(target);
+        VERIFY_ARE_EQUAL(source.Count(), 0u);
+        VERIFY_ARE_EQUAL(target.Count(), 3u);
+        VERIFY_IS_TRUE(target.PercentileMicroseconds(99) >= 100000);
+
+        source.MoveTo(target);
+        VERIFY_ARE_EQUAL(target.Count(), 3u);
+    }
+
+    BOOST_AUTO_TEST_CASE(ShardedSnapshotHasSamplesOfAllThreads)
+    {
+        ShardedLatencyHistogram histogram;
+        int const threadCount = 16;
+        uint64 const recordsPerThread = 10000;
+
+        atomic_long pending(threadCount);
+        ManualResetEvent allRecorded(false);
+        for (int i = 0; i < threadCount; ++i)
+        {
+            Threadpool::Post([&histogram, &pending, &allRecorded, recordsPerThread]
+            {
+                for (uint64 j = 0; j < recordsPerThread; ++j)
+                {
+                    histogram.Record(TimeSpan::FromTicks((int64)j));
+                }
+
+                if (--pending == 0)
+                {
+                    allRecorded.Set();
+                }
+            });
+        }
+
+        VERIFY_IS_TRUE(allRecorded.WaitOne(TimeSpan::FromSeconds(60)));
+
+        LatencyHistogram snapshot;
+        histogram.TakeSnapshot(snapshot);
+        VERIFY_ARE_EQUAL(snapshot.Count(), threadCount * recordsPerThread);
+
+        // snapshot moves samples out, the next one only has samples recorded after it
+        histogram.Record(TimeSpan::FromMilliseconds(1));
+        LatencyHistogram next;
+        histogram.TakeSnapshot(next);
+        VERIFY_ARE_EQUAL(next.Count(), 1u);
+    }
+
+    BOOST_AUTO_TEST_CASE(SummaryCountAverageMax)
+    {
+        SendLatencySummary summary;
+        summary.QueueingDelay.Record(TimeSpan::FromMilliseconds(1));
+        summary.QueueingDelay.Record(TimeSpan::FromMilliseconds(3));
+
+        VERIFY_ARE_EQUAL(summary.QueueingDelay.Count, 2u);
+        VERIFY_ARE_EQUAL(summary.QueueingDelay.MaxMicroseconds, 3000);
+        VERIFY_ARE_EQUAL(summary.SocketSend.Count, 0u);
+
+        auto dump = wformatString("{0}", summary);
+        Trace.WriteInfo(TraceType, "{0}", dump);
+        VERIFY_IS_TRUE(StringUtility::Contains<wstring>(dump, L"queueing: count=2 avg=2000us max=3000us"));
+    }
+
+    BOOST_AUTO_TEST_CASE(ActorHistogramsWithOtherSlot)
+    {
+        ActorLatencyHistograms histograms;
+        histograms.Record(Actor::Federation, TimeSpan::FromMilliseconds(1));
+        histograms.Record(Actor::Federation, TimeSpan::FromMilliseconds(2));
+        histograms.Record(Actor::GenericTestActor, TimeSpan::FromMilliseconds(3));
+        histograms.Record((Actor::Enum)Actor::EndValidEnum, TimeSpan::FromMilliseconds(4));
+
+        vector<unique_ptr<LatencyHistogram>> snapshots;
+        histograms.TakeSnapshot(snapshots);
+        VERIFY_ARE_EQUAL(snapshots.size(), ActorLatencyHistograms::HistogramCount);
+        VERIFY_ARE_EQUAL(snapshots[Actor::Federation]->Count(), 2u);
+        // test actors and out of range values share the last slot
+        VERIFY_ARE_EQUAL(snapshots[Actor::EndValidEnum]->Count(), 2u);
+        VERIFY_IS_TRUE(!snapshots[Actor::Ipc]);
+
+        wstring name;
+        StringWriter w(name);
+        ActorLatencyHistograms::WriteActorName(w, Actor::EndValidEnum);
+        VERIFY_ARE_EQUAL(name, L"Other");
+
+        histograms.Record(Actor::Federation, TimeSpan::FromMilliseconds(5));
+        histograms.TakeSnapshot(snapshots);
+        VERIFY_ARE_EQUAL(snapshots[Actor::Federation]->Count(), 3u);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
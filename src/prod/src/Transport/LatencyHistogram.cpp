@@ -0,0 +1,265 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+using namespace Transport;
+using namespace Common;
+using namespace std;
+
+LatencyHistogram::LatencyHistogram()
+{
+}
+
+size_t LatencyHistogram::BucketIndex(uint64 value)
+{
+    if (value < LinearBucketCount)
+    {
+        return (size_t)value;
+    }
+
+    uint highestBit = 0;
+    for (uint64 v = value >> 1; v != 0; v >>= 1)
+    {
+        ++highestBit;
+    }
+
+    // keep SubBucketBits bits below the highest bit, bucket width doubles with each power of two
+    uint shift = highestBit - SubBucketBits;
+    auto subBucket = (size_t)(value >> shift) - SubBucketCount;
+    return LinearBucketCount + (shift - 1) * SubBucketCount + subBucket;
+}
+
+int64 LatencyHistogram::BucketHighestValue(size_t index)
+{
+    if (index < LinearBucketCount)
+    {
+        return (int64)index;
+    }
+
+    auto offset = index - LinearBucketCount;
+    uint shift = (uint)(offset / SubBucketCount) + 1;
+    auto subBucket = (int64)(offset % SubBucketCount) + SubBucketCount;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(TimeSpan latency)
+{
+    RecordMicroseconds(latency.Ticks / 10); // tick is 100 nanoseconds
+}
+
+void LatencyHistogram::RecordMicroseconds(int64 value)
+{
+    if (value < 0)
+    {
+        value = 0;
+    }
+    else if (value > MaxTrackableMicroseconds)
+    {
+        value = MaxTrackableMicroseconds;
+    }
+
+    ++buckets_[BucketIndex((uint64)value)];
+}
+
+void LatencyHistogram::Merge(LatencyHistogram const & other)
+{
+    for (size_t i = 0; i < BucketCount; ++i)
+    {
+        auto count = other.buckets_[i].load();
+        if (count == 0) continue;
+
+        buckets_[i] += count;
+    }
+}
+
+void LatencyHistogram::MoveTo(LatencyHistogram & target)
+{
+    for (size_t i = 0; i < BucketCount; ++i)
+    {
+        if (buckets_[i].load() == 0) continue;
+
+        target.buckets_[i] += buckets_[i].exchange(0);
+    }
+}
+
+void LatencyHistogram::Reset()
+{
+    // samples recorded concurrently with Reset may be partially lost, which is acceptable for statistics
+    for (size_t i = 0; i < BucketCount; ++i)
+    {
+        buckets_[i].store(0);
+    }
+}
+
+uint64 LatencyHistogram::Count() const
+{
+    uint64 count = 0;
+    for (size_t i = 0; i < BucketCount; ++i)
+    {
+        count += buckets_[i].load();
+    }
+
+    return count;
+}
+
+int64 LatencyHistogram::MaxMicroseconds() const
+{
+    for (size_t i = BucketCount; i > 0; --i)
+    {
+        if (buckets_[i - 1].load() > 0)
+        {
+            return BucketHighestValue(i - 1);
+        }
+    }
+
+    return 0;
+}
+
+int64 LatencyHistogram::PercentileMicroseconds(double percentile) const
+{
+    auto total = Count();
+    if (total == 0) return 0;
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    auto target = std::max((uint64)1, (uint64)ceil(total * percentile / 100.0));
+
+    uint64 accumulated = 0;
+    for (size_t i = 0; i < BucketCount; ++i)
+    {
+        accumulated += buckets_[i].load();
+        if (accumulated >= target)
+        {
+            return BucketHighestValue(i);
+        }
+    }
+
+    return MaxMicroseconds();
+}
+
+void LatencyHistogram::WriteTo(TextWriter & w, FormatOptions const &) const
+{
+    w.Write(
+        "count={0} p50={1}us p90={2}us p99={3}us p99.9={4}us max={5}us",
+        Count(),
+        PercentileMicroseconds(50),
+        PercentileMicroseconds(90),
+        PercentileMicroseconds(99),
+        PercentileMicroseconds(99.9),
+        MaxMicroseconds());
+}
+
+ShardedLatencyHistogram::ShardedLatencyHistogram()
+{
+}
+
+size_t ShardedLatencyHistogram::CurrentThreadShard()
+{
+    static atomic_uint64 nextShard(0);
+    static thread_local size_t shard = (size_t)(nextShard++ % ShardCount);
+    return shard;
+}
+
+void ShardedLatencyHistogram::Record(TimeSpan latency)
+{
+    shards_[CurrentThreadShard()].Record(latency);
+}
+
+void ShardedLatencyHistogram::TakeSnapshot(LatencyHistogram & snapshot)
+{
+    for (auto & shard : shards_)
+    {
+        shard.MoveTo(snapshot);
+    }
+}
+
+void LatencySummary::Record(TimeSpan latency)
+{
+    auto value = latency.Ticks / 10;
+
+    ++Count;
+    TotalMicroseconds += value;
+    MaxMicroseconds = std::max(MaxMicroseconds, value);
+}
+
+void LatencySummary::WriteTo(TextWriter & w, FormatOptions const &) const
+{
+    w.Write(
+        "count={0} avg={1}us max={2}us",
+        Count,
+        (Count > 0) ? (TotalMicroseconds / (int64)Count) : 0,
+        MaxMicroseconds);
+}
+
+ActorLatencyHistograms::ActorLatencyHistograms()
+{
+    for (auto & histogram : histograms_)
+    {
+        histogram = nullptr;
+    }
+}
+
+ActorLatencyHistograms::~ActorLatencyHistograms()
+{
+    for (auto histogram : histograms_)
+    {
+        delete histogram;
+    }
+}
+
+size_t ActorLatencyHistograms::ActorIndex(Actor::Enum actor)
+{
+    return ((actor >= Actor::FirstValidEnum) && (actor <= Actor::LastValidEnum)) ? (size_t)actor : Actor::EndValidEnum;
+}
+
+void ActorLatencyHistograms::WriteActorName(TextWriter & w, size_t index)
+{
+    if (index < Actor::EndValidEnum)
+    {
+        w.Write("{0}", (Actor::Enum)index);
+    }
+    else
+    {
+        w.Write("Other");
+    }
+}
+
+void ActorLatencyHistograms::Record(Actor::Enum actor, TimeSpan latency)
+{
+    auto index = ActorIndex(actor);
+    auto histogram = histograms_[index];
+    if (histogram == nullptr)
+    {
+        auto created = new LatencyHistogram();
+        histogram = (LatencyHistogram*)InterlockedCompareExchangePointer((PVOID volatile *)&histograms_[index], created, nullptr);
+        if (histogram == nullptr)
+        {
+            histogram = created;
+        }
+        else
+        {
+            delete created; // another thread created it first
+        }
+    }
+
+    histogram->Record(latency);
+}
+
+void ActorLatencyHistograms::TakeSnapshot(vector<unique_ptr<LatencyHistogram>> & snapshots)
+{
+    snapshots.resize(HistogramCount);
+    for (size_t i = 0; i < HistogramCount; ++i)
+    {
+        auto histogram = histograms_[i];
+        if (histogram == nullptr) continue;
+
+        if (!snapshots[i])
+        {
+            snapshots[i] = make_unique<LatencyHistogram>();
+        }
+
+        histogram->MoveTo(*snapshots[i]);
+    }
+}
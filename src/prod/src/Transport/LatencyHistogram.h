@@ -0,0 +1,148 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Transport
+{
+    //
+    // Lock free latency histogram in the style of HDR histogram. Values are recorded in microseconds
+    // into log-linear buckets, 16 linear sub-buckets per power of two, so percentiles are reported
+    // within ~6% of recorded values while recording stays a single interlocked increment.
+    // Values above MaxTrackableMicroseconds are recorded as MaxTrackableMicroseconds.
+    //
+    class LatencyHistogram
+    {
+        DENY_COPY(LatencyHistogram);
+
+    public:
+        static const int64 MaxTrackableMicroseconds = 0xffffffff; // ~71 minutes
+
+        LatencyHistogram();
+
+        void Record(Common::TimeSpan latency);
+        void RecordMicroseconds(int64 value);
+
+        void Merge(LatencyHistogram const & other);
+        void Reset();
+
+        // atomically moves samples to target, samples recorded concurrently are either moved or kept
+        void MoveTo(LatencyHistogram & target);
+
+        uint64 Count() const;
+        int64 MaxMicroseconds() const;
+
+        // percentile in [0, 100], returns highest value equivalent to the bucket the percentile falls in
+        int64 PercentileMicroseconds(double percentile) const;
+
+        void WriteTo(Common::TextWriter & w, Common::FormatOptions const &) const;
+
+    private:
+        static const uint SubBucketBits = 4;
+        static const size_t SubBucketCount = 1 << SubBucketBits;
+        static const size_t LinearBucketCount = SubBucketCount * 2;
+        static const size_t BucketCount = LinearBucketCount + (32 - SubBucketBits - 1) * SubBucketCount;
+
+        static size_t BucketIndex(uint64 value);
+        static int64 BucketHighestValue(size_t index);
+
+        Common::atomic_uint64 buckets_[BucketCount];
+    };
+
+    //
+    // Latency histogram for values recorded from many threads. Each thread records into one of
+    // ShardCount histograms, so concurrent recorders rarely touch the same buckets. Samples are
+    // read by moving them into a snapshot, typically from a report timer.
+    //
+    class ShardedLatencyHistogram
+    {
+        DENY_COPY(ShardedLatencyHistogram);
+
+    public:
+        ShardedLatencyHistogram();
+
+        void Record(Common::TimeSpan latency);
+
+        // moves all samples recorded so far into snapshot
+        void TakeSnapshot(LatencyHistogram & snapshot);
+
+    private:
+        static const size_t ShardCount = 8;
+
+        static size_t CurrentThreadShard();
+
+        LatencyHistogram shards_[ShardCount];
+    };
+
+    //
+    // Count, average and maximum of latency samples, for objects that are too numerous to carry a
+    // histogram each. Not thread safe, callers serialize recording, e.g. under a connection lock.
+    //
+    struct LatencySummary
+    {
+        uint64 Count = 0;
+        int64 TotalMicroseconds = 0;
+        int64 MaxMicroseconds = 0;
+
+        void Record(Common::TimeSpan latency);
+
+        void WriteTo(Common::TextWriter & w, Common::FormatOptions const &) const;
+    };
+
+    //
+    // Send path latency of a connection
+    //
+    struct SendLatencySummary
+    {
+        // time from enqueuing a message to handing it to socket
+        LatencySummary QueueingDelay;
+        // time from handing a send batch to socket to its completion, i.e. time spent on the wire
+        // when the socket send buffer is full
+        LatencySummary SocketSend;
+
+        void WriteTo(Common::TextWriter & w, Common::FormatOptions const &) const
+        {
+            w.Write("queueing: {0}, socket send: {1}", QueueingDelay, SocketSend);
+        }
+    };
+
+    //
+    // Send path latency of all connections of a transport
+    //
+    struct SendLatencyHistograms
+    {
+        ShardedLatencyHistogram QueueingDelay;
+        ShardedLatencyHistogram SocketSend;
+    };
+
+    typedef std::shared_ptr<SendLatencyHistograms> SendLatencyHistogramsSPtr;
+
+    //
+    // Latency histograms per actor, created on first record of an actor. Actors outside of the valid
+    // range, e.g. test actors, share one histogram.
+    //
+    class ActorLatencyHistograms
+    {
+        DENY_COPY(ActorLatencyHistograms);
+
+    public:
+        ActorLatencyHistograms();
+        ~ActorLatencyHistograms();
+
+        void Record(Actor::Enum actor, Common::TimeSpan latency);
+
+        // moves all samples recorded so far into snapshots, which are resized to HistogramCount
+        void TakeSnapshot(std::vector<std::unique_ptr<LatencyHistogram>> & snapshots);
+
+        static const size_t HistogramCount = Actor::EndValidEnum + 1;
+
+        static void WriteActorName(Common::TextWriter & w, size_t index);
+
+    private:
+        static size_t ActorIndex(Actor::Enum actor);
+
+        LatencyHistogram * volatile histograms_[HistogramCount];
+    };
+}
@@ -92,6 +92,7 @@ namespace Transport
         void SetEventLoopPool(Common::EventLoopPool* pool) override; 
         void SetEventLoopReadDispatch(bool) override {} 
         void SetEventLoopWriteDispatch(bool) override {}
+        void SetSocketPriority(int) override {}
 #endif
 
     private:
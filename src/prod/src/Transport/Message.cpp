@@ -191,6 +191,17 @@ MessageUPtr Message::Clone(MessageHeaders && extraHeaders)
     return clone;
 }
 
+MessageUPtr Message::Clone(vector<const_buffer> const & body, DeleteCallback const & deleteCallback, void * state)
+{
+    auto clone = unique_ptr<Message>(new Message(body, deleteCallback, state));
+    clone->headers_.CopyFrom(headers_);
+    clone->headers_.Idempotent = headers_.Idempotent;
+    clone->properties_.insert(properties_.begin(), properties_.end());
+    clone->securityContext_ = securityContext_;
+
+    return clone;
+}
+
 MessageUPtr Message::CloneSharedParts()
 {
     // share body and sharedHeaders_
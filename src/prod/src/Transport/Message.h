@@ -110,6 +110,11 @@ namespace Transport
         // This behaves the same as parameter-less Clone(), other than adding extraHeaders as "new headers" to the clone.
         MessageUPtr Clone(MessageHeaders && extraHeaders);
 
+        // This behaves the same as parameter-less Clone(), other than replacing the message body with the given buffers
+        // and copying all headers into "new headers", so that headers can be removed from the clone without affecting
+        // the original. deleteCallback must be specified.
+        MessageUPtr Clone(std::vector<Common::const_buffer> const & body, DeleteCallback const & deleteCallback, void * state);
+
         uint SerializedSize();
 
         //
@@ -47,6 +47,7 @@ namespace Transport
             case BroadcastRange: w << "BroadcastRange"; return;
             case BroadcastRelatesTo: w << "BroadcastRelatesTo"; return;
             case BroadcastStep: w << "BroadcastStep"; return;
+            case BroadcastCompression: w << "BroadcastCompression"; return;
 
             // Reliability Headers
             case Generation: w << "Generation"; return;
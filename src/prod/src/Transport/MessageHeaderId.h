@@ -144,6 +144,9 @@ namespace Transport
             FabricTransportMessageHeader = 0x804c,
             UpgradeComposeDeploymentRequest = 0x804d,
 
+            // Broadcast
+            BroadcastCompression = 0x804e,
+
             // Add new internal message header ids must be explicitly defined
             // ----------------------------------------------------------------
             // Header IDs for tests follow this line.
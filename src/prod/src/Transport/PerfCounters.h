@@ -35,11 +35,41 @@ namespace Transport
                 Common::PerformanceCounterType::AverageCount64,
                 L"Avg. TCP send size (bytes)",
                 L"Counter for measuring the average TCP send size in bytes")
+            COUNTER_DEFINITION(
+                4,
+                Common::PerformanceCounterType::RawData64,
+                L"Send queueing delay P50 (us)",
+                L"50th percentile of time messages spent in send queue before being sent, over the last report interval")
+            COUNTER_DEFINITION(
+                5,
+                Common::PerformanceCounterType::RawData64,
+                L"Send queueing delay P99 (us)",
+                L"99th percentile of time messages spent in send queue before being sent, over the last report interval")
+            COUNTER_DEFINITION(
+                6,
+                Common::PerformanceCounterType::RawData64,
+                L"Socket send time P99 (us)",
+                L"99th percentile of time from starting a socket send to its completion, over the last report interval")
+            COUNTER_DEFINITION(
+                7,
+                Common::PerformanceCounterType::RawData64,
+                L"Request reply latency P50 (us)",
+                L"50th percentile of time from sending a request to receiving its reply, over the last report interval")
+            COUNTER_DEFINITION(
+                8,
+                Common::PerformanceCounterType::RawData64,
+                L"Request reply latency P99 (us)",
+                L"99th percentile of time from sending a request to receiving its reply, over the last report interval")
         END_COUNTER_SET_DEFINITION()
 
         DECLARE_COUNTER_INSTANCE(NumberOfActiveCallbacks)
         DECLARE_COUNTER_INSTANCE(AverageTcpSendSizeBase)
         DECLARE_COUNTER_INSTANCE(AverageTcpSendSize)
+        DECLARE_COUNTER_INSTANCE(SendQueueingDelayP50)
+        DECLARE_COUNTER_INSTANCE(SendQueueingDelayP99)
+        DECLARE_COUNTER_INSTANCE(SocketSendTimeP99)
+        DECLARE_COUNTER_INSTANCE(RequestReplyLatencyP50)
+        DECLARE_COUNTER_INSTANCE(RequestReplyLatencyP99)
 
         BEGIN_COUNTER_SET_INSTANCE(PerfCounters)
             DEFINE_COUNTER_INSTANCE(
@@ -51,6 +81,21 @@ namespace Transport
                 DEFINE_COUNTER_INSTANCE(
                 AverageTcpSendSize,
                 3)
+                DEFINE_COUNTER_INSTANCE(
+                SendQueueingDelayP50,
+                4)
+                DEFINE_COUNTER_INSTANCE(
+                SendQueueingDelayP99,
+                5)
+                DEFINE_COUNTER_INSTANCE(
+                SocketSendTimeP99,
+                6)
+                DEFINE_COUNTER_INSTANCE(
+                RequestReplyLatencyP50,
+                7)
+                DEFINE_COUNTER_INSTANCE(
+                RequestReplyLatencyP99,
+                8)
         END_COUNTER_SET_INSTANCE()
     };
 }
@@ -17,6 +17,9 @@ ReceiveBuffer::ReceiveBuffer(TcpConnection* connectionPtr)
 , msgBuffers_(&receiveQueue_)
 , decrypted_(connectionPtr->receiveChunkSize_)
 {
+    auto pool = ReceiveBufferPool::Get(connectionPtr->receiveChunkSize_);
+    receiveQueue_.set_buffer_allocator(pool);
+    decrypted_.set_buffer_allocator(pool);
 }
 
 void ReceiveBuffer::DisableSecurityProviderCheck()
@@ -0,0 +1,177 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+#include <boost/test/unit_test.hpp>
+#include "Common/boost-taef.h"
+#include "TestCommon.h"
+
+namespace TransportUnitTest
+{
+    using namespace Transport;
+    using namespace Common;
+    using namespace std;
+
+    class ReceiveBufferPoolTests
+    {
+    protected:
+        // pooling is disabled by default
+        ReceiveBufferPoolTests() : savedPoolSizeInMB_(TransportConfig::GetConfig().ReceiveBufferPoolSizeInMB)
+        {
+            TransportConfig::GetConfig().ReceiveBufferPoolSizeInMB = 64;
+        }
+
+        ~ReceiveBufferPoolTests()
+        {
+            TransportConfig::GetConfig().ReceiveBufferPoolSizeInMB = savedPoolSizeInMB_;
+        }
+
+    private:
+        uint savedPoolSizeInMB_;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE2(ReceiveBufferPoolSuite, ReceiveBufferPoolTests)
+
+    BOOST_AUTO_TEST_CASE(DisabledWhenPoolSizeIsZero)
+    {
+        TransportConfig::GetConfig().ReceiveBufferPoolSizeInMB = 0;
+        VERIFY_IS_TRUE(ReceiveBufferPool::Get(1024) == nullptr);
+    }
+
+    BOOST_AUTO_TEST_CASE(ChunksAreReusedAfterMessageRelease)
+    {
+        size_t const chunkSize = 1024;
+        auto pool = ReceiveBufferPool::Get(chunkSize);
+        VERIFY_IS_TRUE(pool != nullptr);
+        VERIFY_IS_TRUE(pool == ReceiveBufferPool::Get(chunkSize));
+
+        auto pooledBefore = pool->PooledCount();
+
+        ByteBiqueRange bodyRange(EmptyByteBique.begin(), EmptyByteBique.end(), false);
+        {
+            ByteBique receiveQueue(chunkSize);
+            receiveQueue.set_buffer_allocator(pool);
+
+            vector<byte> data(chunkSize * 3, 0x5a);
+            receiveQueue.append(data.data(), data.size());
+
+            // range holds a reference on chunks after receive queue is gone, like a received message body
+            ByteBiqueRange range(receiveQueue.begin(), receiveQueue.end(), true);
+            bodyRange = range;
+        }
+
+        size_t bodyBytes = 0;
+        for (auto iter = bodyRange.Begin; iter != bodyRange.End; ++iter)
+        {
+            VERIFY_ARE_EQUAL((byte)0x5a, *iter);
+            ++bodyBytes;
+        }
+
+        VERIFY_ARE_EQUAL(chunkSize * 3, bodyBytes);
+
+        bodyRange = ByteBiqueRange(EmptyByteBique.begin(), EmptyByteBique.end(), false);
+        auto pooledAfterRelease = pool->PooledCount();
+        Trace.WriteInfo(TraceType, "pooled chunk count: before = {0}, after release = {1}", pooledBefore, pooledAfterRelease);
+        VERIFY_IS_TRUE(pooledAfterRelease >= pooledBefore + 3);
+
+        {
+            ByteBique receiveQueue(chunkSize);
+            receiveQueue.set_buffer_allocator(pool);
+            receiveQueue.reserve_back(chunkSize * 2);
+
+            VERIFY_IS_TRUE(pool->PooledCount() < pooledAfterRelease);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(MismatchedSizeFallsBackToHeap)
+    {
+        auto pool = ReceiveBufferPool::Get(2048);
+        VERIFY_IS_TRUE(pool != nullptr);
+        VERIFY_IS_TRUE(pool->Allocate(pool->BlockSize() + 1) == nullptr);
+
+        auto block = pool->Allocate(pool->BlockSize());
+        VERIFY_IS_TRUE(block != nullptr);
+        pool->Free(block);
+    }
+
+    BOOST_AUTO_TEST_CASE(BlocksFreedOnOtherThreadsAreShared)
+    {
+        // chunk size not used by other tests, so that the pool starts empty
+        auto pool = ReceiveBufferPool::Get(4096 + 64);
+        VERIFY_IS_TRUE(pool != nullptr);
+        auto pooledBefore = pool->PooledCount();
+
+        size_t const threadCacheSize = pool->ThreadCacheSize();
+
+        size_t const blockCount = threadCacheSize * 2;
+        AutoResetEvent freed;
+        Threadpool::Post([pool, blockCount, &freed]
+        {
+            vector<void*> blocks;
+            for (size_t i = 0; i < blockCount; ++i)
+            {
+                blocks.push_back(pool->Allocate(pool->BlockSize()));
+            }
+
+            // thread cache keeps ThreadCacheSize blocks, the rest is released to the shared free list
+            for (auto block : blocks)
+            {
+                pool->Free(block);
+            }
+
+            freed.Set();
+        });
+
+        VERIFY_IS_TRUE(freed.WaitOne(TimeSpan::FromSeconds(30)));
+
+        auto pooledAfter = pool->PooledCount();
+        Trace.WriteInfo(TraceType, "pooled chunk count seen by test thread: before = {0}, after = {1}", pooledBefore, pooledAfter);
+        VERIFY_ARE_EQUAL(pooledBefore + blockCount - threadCacheSize, pooledAfter);
+
+        // test thread cache is refilled from the shared free list
+        auto block = pool->Allocate(pool->BlockSize());
+        VERIFY_IS_TRUE(block != nullptr);
+        VERIFY_ARE_EQUAL(pooledAfter - 1, pool->PooledCount());
+        pool->Free(block);
+    }
+
+    BOOST_AUTO_TEST_CASE(ThreadCacheIsBoundedInBytes)
+    {
+        auto largePool = ReceiveBufferPool::Get(ReceiveBufferPool::MaxThreadCacheBytes / 4);
+        VERIFY_IS_TRUE(largePool != nullptr);
+        VERIFY_IS_TRUE(largePool->ThreadCacheSize() * largePool->BlockSize() <= ReceiveBufferPool::MaxThreadCacheBytes);
+        VERIFY_IS_TRUE(largePool->ThreadCacheSize() >= ReceiveBufferPool::MinThreadCacheSize);
+
+        auto hugePool = ReceiveBufferPool::Get(ReceiveBufferPool::MaxThreadCacheBytes * 2);
+        VERIFY_IS_TRUE(hugePool != nullptr);
+        VERIFY_ARE_EQUAL((size_t)ReceiveBufferPool::MinThreadCacheSize, hugePool->ThreadCacheSize());
+
+        // a thread keeps at most MinThreadCacheSize blocks of the huge pool, the rest is released to the shared free list
+        auto pooledBefore = hugePool->PooledCount();
+        size_t const blockCount = ReceiveBufferPool::MinThreadCacheSize * 4;
+        AutoResetEvent freed;
+        Threadpool::Post([hugePool, blockCount, &freed]
+        {
+            vector<void*> blocks;
+            for (size_t i = 0; i < blockCount; ++i)
+            {
+                blocks.push_back(hugePool->Allocate(hugePool->BlockSize()));
+            }
+
+            for (auto block : blocks)
+            {
+                hugePool->Free(block);
+            }
+
+            freed.Set();
+        });
+
+        VERIFY_IS_TRUE(freed.WaitOne(TimeSpan::FromSeconds(30)));
+        VERIFY_ARE_EQUAL(pooledBefore + blockCount - ReceiveBufferPool::MinThreadCacheSize, hugePool->PooledCount());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,182 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#include "stdafx.h"
+
+using namespace Transport;
+using namespace Common;
+using namespace std;
+
+static StringLiteral const TraceType("RecvBufPool");
+
+INIT_ONCE ReceiveBufferPool::initOnce_ = INIT_ONCE_STATIC_INIT;
+RwLock* ReceiveBufferPool::poolsLock_ = nullptr;
+map<size_t, ReceiveBufferPool*>* ReceiveBufferPool::pools_ = nullptr;
+
+BOOL CALLBACK ReceiveBufferPool::InitFunction(PINIT_ONCE, PVOID, PVOID*)
+{
+    poolsLock_ = new RwLock();
+    pools_ = new map<size_t, ReceiveBufferPool*>();
+    return TRUE;
+}
+
+ReceiveBufferPool* ReceiveBufferPool::Get(size_t chunkSize)
+{
+    size_t poolSizeInBytes = (size_t)TransportConfig::GetConfig().ReceiveBufferPoolSizeInMB * 1024 * 1024;
+    if (poolSizeInBytes == 0) return nullptr;
+
+    BOOL bStatus = ::InitOnceExecuteOnce(&initOnce_, InitFunction, NULL, NULL);
+    ASSERT_IF(!bStatus, "Failed to initialize ReceiveBufferPool");
+
+    // bique buffer allocation size includes the buffer entry header in front of chunk data
+    size_t blockSize = sizeof(Common::detail::BufferListEntry<byte>) + chunkSize;
+
+    {
+        AcquireReadLock grab(*poolsLock_);
+        auto iter = pools_->find(blockSize);
+        if (iter != pools_->cend()) return iter->second;
+    }
+
+    AcquireWriteLock grab(*poolsLock_);
+
+    auto iter = pools_->find(blockSize);
+    if (iter != pools_->cend()) return iter->second;
+
+    size_t maxPooledCount = poolSizeInBytes / blockSize;
+    auto pool = new ReceiveBufferPool(blockSize, maxPooledCount);
+    pools_->emplace(blockSize, pool);
+
+    WriteInfo(
+        TraceType,
+        "created pool {0}: blockSize = {1}, maxPooledCount = {2}, threadCacheSize = {3}",
+        TextTracePtr(pool), blockSize, maxPooledCount, pool->threadCacheSize_);
+    return pool;
+}
+
+ReceiveBufferPool::ReceiveBufferPool(size_t blockSize, size_t maxPooledCount)
+    : blockSize_(blockSize)
+    , maxPooledCount_(maxPooledCount)
+    , threadCacheSize_(max((size_t)MinThreadCacheSize, min((size_t)MaxThreadCacheSize, MaxThreadCacheBytes / blockSize)))
+    , transferBatchSize_(threadCacheSize_ / 2)
+{
+    freeBlocks_.reserve(maxPooledCount_);
+}
+
+// Free blocks cached by the current thread, returned to their pools when the thread exits
+class ReceiveBufferPool::ThreadCache
+{
+    DENY_COPY(ThreadCache);
+
+public:
+    ThreadCache() = default;
+
+    ~ThreadCache()
+    {
+        for (auto & entry : caches_)
+        {
+            entry.first->Release(entry.second, entry.second.size());
+        }
+    }
+
+    vector<void*> & GetCache(ReceiveBufferPool const* pool)
+    {
+        // there is one pool per receive chunk size, so a linear search is enough
+        for (auto & entry : caches_)
+        {
+            if (entry.first == pool) return entry.second;
+        }
+
+        caches_.emplace_back(const_cast<ReceiveBufferPool*>(pool), vector<void*>());
+        caches_.back().second.reserve(pool->ThreadCacheSize());
+        return caches_.back().second;
+    }
+
+private:
+    vector<pair<ReceiveBufferPool*, vector<void*>>> caches_;
+};
+
+vector<void*> & ReceiveBufferPool::GetThreadCache() const
+{
+    static thread_local ThreadCache threadCache;
+    return threadCache.GetCache(this);
+}
+
+size_t ReceiveBufferPool::PooledCount() const
+{
+    auto threadCacheCount = GetThreadCache().size();
+
+    AcquireReadLock grab(lock_);
+    return freeBlocks_.size() + threadCacheCount;
+}
+
+void ReceiveBufferPool::Refill(vector<void*> & cache)
+{
+    AcquireWriteLock grab(lock_);
+
+    while (!freeBlocks_.empty() && (cache.size() < transferBatchSize_))
+    {
+        cache.push_back(freeBlocks_.back());
+        freeBlocks_.pop_back();
+    }
+}
+
+void ReceiveBufferPool::Release(vector<void*> & cache, size_t count)
+{
+    vector<void*> toFree;
+    {
+        AcquireWriteLock grab(lock_);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (freeBlocks_.size() < maxPooledCount_)
+            {
+                freeBlocks_.push_back(cache.back());
+            }
+            else
+            {
+                toFree.push_back(cache.back());
+            }
+
+            cache.pop_back();
+        }
+    }
+
+    for (auto block : toFree)
+    {
+        HeapFree(GetProcessHeap(), 0, block);
+    }
+}
+
+void * ReceiveBufferPool::Allocate(size_t size)
+{
+    // only full chunks are served, other sizes fall back to heap
+    if (size != blockSize_) return nullptr;
+
+    auto & cache = GetThreadCache();
+    if (cache.empty())
+    {
+        Refill(cache);
+    }
+
+    if (!cache.empty())
+    {
+        auto block = cache.back();
+        cache.pop_back();
+        return block;
+    }
+
+    return HeapAlloc(GetProcessHeap(), HEAP_GENERATE_EXCEPTIONS, blockSize_);
+}
+
+void ReceiveBufferPool::Free(void * mem)
+{
+    auto & cache = GetThreadCache();
+    if (cache.size() >= threadCacheSize_)
+    {
+        Release(cache, transferBatchSize_);
+    }
+
+    cache.push_back(mem);
+}
@@ -0,0 +1,68 @@
+// ------------------------------------------------------------
+// Copyright (c) Microsoft Corporation.  All rights reserved.
+// Licensed under the MIT License (MIT). See License.txt in the repo root for license information.
+// ------------------------------------------------------------
+
+#pragma once
+
+namespace Transport
+{
+    //
+    // Process wide pool of fixed size blocks backing receive buffer chunks. Received messages
+    // reference receive chunks until they are destructed, so a chunk is often released on a
+    // different thread long after the connection moved on to new chunks. Pooling the chunks
+    // avoids a heap allocation and free per chunk on the receive path. Pools are never freed,
+    // as pooled chunks can outlive connections and transports.
+    //
+    // Each thread keeps a small cache of free blocks per pool, so that Allocate and Free do not
+    // take a lock in the common case. Blocks move between a thread cache and the shared free list
+    // of the pool in batches. The shared free list is bounded by ReceiveBufferPoolSizeInMB, thread
+    // caches add at most ThreadCacheSize() blocks per thread, which keeps them within MaxThreadCacheBytes
+    // unless blocks are so large that MinThreadCacheSize blocks exceed it.
+    //
+    class ReceiveBufferPool : public Common::IBufferAllocator, Common::TextTraceComponent<Common::TraceTaskCodes::Transport>
+    {
+        DENY_COPY(ReceiveBufferPool);
+
+    public:
+        // returns nullptr when receive buffer pooling is disabled
+        static ReceiveBufferPool* Get(size_t chunkSize);
+
+        void * Allocate(size_t size) override;
+        void Free(void * mem) override;
+
+        size_t BlockSize() const { return blockSize_; }
+
+        // upper limit of free blocks cached per thread
+        size_t ThreadCacheSize() const { return threadCacheSize_; }
+
+        // free blocks in the shared free list and in the cache of the calling thread
+        size_t PooledCount() const;
+
+        static size_t const MaxThreadCacheBytes = 128 * 1024;
+        static size_t const MaxThreadCacheSize = 32;
+        static size_t const MinThreadCacheSize = 2;
+
+    private:
+        class ThreadCache;
+
+        ReceiveBufferPool(size_t blockSize, size_t maxPooledCount);
+
+        std::vector<void*> & GetThreadCache() const;
+        void Refill(std::vector<void*> & cache);
+        void Release(std::vector<void*> & cache, size_t count);
+
+        static BOOL CALLBACK InitFunction(PINIT_ONCE, PVOID, PVOID*);
+
+        static INIT_ONCE initOnce_;
+        static Common::RwLock* poolsLock_;
+        static std::map<size_t, ReceiveBufferPool*>* pools_;
+
+        size_t const blockSize_;
+        size_t const maxPooledCount_;
+        size_t const threadCacheSize_;
+        size_t const transferBatchSize_;
+        mutable Common::RwLock lock_;
+        std::vector<void*> freeBlocks_;
+    };
+}
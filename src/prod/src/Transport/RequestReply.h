@@ -87,6 +87,7 @@ namespace Transport
         IDatagramTransport::DisconnectHHandler disconnectHHandler_ = IDatagramTransport::DisconnectEvent::InvalidHHandler;
         bool dispatchOnTransportThread_;
         bool enableDifferentTimeoutError_;
+
         class RequestReplyAsyncOperation;
     };
 
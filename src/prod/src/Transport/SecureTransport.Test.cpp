@@ -1027,6 +1027,26 @@ namespace Transport
         LEAVE;
     }
 
+    BOOST_AUTO_TEST_CASE(KernelTlsSendEnabledByConfig_ManyMessages)
+    {
+        ENTER;
+
+        // Both sides hand their sessions to kernel TLS before the first send after negotiation, so every
+        // request and reply record is built by the kernel and decrypted by OpenSSL on the other side.
+        // Kernels or OpenSSL builds without kernel TLS support fall back to OpenSSL encryption.
+        TransportConfig & transportConfig = TransportConfig::GetConfig();
+        auto saved = transportConfig.KernelTlsSendEnabled;
+        transportConfig.KernelTlsSendEnabled = true;
+        KFinally([&]
+        {
+            transportConfig.KernelTlsSendEnabled = saved;
+        });
+
+        X509ManyMessage_SelfSigned(L"127.0.0.1:0", L"127.0.0.1:0");
+
+        LEAVE;
+    }
+
 #else
 
     BOOST_AUTO_TEST_CASE(ClaimsAuthTestsWithClientRoles)
@@ -396,6 +396,191 @@ ByteBuffer2 SecurityContextSsl::EncryptFinal()
     return BioMemToByteBuffer2(outBio_);
 }
 
+#if defined(KERNEL_TLS_SUPPORTED) && (OPENSSL_VERSION_NUMBER < 0x10100000L)
+
+namespace
+{
+    // TLS 1.2 PRF, RFC 5246 section 5
+    bool TlsPrf(EVP_MD const* md, byte const* secret, size_t secretLength, vector<byte> const & seed, byte* output, size_t outputLength)
+    {
+        byte a[EVP_MAX_MD_SIZE];
+        uint aLength = 0;
+        if (!HMAC(md, secret, secretLength, seed.data(), seed.size(), a, &aLength)) return false;
+
+        vector<byte> input;
+        byte chunk[EVP_MAX_MD_SIZE];
+        uint chunkLength = 0;
+        bool succeeded = true;
+        while (outputLength > 0)
+        {
+            input.assign(a, a + aLength);
+            input.insert(input.end(), seed.cbegin(), seed.cend());
+            if (!HMAC(md, secret, secretLength, input.data(), input.size(), chunk, &chunkLength))
+            {
+                succeeded = false;
+                break;
+            }
+
+            auto toCopy = std::min((size_t)chunkLength, outputLength);
+            memcpy(output, chunk, toCopy);
+            output += toCopy;
+            outputLength -= toCopy;
+
+            if (!HMAC(md, secret, secretLength, input.data(), aLength, a, &aLength))
+            {
+                succeeded = false;
+                break;
+            }
+        }
+
+        OPENSSL_cleanse(a, sizeof(a));
+        OPENSSL_cleanse(chunk, sizeof(chunk));
+        OPENSSL_cleanse(input.data(), input.size());
+        return succeeded;
+    }
+
+    template <typename TCryptoInfo>
+    int SetKernelTlsSend(int socketFd, ushort cipherType, byte const* key, byte const* salt, byte const* explicitNonce, byte const* recordSequence)
+    {
+        TCryptoInfo cryptoInfo = {};
+        cryptoInfo.info.version = TLS_1_2_VERSION;
+        cryptoInfo.info.cipher_type = cipherType;
+        memcpy(cryptoInfo.key, key, sizeof(cryptoInfo.key));
+        memcpy(cryptoInfo.salt, salt, sizeof(cryptoInfo.salt));
+        // iv is the explicit nonce of the next record, the kernel increments it for every record it sends,
+        // so kernel records continue OpenSSL's nonce counter instead of starting a second one
+        memcpy(cryptoInfo.iv, explicitNonce, sizeof(cryptoInfo.iv));
+        memcpy(cryptoInfo.rec_seq, recordSequence, sizeof(cryptoInfo.rec_seq));
+
+        auto retval = setsockopt(socketFd, SOL_TLS, TLS_TX, &cryptoInfo, sizeof(cryptoInfo));
+        OPENSSL_cleanse(&cryptoInfo, sizeof(cryptoInfo));
+        return retval;
+    }
+}
+
+ErrorCode SecurityContextSsl::EnableKernelTlsSend(int socketFd)
+{
+    if (kernelTlsSendEnabled_) return ErrorCode();
+
+    auto ssl = ssl_.get();
+    if (!NegotiationSucceeded() || (BIO_ctrl_pending(outBio_) > 0))
+    {
+        WriteInfo(TraceType, id_, "EnableKernelTlsSend: negotiation incomplete or OpenSSL output pending");
+        return ErrorCodeValue::InvalidState;
+    }
+
+    if (SSL_version(ssl) != TLS1_2_VERSION)
+    {
+        WriteInfo(TraceType, id_, "EnableKernelTlsSend: protocol version {0:x} not supported", (uint)SSL_version(ssl));
+        return ErrorCodeValue::NotImplemented;
+    }
+
+    auto cipherName = SSL_get_cipher_name(ssl);
+    auto cipherNid = ssl->enc_write_ctx ? EVP_CIPHER_CTX_nid(ssl->enc_write_ctx) : NID_undef;
+    size_t keyLength = 0;
+    if (cipherNid == NID_aes_128_gcm)
+    {
+        keyLength = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+    }
+#ifdef TLS_CIPHER_AES_GCM_256
+    else if (cipherNid == NID_aes_256_gcm)
+    {
+        keyLength = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+    }
+#endif
+    else
+    {
+        WriteInfo(TraceType, id_, "EnableKernelTlsSend: cipher {0} not supported", cipherName);
+        return ErrorCodeValue::NotImplemented;
+    }
+
+    // AEAD key block: client_write_key, server_write_key, client_write_IV, server_write_IV, no MAC keys
+    const size_t saltLength = TLS_CIPHER_AES_GCM_128_SALT_SIZE;
+    static const char label[] = "key expansion";
+    vector<byte> seed(label, label + sizeof(label) - 1);
+    seed.insert(seed.end(), ssl->s3->server_random, ssl->s3->server_random + SSL3_RANDOM_SIZE);
+    seed.insert(seed.end(), ssl->s3->client_random, ssl->s3->client_random + SSL3_RANDOM_SIZE);
+
+    auto session = SSL_get_session(ssl);
+    auto prfDigest = strstr(cipherName, "SHA384") ? EVP_sha384() : EVP_sha256();
+    vector<byte> keyBlock(2 * (keyLength + saltLength));
+    if (!TlsPrf(prfDigest, session->master_key, session->master_key_length, seed, keyBlock.data(), keyBlock.size()))
+    {
+        auto error = cryptUtil_.GetOpensslErr();
+        WriteWarning(TraceType, id_, "EnableKernelTlsSend: key expansion failed: {0}", error);
+        return error;
+    }
+
+    auto writeKey = keyBlock.data() + (ssl->server ? keyLength : 0);
+    auto writeSalt = keyBlock.data() + 2 * keyLength + (ssl->server ? saltLength : 0);
+
+    // Takes the nonce of the next record from OpenSSL's GCM context: salt followed by the explicit nonce
+    // counter, which OpenSSL started at a random value and increments for every record. OpenSSL does not
+    // encrypt records after the handoff, so using its next nonce here cannot repeat one. If the handoff
+    // fails, OpenSSL continues with the nonce after it. The salt must match the derived one, which also
+    // verifies the key expansion against the keys OpenSSL actually uses.
+    byte nonce[EVP_GCM_TLS_FIXED_IV_LEN + EVP_GCM_TLS_EXPLICIT_IV_LEN];
+    static_assert(sizeof(nonce) == TLS_CIPHER_AES_GCM_128_SALT_SIZE + TLS_CIPHER_AES_GCM_128_IV_SIZE, "unexpected GCM nonce layout");
+    if (!EVP_CIPHER_CTX_ctrl(ssl->enc_write_ctx, EVP_CTRL_GCM_IV_GEN, sizeof(nonce), nonce) ||
+        (CRYPTO_memcmp(nonce, writeSalt, saltLength) != 0))
+    {
+        OPENSSL_cleanse(keyBlock.data(), keyBlock.size());
+        OPENSSL_cleanse(nonce, sizeof(nonce));
+        WriteWarning(TraceType, id_, "EnableKernelTlsSend: OpenSSL GCM nonce state unavailable or inconsistent with derived keys");
+        return ErrorCodeValue::NotImplemented;
+    }
+
+    auto explicitNonce = nonce + EVP_GCM_TLS_FIXED_IV_LEN;
+
+    ErrorCode error;
+    if (setsockopt(socketFd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) < 0)
+    {
+        error = ErrorCode::FromErrno();
+        WriteInfo(TraceType, id_, "EnableKernelTlsSend: failed to set TCP_ULP: {0}", error);
+    }
+    else
+    {
+        int retval = 0;
+#ifdef TLS_CIPHER_AES_GCM_256
+        if (cipherNid == NID_aes_256_gcm)
+        {
+            retval = SetKernelTlsSend<tls12_crypto_info_aes_gcm_256>(socketFd, TLS_CIPHER_AES_GCM_256, writeKey, writeSalt, explicitNonce, ssl->s3->write_sequence);
+        }
+        else
+#endif
+        {
+            retval = SetKernelTlsSend<tls12_crypto_info_aes_gcm_128>(socketFd, TLS_CIPHER_AES_GCM_128, writeKey, writeSalt, explicitNonce, ssl->s3->write_sequence);
+        }
+
+        if (retval < 0)
+        {
+            // TLS ULP without crypto info passes data through, socket remains usable with OpenSSL encryption
+            error = ErrorCode::FromErrno();
+            WriteInfo(TraceType, id_, "EnableKernelTlsSend: failed to set TLS_TX: {0}", error);
+        }
+    }
+
+    OPENSSL_cleanse(keyBlock.data(), keyBlock.size());
+    OPENSSL_cleanse(nonce, sizeof(nonce));
+    if (!error.IsSuccess()) return error;
+
+    kernelTlsSendEnabled_ = true;
+    WriteInfo(TraceType, id_, "EnableKernelTlsSend: enabled for cipher {0}", cipherName);
+    return error;
+}
+
+#else
+
+ErrorCode SecurityContextSsl::EnableKernelTlsSend(int)
+{
+    // Key material, record sequence and GCM nonce state are only accessible with OpenSSL 1.0.x. OpenSSL 3.0
+    // native kernel TLS (SSL_OP_ENABLE_KTLS) requires a socket BIO, while this context encrypts into memory BIOs.
+    WriteInfo(TraceType, id_, "EnableKernelTlsSend: not supported by this build");
+    return ErrorCodeValue::NotImplemented;
+}
+
+#endif
+
 SECURITY_STATUS SecurityContextSsl::DecodeMessage(MessageUPtr & message)
 {
     message;
@@ -463,7 +648,14 @@ SECURITY_STATUS SecurityContextSsl::DecodeMessage(bique<byte> & receiveQueue, bi
         Invariant(decryptIter < decryptLimit);
     }
 
-    if (decryptedTotal) return SEC_E_OK; 
+    if (kernelTlsSendEnabled_ && (BIO_ctrl_pending(outBio_) > 0))
+    {
+        // OpenSSL cannot write records, e.g. for renegotiation, once send direction is owned by kernel TLS
+        WriteWarning(TraceType, id_, "DecodeMessage: OpenSSL output pending with kernel TLS send enabled: {0}", BIO_ctrl_pending(outBio_));
+        return STATUS_UNSUCCESSFUL;
+    }
+
+    if (decryptedTotal) return SEC_E_OK;
 
     return status;
 }
@@ -57,6 +57,11 @@ namespace Transport
 #ifdef PLATFORM_UNIX
         Common::ErrorCode Encrypt(void const* buffer, size_t len);
         Common::ByteBuffer2 EncryptFinal();
+
+        // Hand send direction record encryption over to kernel TLS on socketFd, must be called
+        // when all records written by OpenSSL so far have been sent to socketFd
+        Common::ErrorCode EnableKernelTlsSend(int socketFd);
+        bool KernelTlsSendEnabled() const { return kernelTlsSendEnabled_; }
 #endif
 
         SECURITY_STATUS ProcessClaimsMessage(MessageUPtr & message) override;
@@ -152,6 +157,7 @@ namespace Transport
         BIO* outBio_ = nullptr;
         SslUPtr ssl_;
         Common::LinuxCryptUtil::CertChainErrors certChainErrors_;
+        bool kernelTlsSendEnabled_ = false;
 #else
         std::vector<SecurityCredentialsSPtr> svrCredentials_;
         SecPkgContext_StreamSizes streamSizes_;
@@ -287,3 +287,20 @@ void SendBuffer::SetPerfCounters(PerfCountersSPtr const & perfCounters)
 {
     perfCounters_ = perfCounters;
 }
+
+void SendBuffer::SetTransportLatency(SendLatencyHistogramsSPtr const & transportLatency)
+{
+    transportLatency_ = transportLatency;
+}
+
+void SendBuffer::RecordQueueingDelay(TimeSpan delay)
+{
+    latency_.QueueingDelay.Record(delay);
+    transportLatency_->QueueingDelay.Record(delay);
+}
+
+void SendBuffer::RecordSocketSendTime(TimeSpan sendTime)
+{
+    latency_.SocketSend.Record(sendTime);
+    transportLatency_->SocketSend.Record(sendTime);
+}
@@ -26,6 +26,8 @@ namespace Transport
         virtual void Consume(size_t length) = 0;
 
         void SetPerfCounters(PerfCountersSPtr const & perfCounters);
+        void SetTransportLatency(SendLatencyHistogramsSPtr const & transportLatency);
+        SendLatencySummary const & Latency() const { return latency_; }
         void SetSecurityProviderMask(SecurityProvider::Enum securityProvider);
 
 #ifdef PLATFORM_UNIX
@@ -54,6 +56,11 @@ namespace Transport
         virtual void EnqueueImpl(MessageUPtr && message, Common::TimeSpan expiration, bool shouldEncrypt) = 0;
         virtual void BeforeFirstEnqueue(bool shouldEncrypt) { shouldEncrypt; }
 
+        // latency is only recorded when the transport reports it, callers skip reading time otherwise
+        bool LatencyRecordingEnabled() const { return transportLatency_ != nullptr; }
+        void RecordQueueingDelay(Common::TimeSpan delay);
+        void RecordSocketSendTime(Common::TimeSpan sendTime);
+
         Common::ErrorCode TrackMessageIdIfNeeded(MessageId const &);
         void UntrackMessageIdIfNeeded(MessageId const &);
 
@@ -85,5 +92,9 @@ namespace Transport
 
         std::unique_ptr<MessageIdHashSet> messageIdTable_;
         PerfCountersSPtr perfCounters_;
+
+        SendLatencySummary latency_;
+        SendLatencyHistogramsSPtr transportLatency_;
+        Common::StopwatchTime sendStartTime_;
     };
 }
@@ -140,6 +140,11 @@ _Use_decl_annotations_ TcpConnection::TcpConnection(
     , testAssertEnabled_(target->Security()->SecurityProvider == SecurityProvider::None)
     , maxIncomingFrameSizeInBytes_(ToInternalFrameSizeLimit(target->Security()->MaxIncomingFrameSize()))
     , lastReceiveCompleteTime_(Message::NullReceiveTime())
+    , sendCoalescingWindow_(
+        (priority == TransportPriority::High) ?
+        TransportConfig::GetConfig().SendCoalescingWindowHighPriority :
+        TransportConfig::GetConfig().SendCoalescingWindow)
+    , sendCoalescingSizeLimit_(TransportConfig::GetConfig().SendCoalescingSizeLimit)
 {
     TrySetOutgoingFrameSizeLimit(ToInternalFrameSizeLimit(target->Security()->MaxOutgoingFrameSize()), true);
 
@@ -190,6 +195,7 @@ bool TcpConnection::Initialize(
 {
 #ifdef PLATFORM_UNIX
     transport->EventLoops()->AssignPair(&evtLoopIn_, &evtLoopOut_);
+    socketPriority_ = transport->SocketPriority();
 #endif
 
     if (!externalMessageHandler_)
@@ -216,6 +222,7 @@ bool TcpConnection::Initialize(
     sendBuffer_ = transport->BufferFactory().CreateSendBuffer(this);
     sendBuffer_->SetLimit(transport->PerTargetSendQueueLimit());
     sendBuffer_->SetPerfCounters(transport->PerfCounters());
+    sendBuffer_->SetTransportLatency(transport->SendLatency());
 
     receiveBuffer_ = transport->BufferFactory().CreateReceiveBuffer(this);
     receiveBufferToReserve_ = (receiveChunkSize_ > transport->RecvBufferSize()) ? receiveChunkSize_ : transport->RecvBufferSize();
@@ -269,6 +276,20 @@ bool TcpConnection::FinishSocketInit()
         }
     }
 
+#ifdef PLATFORM_UNIX
+    if (socketPriority_ >= 0)
+    {
+        auto error = socket_.SetSocketOption(SOL_SOCKET, SO_PRIORITY, socketPriority_);
+        if (!error.IsSuccess())
+        {
+            WriteWarning(
+                TraceType, traceId_,
+                "{0}-{1} failed to set SO_PRIORITY to {2}: {3}",
+                localAddress_, targetAddress_, socketPriority_, error);
+        }
+    }
+#endif
+
     int recvBufSize = 0;
     auto error = socket_.GetSocketOption(SOL_SOCKET, SO_RCVBUF, recvBufSize);
     if (!error.IsSuccess())
@@ -351,6 +372,8 @@ bool TcpConnection::FinishSocketInit()
             targetAddress_,
             error);
     }
+#else
+    EnableZeroCopySendIfNeeded();
 #endif
 
     // Enable keep alive so that non-responsive remote side can be detected
@@ -971,6 +994,14 @@ void TcpConnection::ScheduleCleanup_CallerHoldingLock()
         localAddress_,
         targetAddress_);
 
+    if (sendBuffer_ && (sendBuffer_->Latency().QueueingDelay.Count > 0))
+    {
+        WriteInfo(
+            TraceType, traceId_,
+            "{0}-{1} send latency: {2}",
+            localAddress_, targetAddress_, sendBuffer_->Latency());
+    }
+
 #ifndef PLATFORM_UNIX
     ::CancelIoEx((HANDLE)socket_.GetHandle(), nullptr);
 #endif
@@ -1594,6 +1625,11 @@ ErrorCode TcpConnection::Send(MessageUPtr && message, TimeSpan expiration, bool
     ErrorCode errorCode;
     bool shouldConnect = false;
     bool shouldSend = false;
+    bool shouldScheduleFlush = false;
+    uint64 coalescingWindow = 0;
+    bool hasMessage = (message != nullptr);
+    // message size is only needed for send coalescing, computing it walks message headers and body
+    size_t messageSize = (hasMessage && (sendCoalescingWindow_ > TimeSpan::Zero)) ? message->SerializedSize() : 0;
     {
         AcquireWriteLock grab(lock_);
 
@@ -1653,6 +1689,14 @@ ErrorCode TcpConnection::Send(MessageUPtr && message, TimeSpan expiration, bool
             }
         }
 
+        if (sendCoalescing_ &&
+            ((messageSize >= sendCoalescingSizeLimit_) || (sendBuffer_->BytesPendingForSend() >= sendCoalescingSizeLimit_)))
+        {
+            // flush coalesced messages without waiting for the window to pass
+            sendCoalescing_ = false;
+            sendActive_ = false;
+        }
+
         if (sendActive_ || sendBuffer_->Empty())
         {
             return errorCode;
@@ -1663,8 +1707,18 @@ ErrorCode TcpConnection::Send(MessageUPtr && message, TimeSpan expiration, bool
             TransitToState_CallerHoldingLock(TcpConnectionState::Connecting);
             shouldConnect = true;
         }
+        else if (ShouldCoalesceSend_CallerHoldingLock(hasMessage, messageSize))
+        {
+            sendCoalescing_ = true;
+            sendActive_ = true;
+            shouldScheduleFlush = true;
+            coalescingWindow = ++sendCoalescingWindowCount_;
+        }
         else if ((state_ == TcpConnectionState::Connected) || (state_ == TcpConnectionState::CloseDraining))
         {
+#ifdef PLATFORM_UNIX
+            EnableKernelTlsSendIfNeeded_CallerHoldingLock();
+#endif
             auto error = sendBuffer_->Prepare();
             if (!error.IsSuccess())
             {
@@ -1692,6 +1746,13 @@ ErrorCode TcpConnection::Send(MessageUPtr && message, TimeSpan expiration, bool
         return errorCode;
     }
 
+    if (shouldScheduleFlush)
+    {
+        auto thisSPtr = shared_from_this();
+        Threadpool::Post([thisSPtr, coalescingWindow] { thisSPtr->FlushCoalescedSend(coalescingWindow); }, sendCoalescingWindow_);
+        return errorCode;
+    }
+
     if (shouldSend)
     {
         SubmitSend();
@@ -1700,6 +1761,34 @@ ErrorCode TcpConnection::Send(MessageUPtr && message, TimeSpan expiration, bool
     return errorCode;
 }
 
+bool TcpConnection::ShouldCoalesceSend_CallerHoldingLock(bool hasMessage, size_t messageSize) const
+{
+    // only delay new small messages on an idle connection, pump calls (no message) send right away
+    return
+        (sendCoalescingWindow_ > TimeSpan::Zero) &&
+        (state_ == TcpConnectionState::Connected) &&
+        hasMessage &&
+        (messageSize < sendCoalescingSizeLimit_) &&
+        (sendBuffer_->BytesPendingForSend() < sendCoalescingSizeLimit_);
+}
+
+void TcpConnection::FlushCoalescedSend(uint64 window)
+{
+    {
+        AcquireWriteLock grab(lock_);
+
+        // coalesced messages may have been flushed already by a large enough send, a later
+        // window started after that must not be cut short by the timer of this one
+        if (!sendCoalescing_ || (window != sendCoalescingWindowCount_)) return;
+
+        sendCoalescing_ = false;
+        sendActive_ = false;
+    }
+
+    WriteNoise(TraceType, traceId_, "flushing coalesced messages");
+    Send(nullptr, TimeSpan::MaxValue, false);
+}
+
 void TcpConnection::SendComplete(ErrorCode error, ULONG_PTR bytesTransferred)
 {
     // Upon overlapped IO completion, WSASend either has sent all the bytes successfully, or a failure
@@ -2267,7 +2356,8 @@ void TcpConnection::RegisterEvtLoopIn()
         socket_.GetHandle(),
         EPOLLIN,
         eventLoopDispatchReadAsync_,
-        [this] (int sd, uint evts) { ReadEvtCallback(sd, evts); });
+        [this] (int sd, uint evts) { ReadEvtCallback(sd, evts); },
+        TransportConfig::GetConfig().ZeroCopySendThreshold > 0);
 }
 
 void TcpConnection::RegisterEvtLoopOut()
@@ -2276,7 +2366,174 @@ void TcpConnection::RegisterEvtLoopOut()
         socket_.GetHandle(),
         EPOLLOUT,
         eventLoopDispatchWriteAsync_,
-        [this] (int sd, uint evts) { WriteEvtCallback(sd, evts); });
+        [this] (int sd, uint evts) { WriteEvtCallback(sd, evts); },
+        TransportConfig::GetConfig().ZeroCopySendThreshold > 0);
+}
+
+void TcpConnection::EnableZeroCopySendIfNeeded()
+{
+    auto threshold = TransportConfig::GetConfig().ZeroCopySendThreshold;
+    if (threshold == 0) return;
+
+    auto error = socket_.SetSocketOption(SOL_SOCKET, SO_ZEROCOPY, 1);
+    if (!error.IsSuccess())
+    {
+        WriteInfo(TraceType, traceId_, "SO_ZEROCOPY not supported, zero-copy send disabled: {0}", error);
+        return;
+    }
+
+    zeroCopySendThreshold_ = threshold;
+    WriteInfo(TraceType, traceId_, "zero-copy send enabled for batches of at least {0} bytes", zeroCopySendThreshold_);
+}
+
+ssize_t TcpConnection::SendZeroCopy(ConstBuffer const * buffers, int bufferCount)
+{
+    msghdr msg = {};
+    msg.msg_iov = const_cast<ConstBuffer*>(buffers);
+    msg.msg_iovlen = bufferCount;
+
+    auto sent = sendmsg(socket_.GetHandle(), &msg, MSG_ZEROCOPY);
+    if ((sent < 0) && (errno == ENOBUFS))
+    {
+        // socket option memory for completion notifications is exhausted, send with copy instead
+        WriteNoise(TraceType, traceId_, "sendmsg(MSG_ZEROCOPY) returned ENOBUFS, fall back to writev");
+        return writev(socket_.GetHandle(), buffers, bufferCount);
+    }
+
+    if (sent > 0)
+    {
+        ++zeroCopySendCount_;
+    }
+
+    return sent;
+}
+
+void TcpConnection::ReapZeroCopyCompletions_CallerHoldingLock()
+{
+    for(;;)
+    {
+        char control[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+        msghdr msg = {};
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        auto retval = recvmsg(socket_.GetHandle(), &msg, MSG_ERRQUEUE);
+        if (retval < 0)
+        {
+            if (errno == EINTR) continue;
+
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            {
+                WriteWarning(TraceType, traceId_, "recvmsg(MSG_ERRQUEUE) failed: {0}", ErrorCode::FromErrno());
+            }
+
+            return;
+        }
+
+        for (auto cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (!(((cmsg->cmsg_level == SOL_IP) && (cmsg->cmsg_type == IP_RECVERR)) ||
+                  ((cmsg->cmsg_level == SOL_IPV6) && (cmsg->cmsg_type == IPV6_RECVERR))))
+            {
+                continue;
+            }
+
+            auto serr = (sock_extended_err const*)CMSG_DATA(cmsg);
+            if ((serr->ee_errno != 0) || (serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY)) continue;
+
+            // [ee_info, ee_data] is the inclusive range of completed sendmsg calls
+            zeroCopyCompletedCount_ += (serr->ee_data - serr->ee_info + 1);
+
+            if ((serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) && !zeroCopyCopiedReported_)
+            {
+                zeroCopyCopiedReported_ = true;
+                WriteInfo(TraceType, traceId_, "{0}-{1}: kernel copied zero-copy send data, e.g. loopback or unsupported device", localAddress_, targetAddress_);
+            }
+        }
+    }
+}
+
+void TcpConnection::WaitForZeroCopyCompletion_CallerHoldingLock()
+{
+    // Completion notifications are reported as EPOLLERR, arm the idle write side for EPOLLERR only,
+    // so that completions are observed even when receive is paused and no receive is pending
+    if (state_ > TcpConnectionState::CloseDraining) return;
+
+    auto error = evtLoopOut_->Activate(fdCtxOut_, 0);
+    if (!error.IsSuccess())
+    {
+        Close_CallerHoldingLock(true, ErrorCodeValue::OperationCanceled);
+    }
+}
+
+void TcpConnection::OnZeroCopyCompletionReported(bool fromWriteEvent)
+{
+    uint bytesToComplete = 0;
+    {
+        AcquireWriteLock grab(lock_);
+
+        ReapZeroCopyCompletions_CallerHoldingLock();
+        if (zeroCopyBytesPendingCompletion_ == 0)
+        {
+            if (fromWriteEvent && (state_ <= TcpConnectionState::CloseDraining))
+            {
+                // write side was waiting for the socket to be writable, keep waiting
+                auto error = evtLoopOut_->Activate(fdCtxOut_);
+                if (!error.IsSuccess())
+                {
+                    Close_CallerHoldingLock(true, ErrorCodeValue::OperationCanceled);
+                }
+            }
+
+            return;
+        }
+
+        if (zeroCopyCompletedCount_ != zeroCopySendCount_)
+        {
+            // write side stays armed for EPOLLERR until all completions are reported
+            if (fromWriteEvent)
+            {
+                WaitForZeroCopyCompletion_CallerHoldingLock();
+            }
+
+            return;
+        }
+
+        bytesToComplete = zeroCopyBytesPendingCompletion_;
+        zeroCopyBytesPendingCompletion_ = 0;
+    }
+
+    // SendComplete must be called outside lock_ scope to avoid deadlock
+    WriteNoise(TraceType, traceId_, "zero-copy send completed: {0} bytes", bytesToComplete);
+    SendComplete(ErrorCode(), bytesToComplete);
+}
+
+void TcpConnection::EnableKernelTlsSendIfNeeded_CallerHoldingLock()
+{
+    // Only called before preparing a new send batch, at which point all records
+    // encrypted by OpenSSL for previous batches have been written to the socket
+    if (kernelTlsSendChecked_ || !securityContext_ || !securityContext_->NegotiationSucceeded()) return;
+
+    kernelTlsSendChecked_ = true;
+    if (!TransportConfig::GetConfig().KernelTlsSendEnabled) return;
+
+    auto provider = securityContext_->TransportSecurity().SecurityProvider;
+    if ((provider != SecurityProvider::Ssl) && (provider != SecurityProvider::Claims)) return;
+
+    auto securityContextSsl = (SecurityContextSsl*)securityContext_.get();
+    auto error = securityContextSsl->EnableKernelTlsSend(socket_.GetHandle());
+    if (!error.IsSuccess())
+    {
+        WriteInfo(
+            TraceType, traceId_,
+            "{0}-{1}: kernel TLS send not enabled, continue with OpenSSL encryption: {2}",
+            localAddress_, targetAddress_, error);
+        return;
+    }
+
+    // MSG_ZEROCOPY is not supported on kernel TLS sockets
+    zeroCopySendThreshold_ = 0;
+    WriteInfo(TraceType, traceId_, "{0}-{1}: kernel TLS send enabled", localAddress_, targetAddress_);
 }
 
 void TcpConnection::UnregisterEvtLoopIn(bool waitForCallback)
@@ -2311,6 +2568,24 @@ void TcpConnection::ReadEvtCallback(int sd, uint events)
     WriteNoise(TraceType, traceId_, "ReadEvtCallback: sd = {0:x}, events = {1:x}", sd, events);
     if(SocketErrorReported(sd, events)) return;
 
+    if (events & EPOLLERR)
+    {
+        // zero-copy completions may be reaped here first, which consumes the EPOLLERR the write side waits for
+        OnZeroCopyCompletionReported(false);
+    }
+
+    if ((events & (EPOLLIN | EPOLLHUP)) == 0)
+    {
+        // only zero-copy completions were reported, keep waiting for incoming data
+        auto error = evtLoopIn_->Activate(fdCtxIn_);
+        if (!error.IsSuccess())
+        {
+            AbortWithRetryableError();
+        }
+
+        return;
+    }
+
     auto const & buffers = receiveBuffer_->GetBuffers(receiveBufferToReserve_);
     for(;;)
     {
@@ -2350,9 +2625,12 @@ void TcpConnection::OnSocketWriteEvt()
 //            }
 //#endif 
 
+            bool zeroCopy = (zeroCopySendThreshold_ > 0) && (totalPreparedBytes >= zeroCopySendThreshold_);
             do
             {
-                sent = writev(socket_.GetHandle(), &(buffers[bufferIndex]), bufferCount);
+                sent = zeroCopy?
+                    SendZeroCopy(&(buffers[bufferIndex]), bufferCount) :
+                    writev(socket_.GetHandle(), &(buffers[bufferIndex]), bufferCount);
             }
             while((sent < 0) && (errno == EINTR));
 
@@ -2366,6 +2644,26 @@ void TcpConnection::OnSocketWriteEvt()
             {
                 sendCompleted = sendBuffer_->ConsumePreparedBuffers(sent);
             }
+
+            if (sendCompleted && (zeroCopyCompletedCount_ != zeroCopySendCount_))
+            {
+                ReapZeroCopyCompletions_CallerHoldingLock();
+                if (zeroCopyCompletedCount_ != zeroCopySendCount_)
+                {
+                    // kernel may still read from send buffers, defer SendComplete to completion notification,
+                    // which is reported as EPOLLERR on this socket, see OnZeroCopyCompletionReported
+                    WriteNoise(
+                        TraceType, traceId_,
+                        "defer send completion of {0} bytes, zero-copy sends: issued = {1}, completed = {2}",
+                        totalPreparedBytes,
+                        zeroCopySendCount_,
+                        zeroCopyCompletedCount_);
+
+                    zeroCopyBytesPendingCompletion_ = totalPreparedBytes;
+                    WaitForZeroCopyCompletion_CallerHoldingLock();
+                    return;
+                }
+            }
         }
         else
         {
@@ -2414,7 +2712,6 @@ bool TcpConnection::SocketErrorReported(int sd, uint events)
 {
     if ((events & EPOLLERR) == 0) return false;
 
-    WriteInfo(TraceType, traceId_, "socket error reported");
     int sockError;
     socklen_t sockErrorSize = sizeof(sockError);
     if (getsockopt(sd, SOL_SOCKET, SO_ERROR, &sockError, &sockErrorSize) < 0)
@@ -2430,6 +2727,14 @@ bool TcpConnection::SocketErrorReported(int sd, uint events)
         return true;
     }
 
+    if ((sockError == 0) && ((events & EPOLLHUP) == 0) && (zeroCopySendThreshold_ > 0))
+    {
+        // EPOLLERR without pending socket error: zero-copy completions queued on error queue,
+        // handled by the read and write event callbacks, see OnZeroCopyCompletionReported
+        return false;
+    }
+
+    WriteInfo(TraceType, traceId_, "socket error reported: {0}", sockError);
     auto error = sockError? ErrorCode::FromErrno(sockError) : ErrorCodeValue::OperationCanceled;
     if (state_ == TcpConnectionState::Connecting)
     {
@@ -2446,6 +2751,13 @@ void TcpConnection::WriteEvtCallback(int sd, uint events)
     WriteNoise(TraceType, traceId_, "WriteEvtCallback: sd = {0:x}, events = {1:x}", sd, events);
     if(SocketErrorReported(sd, events)) return;
 
+    if ((events & (EPOLLOUT | EPOLLHUP)) == 0)
+    {
+        // only zero-copy completions were reported, OnZeroCopyCompletionReported re-arms write side
+        OnZeroCopyCompletionReported(true);
+        return;
+    }
+
     if (state_ == TcpConnectionState::Connecting)
     {
         ErrorCode err;
@@ -208,6 +208,9 @@ namespace Transport
 
         bool CompletedAllSending_CallerHoldingLock() const;
 
+        bool ShouldCoalesceSend_CallerHoldingLock(bool hasMessage, size_t messageSize) const;
+        void FlushCoalescedSend(uint64 window);
+
         void AbortWithRetryableError();
 
     private:
@@ -219,6 +222,8 @@ namespace Transport
         bool const inbound_;
         volatile bool receivePending_ = false;
         bool sendActive_ = false;
+        bool sendCoalescing_ = false; // sendActive_ is also set while waiting for coalescing window to pass
+        uint64 sendCoalescingWindowCount_ = 0; // identifies the current window to its flush callback
         bool connectActive_ = false;
         bool instanceConfirmed_ = false;
         bool shouldReportFault_ = true;
@@ -238,6 +243,7 @@ namespace Transport
 #ifdef PLATFORM_UNIX
         bool eventLoopDispatchReadAsync_ = true;
         bool eventLoopDispatchWriteAsync_ = false;
+        int socketPriority_ = -1;
 #endif
 
         Common::ErrorCode fault_;
@@ -279,10 +285,28 @@ namespace Transport
         void OnSocketWriteEvt();
         int get_iov_count(size_t bufferCount);
 
+        void EnableZeroCopySendIfNeeded();
+        ssize_t SendZeroCopy(ConstBuffer const * buffers, int bufferCount);
+        void OnZeroCopyCompletionReported(bool fromWriteEvent);
+        void WaitForZeroCopyCompletion_CallerHoldingLock();
+        void ReapZeroCopyCompletions_CallerHoldingLock();
+
+        void EnableKernelTlsSendIfNeeded_CallerHoldingLock();
+
         Common::EventLoop* evtLoopIn_ = nullptr;
         Common::EventLoop* evtLoopOut_ = nullptr;
         Common::EventLoop::FdContext* fdCtxIn_ = nullptr;
         Common::EventLoop::FdContext* fdCtxOut_ = nullptr;
+
+        // MSG_ZEROCOPY send state, buffers of a completed send batch cannot be
+        // consumed until the kernel reports completion for all zero-copy sends
+        uint zeroCopySendThreshold_ = 0;
+        uint32 zeroCopySendCount_ = 0;
+        uint32 zeroCopyCompletedCount_ = 0;
+        uint zeroCopyBytesPendingCompletion_ = 0;
+        bool zeroCopyCopiedReported_ = false;
+
+        bool kernelTlsSendChecked_ = false;
 #else
         void CleanupThreadPoolIo();
 
@@ -325,6 +349,9 @@ namespace Transport
 
         ReadyCallback readyCallback_;
 
+        Common::TimeSpan const sendCoalescingWindow_;
+        size_t const sendCoalescingSizeLimit_;
+
         static Common::atomic_uint64 outgoingConnectionCount_;
         static Common::atomic_uint64 connectFailureCount_;
         static Common::atomic_uint64 connectionFailureCount_;
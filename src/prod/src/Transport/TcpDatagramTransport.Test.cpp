@@ -2176,6 +2176,176 @@ namespace Transport
         LEAVE;
     }
 
+    BOOST_AUTO_TEST_CASE(SendCoalescing_WindowFlush)
+    {
+        ENTER;
+
+        auto window = TimeSpan::FromSeconds(3);
+        auto saved = TransportConfig::GetConfig().SendCoalescingWindow;
+        TransportConfig::GetConfig().SendCoalescingWindow = window;
+        KFinally([=] { TransportConfig::GetConfig().SendCoalescingWindow = saved; });
+
+        LONG const coalescedCount = 10;
+        LONG messageCount = 0;
+        AutoResetEvent received;
+
+        auto sender = TcpDatagramTransport::Create(TTestUtil::GetListenAddress());
+        auto receiver = TcpDatagramTransport::Create(TTestUtil::GetListenAddress());
+        receiver->SetMessageHandler([&](MessageUPtr &, ISendTarget::SPtr const &)
+        {
+            auto count = InterlockedIncrement((volatile LONG *)&messageCount);
+            if ((count == 1) || (count == coalescedCount + 1))
+            {
+                received.Set();
+            }
+        });
+
+        VERIFY_IS_TRUE(receiver->Start().IsSuccess());
+        VERIFY_IS_TRUE(sender->Start().IsSuccess());
+
+        ISendTarget::SPtr target = sender->ResolveTarget(receiver->ListenAddress());
+        VERIFY_IS_TRUE(target);
+
+        // first message is sent when the connection is established, without coalescing
+        sender->SendOneWay(target, make_unique<Message>(TcpTestMessage(L"connect")));
+        VERIFY_IS_TRUE(received.WaitOne(TimeSpan::FromSeconds(30)));
+
+        Stopwatch stopwatch;
+        stopwatch.Start();
+        for (LONG i = 0; i < coalescedCount; ++i)
+        {
+            sender->SendOneWay(target, make_unique<Message>(TcpTestMessage(L"small message")));
+        }
+
+        // small messages wait for the window to pass
+        VERIFY_IS_FALSE(received.WaitOne(window - TimeSpan::FromSeconds(1)));
+        VERIFY_ARE_EQUAL(1, messageCount);
+
+        VERIFY_IS_TRUE(received.WaitOne(TimeSpan::FromSeconds(30)));
+        Trace.WriteInfo(TraceType, "coalesced messages received after {0}", stopwatch.Elapsed);
+        VERIFY_ARE_EQUAL(coalescedCount + 1, messageCount);
+
+        sender->Stop();
+        receiver->Stop();
+
+        LEAVE;
+    }
+
+    BOOST_AUTO_TEST_CASE(SendCoalescing_SizeLimitFlush)
+    {
+        ENTER;
+
+        // window is long enough that only the size limit can flush within the wait below
+        auto saved = TransportConfig::GetConfig().SendCoalescingWindow;
+        TransportConfig::GetConfig().SendCoalescingWindow = TimeSpan::FromMinutes(5);
+        KFinally([=] { TransportConfig::GetConfig().SendCoalescingWindow = saved; });
+
+        LONG messageCount = 0;
+        AutoResetEvent received;
+
+        auto sender = TcpDatagramTransport::Create(TTestUtil::GetListenAddress());
+        auto receiver = TcpDatagramTransport::Create(TTestUtil::GetListenAddress());
+        receiver->SetMessageHandler([&](MessageUPtr &, ISendTarget::SPtr const &)
+        {
+            auto count = InterlockedIncrement((volatile LONG *)&messageCount);
+            if ((count == 1) || (count == 3))
+            {
+                received.Set();
+            }
+        });
+
+        VERIFY_IS_TRUE(receiver->Start().IsSuccess());
+        VERIFY_IS_TRUE(sender->Start().IsSuccess());
+
+        ISendTarget::SPtr target = sender->ResolveTarget(receiver->ListenAddress());
+        VERIFY_IS_TRUE(target);
+
+        sender->SendOneWay(target, make_unique<Message>(TcpTestMessage(L"connect")));
+        VERIFY_IS_TRUE(received.WaitOne(TimeSpan::FromSeconds(30)));
+
+        sender->SendOneWay(target, make_unique<Message>(TcpTestMessage(L"small message")));
+        VERIFY_IS_FALSE(received.WaitOne(TimeSpan::FromSeconds(1)));
+
+        // large message flushes the window together with the small message queued before it
+        wstring large(TransportConfig::GetConfig().SendCoalescingSizeLimit, L'x');
+        sender->SendOneWay(target, make_unique<Message>(TcpTestMessage(large)));
+        VERIFY_IS_TRUE(received.WaitOne(TimeSpan::FromSeconds(30)));
+        VERIFY_ARE_EQUAL(3, messageCount);
+
+        sender->Stop();
+        receiver->Stop();
+
+        LEAVE;
+    }
+
+    BOOST_AUTO_TEST_CASE(SendCoalescing_Ordering)
+    {
+        ENTER;
+
+        auto saved = TransportConfig::GetConfig().SendCoalescingWindow;
+        TransportConfig::GetConfig().SendCoalescingWindow = TimeSpan::FromMilliseconds(20);
+        KFinally([=] { TransportConfig::GetConfig().SendCoalescingWindow = saved; });
+
+        LONG const totalCount = 500;
+        LONG messageCount = 0;
+        atomic_bool inOrder(true);
+        AutoResetEvent allReceived;
+
+        auto sender = TcpDatagramTransport::Create(TTestUtil::GetListenAddress());
+        auto receiver = TcpDatagramTransport::Create(TTestUtil::GetListenAddress());
+        receiver->SetMessageHandler([&](MessageUPtr & message, ISendTarget::SPtr const &)
+        {
+            TcpTestMessage body;
+            VERIFY_IS_TRUE(message->GetBody(body));
+
+            // messages are dispatched one at a time per connection, in the order they were received
+            auto count = InterlockedIncrement((volatile LONG *)&messageCount);
+            auto index = _wtoi(body.message_.c_str());
+            if (index != count - 1)
+            {
+                Trace.WriteError(TraceType, "message {0} received as #{1}", index, count - 1);
+                inOrder.store(false);
+            }
+
+            if (count == totalCount)
+            {
+                allReceived.Set();
+            }
+        });
+
+        VERIFY_IS_TRUE(receiver->Start().IsSuccess());
+        VERIFY_IS_TRUE(sender->Start().IsSuccess());
+
+        ISendTarget::SPtr target = sender->ResolveTarget(receiver->ListenAddress());
+        VERIFY_IS_TRUE(target);
+
+        // mix of coalesced small messages, large messages that flush the window and pauses that let windows pass
+        for (LONG i = 0; i < totalCount; ++i)
+        {
+            wstring text = wformatString("{0}", i);
+            if (i % 17 == 0)
+            {
+                text.append(TransportConfig::GetConfig().SendCoalescingSizeLimit, L' ');
+            }
+
+            sender->SendOneWay(target, make_unique<Message>(TcpTestMessage(text)));
+
+            if (i % 50 == 0)
+            {
+                Sleep(30);
+            }
+        }
+
+        VERIFY_IS_TRUE(allReceived.WaitOne(TimeSpan::FromSeconds(60)));
+        VERIFY_ARE_EQUAL(totalCount, messageCount);
+        VERIFY_IS_TRUE(inOrder.load());
+
+        sender->Stop();
+        receiver->Stop();
+
+        LEAVE;
+    }
+
     BOOST_AUTO_TEST_CASE(AbortReceiver)
     {
         ENTER;
@@ -2758,6 +2928,60 @@ namespace Transport
         LEAVE;
     }
 
+    BOOST_AUTO_TEST_CASE(ZeroCopySendTest)
+    {
+        ENTER;
+
+        // Send batches above threshold go through sendmsg(MSG_ZEROCOPY), their send completion is deferred until
+        // the kernel reports completion on the socket error queue. Loopback completes by copying, which still
+        // reports completions, so all messages must be received and the send queue must drain.
+        auto savedThreshold = TransportConfig::GetConfig().ZeroCopySendThreshold;
+        TransportConfig::GetConfig().ZeroCopySendThreshold = 64 * 1024;
+        KFinally([=] { TransportConfig::GetConfig().ZeroCopySendThreshold = savedThreshold; });
+
+        auto sender = TcpDatagramTransport::CreateClient();
+        auto receiver = TcpDatagramTransport::Create(L"127.0.0.1:0");
+
+        size_t const toSend = 20;
+        wstring testAction = TTestUtil::GetGuidAction();
+        AutoResetEvent messagesReceived;
+        atomic_uint64 receiveCount(0);
+        TTestUtil::SetMessageHandler(
+            receiver,
+            testAction,
+            [&, toSend](MessageUPtr &, ISendTarget::SPtr const &) -> void
+            {
+                if (++receiveCount == toSend)
+                {
+                    messagesReceived.Set();
+                }
+            });
+
+        VERIFY_IS_TRUE(receiver->Start().IsSuccess());
+        VERIFY_IS_TRUE(sender->Start().IsSuccess());
+
+        ISendTarget::SPtr target = sender->ResolveTarget(receiver->ListenAddress());
+        VERIFY_IS_TRUE(target);
+
+        for (size_t i = 0; i < toSend; ++i)
+        {
+            // alternate between batches sent with and without MSG_ZEROCOPY
+            TestMessageBody body((i % 2 == 0) ? 1024 * 1024 : 1024);
+            auto msg = make_unique<Message>(body);
+            msg->Headers.Add(ActionHeader(testAction));
+            msg->Headers.Add(MessageIdHeader());
+            sender->SendOneWay(target, std::move(msg));
+        }
+
+        VERIFY_IS_TRUE(messagesReceived.WaitOne(TimeSpan::FromSeconds(30)));
+        VERIFY_IS_TRUE(receiveCount.load() == toSend);
+
+        sender->Stop();
+        receiver->Stop();
+
+        LEAVE;
+    }
+
 #else //LINUXTODO: enable the following tests for Linux
 
     BOOST_AUTO_TEST_CASE(SendQueueExpirationTest_ZeroExpiration)
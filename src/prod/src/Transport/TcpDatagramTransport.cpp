@@ -315,6 +315,41 @@ void TcpDatagramTransport::ListenerStateTraceCallback()
     trace.State(traceId_, owner_, listenAddress_, instance_, security_->ToString());
 }
 
+void TcpDatagramTransport::StartLatencyReportTimer_CallerHoldingWLock()
+{
+    if (!sendLatency_) return;
+
+    auto reportInterval = TransportConfig::GetConfig().LatencyReportInterval;
+
+    latencyReportTimer_ = Timer::Create(
+        "LatencyReport",
+        [this](TimerSPtr const&) { LatencyReportCallback(); },
+        false,
+        Throttle::GetThrottle()->MonitorCallbackEnv());
+
+    latencyReportTimer_->SetCancelWait();
+    auto randomStartDelay = TimeSpan::FromMilliseconds(reportInterval.TotalMilliseconds() * (0.5 + 0.5 * Random().NextDouble()));
+    latencyReportTimer_->Change(randomStartDelay, reportInterval);
+}
+
+void TcpDatagramTransport::LatencyReportCallback()
+{
+    LatencyHistogram queueingDelay;
+    sendLatency_->QueueingDelay.TakeSnapshot(queueingDelay);
+    LatencyHistogram socketSend;
+    sendLatency_->SocketSend.TakeSnapshot(socketSend);
+    if ((queueingDelay.Count() == 0) && (socketSend.Count() == 0)) return;
+
+    perfCounters_->SendQueueingDelayP50.Value = queueingDelay.PercentileMicroseconds(50);
+    perfCounters_->SendQueueingDelayP99.Value = queueingDelay.PercentileMicroseconds(99);
+    perfCounters_->SocketSendTimeP99.Value = socketSend.PercentileMicroseconds(99);
+
+    WriteInfo(
+        Constants::TcpTrace, traceId_,
+        "{0}: send latency: queueing: {1}, socket send: {2}",
+        listenAddress_, queueingDelay, socketSend);
+}
+
 void TcpDatagramTransport::StartConnectionValicationTimer_CallerHoldingWLock()
 {
     auto checkInterval = std::min(connectionIdleTimeout_, TransportConfig::GetConfig().ReceiveMissingThreshold);
@@ -1139,6 +1174,7 @@ bool TcpDatagramTransport::AllowedToThrottleReply() const
 void TcpDatagramTransport::StartTimers_CallerHoldingWLock()
 {
     StartListenerStateTraceTimer_CallerHoldingWLock();
+    StartLatencyReportTimer_CallerHoldingWLock();
     StartConnectionValicationTimer_CallerHoldingWLock();
     StartSendQueueCheckTimer_CallerHoldingWLock();
     StartCertMonitorTimerIfNeeded_CallerHoldingWLock();
@@ -1151,6 +1187,11 @@ void TcpDatagramTransport::CancelTimers()
         listenerStateTraceTimer_->Cancel();
     }
 
+    if (latencyReportTimer_)
+    {
+        latencyReportTimer_->Cancel();
+    }
+
     if (connectionValidationTimer_)
     {
         connectionValidationTimer_->Cancel();
@@ -115,6 +115,8 @@ namespace Transport
         void SetEventLoopPool(Common::EventLoopPool* pool) override; 
         void SetEventLoopReadDispatch(bool asyncDispatch) override { eventLoopDispatchReadAsync_ = asyncDispatch; }
         void SetEventLoopWriteDispatch(bool asyncDispatch) override { eventLoopDispatchWriteAsync_ = asyncDispatch; }
+        void SetSocketPriority(int priority) override { socketPriority_ = priority; }
+        int SocketPriority() const { return socketPriority_; }
 #endif
 
         void SetBufferFactory(std::unique_ptr<IBufferFactory> && bufferFactory) override;
@@ -138,6 +140,7 @@ namespace Transport
         void ValidateConnections();
 
         PerfCountersSPtr const & PerfCounters() const;
+        SendLatencyHistogramsSPtr const & SendLatency() const { return sendLatency_; }
 
         static uint64 GetObjCount();
 
@@ -226,6 +229,9 @@ namespace Transport
         void StartListenerStateTraceTimer_CallerHoldingWLock();
         void ListenerStateTraceCallback();
 
+        void StartLatencyReportTimer_CallerHoldingWLock();
+        void LatencyReportCallback();
+
         void StartCertMonitorTimerIfNeeded_CallerHoldingWLock();
         void CertMonitorTimerCallback();
         void RefreshIssuersIfNeeded();
@@ -271,6 +277,7 @@ namespace Transport
 #ifdef PLATFORM_UNIX
         bool eventLoopDispatchReadAsync_ = true; 
         bool eventLoopDispatchWriteAsync_ = false; 
+        int socketPriority_ = -1;
 #endif
 
         uint recvBufferSize_;
@@ -290,9 +297,13 @@ namespace Transport
         Common::TimerSPtr certMonitorTimer_;
 
         Common::TimerSPtr listenerStateTraceTimer_;
+        Common::TimerSPtr latencyReportTimer_;
 
         Throttle * throttle_;
         PerfCountersSPtr perfCounters_;
+        // null when latency reporting is disabled, connections then skip recording send latency
+        SendLatencyHistogramsSPtr const sendLatency_ =
+            (TransportConfig::GetConfig().LatencyReportInterval > Common::TimeSpan::Zero) ? std::make_shared<SendLatencyHistograms>() : nullptr;
 
         std::unique_ptr<IBufferFactory> bufferFactory_ = Common::make_unique<TcpBufferFactory>();
 
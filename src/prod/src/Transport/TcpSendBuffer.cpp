@@ -23,7 +23,8 @@ TcpSendBuffer::Frame::Frame(
     MessageUPtr && message,
     byte securityProviderMask,
     TimeSpan expiration,
-    bool shouldEncrypt)
+    bool shouldEncrypt,
+    bool recordEnqueueTime)
 : header_(message, securityProviderMask)
 , message_(std::move(message))
 , shouldEncrypt_(shouldEncrypt)
@@ -35,12 +36,17 @@ TcpSendBuffer::Frame::Frame(
     if (expiration == TimeSpan::MaxValue)
     {
         expiration_ = StopwatchTime::MaxValue;
+        if (recordEnqueueTime)
+        {
+            enqueueTime_ = Stopwatch::Now();
+        }
+
         return;
     }
 
-    StopwatchTime now = Stopwatch::Now();
-    expiration_ = now + expiration;
-    if (expiration_ < now) // overflow?
+    enqueueTime_ = Stopwatch::Now();
+    expiration_ = enqueueTime_ + expiration;
+    if (expiration_ < enqueueTime_) // overflow?
     {
         expiration_ = StopwatchTime::MaxValue;
     }
@@ -97,7 +103,12 @@ ErrorCode TcpSendBuffer::Frame::EncryptIfNeeded(TcpSendBuffer & sendBuffer)
     auto provider = securityContext->TransportSecurity().SecurityProvider;
     Invariant(provider == SecurityProvider::Ssl || provider == SecurityProvider::Claims);
     auto securityContextSsl = (SecurityContextSsl*)securityContext;
-    
+    if (securityContextSsl->KernelTlsSendEnabled())
+    {
+        // records are built by kernel TLS on the socket, frame is sent as plaintext
+        return ErrorCode();
+    }
+
     //LINUXTODO avoid data copying during encryption
     ByteBuffer2 buffer(header_.FrameLength());
     TcpConnection::WriteNoise(
@@ -309,8 +320,15 @@ ErrorCode TcpSendBuffer::Prepare()
             connection_->Close_CallerHoldingLock(true,error);
             return error;
         }
+
+        if (LatencyRecordingEnabled())
+        {
+            RecordQueueingDelay(now - cur->EnqueueTime());
+        }
     }
 
+    sendStartTime_ = now;
+
     perfCounters_->AverageTcpSendSizeBase.Increment();
     perfCounters_->AverageTcpSendSize.IncrementBy(sendingLength_);
     return error;
@@ -325,6 +343,10 @@ void TcpSendBuffer::Consume(size_t length)
 
     Invariant(totalBufferedBytes_ > 0 && (size_t)totalBufferedBytes_ >= length);
     Invariant(length == sendingLength_);
+    if (LatencyRecordingEnabled())
+    {
+        RecordSocketSendTime(Stopwatch::Now() - sendStartTime_);
+    }
 
     auto messageCountBefore = MessageCount();
     auto totalBufferedBytesBefore = totalBufferedBytes_;
@@ -465,7 +487,7 @@ void TcpSendBuffer::EnqueueImpl(MessageUPtr && message, TimeSpan expiration, boo
             (uint32)totalBufferedBytes_);
     }
 
-    messageQueue_.emplace_back(move(message), securityProviderMask_, expiration, shouldEncrypt);
+    messageQueue_.emplace_back(move(message), securityProviderMask_, expiration, shouldEncrypt, LatencyRecordingEnabled());
     totalBufferedBytes_ += messageQueue_.back().FrameLength();
 }
 
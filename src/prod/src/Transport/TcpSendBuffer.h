@@ -18,7 +18,8 @@ namespace Transport
                 MessageUPtr && message,
                 byte securityProviderMask,
                 Common::TimeSpan expiration,
-                bool shouldEncrypt);
+                bool shouldEncrypt,
+                bool recordEnqueueTime);
 
             ~Frame();
 
@@ -32,6 +33,7 @@ namespace Transport
 
             bool HasExpired(Common::StopwatchTime now) const; // HasExpired => ! IsInUse
             bool IsInUse() const;
+            Common::StopwatchTime EnqueueTime() const { return enqueueTime_; }
 
         private:
             Common::ErrorCode EncryptIfNeeded(TcpSendBuffer & sendBuffer);
@@ -39,6 +41,7 @@ namespace Transport
             TcpFrameHeader header_;
             MessageUPtr message_;
             Common::StopwatchTime expiration_;
+            Common::StopwatchTime enqueueTime_;
             bool shouldEncrypt_;
             bool preparedForSending_;
 
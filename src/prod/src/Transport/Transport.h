@@ -60,6 +60,7 @@
 #include "TransportFlags.h"
 #include "TransportPriority.h"
 #include "ISendTarget.h"
+#include "LatencyHistogram.h"
 #include "RequestTable.h"
 #include "RequestAsyncOperation.h"
 #include "IDatagramTransport.h"
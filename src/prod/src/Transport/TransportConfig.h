@@ -50,6 +50,18 @@ namespace Transport
 
         // TCP send batch size limit in bytes
         INTERNAL_CONFIG_ENTRY(uint, L"Transport", SendBatchSizeLimit, 16 * 1024 * 1024, Common::ConfigEntryUpgradePolicy::Static, Common::UIntNoLessThan(64 * 1024));
+        // Linux only: send batches of at least this many bytes are sent with MSG_ZEROCOPY, their buffers are
+        // released when the kernel reports completion instead of when sendmsg returns. Set to 0 to disable.
+        INTERNAL_CONFIG_ENTRY(uint, L"Transport", ZeroCopySendThreshold, 0, Common::ConfigEntryUpgradePolicy::Static);
+
+        // Delay before sending small messages queued on an idle connection, so that messages sent in a burst
+        // to the same target share one socket send, separately for normal and high priority connections.
+        // Set to 0 to disable coalescing.
+        INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Transport", SendCoalescingWindow, Common::TimeSpan::Zero, Common::ConfigEntryUpgradePolicy::Static, Common::TimeSpanNoLessThan(Common::TimeSpan::Zero));
+        INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Transport", SendCoalescingWindowHighPriority, Common::TimeSpan::Zero, Common::ConfigEntryUpgradePolicy::Static, Common::TimeSpanNoLessThan(Common::TimeSpan::Zero));
+        // Messages of at least this size are sent without coalescing delay, coalesced messages are
+        // also flushed once their total size reaches this limit
+        INTERNAL_CONFIG_ENTRY(uint, L"Transport", SendCoalescingSizeLimit, 16 * 1024, Common::ConfigEntryUpgradePolicy::Static, Common::UIntGreaterThan(0));
 
         // Specify threshold for MessageHeaders::CompactIfNeeded, which compacts if the byte count of all headers marked for deletion is beyond threshold
         INTERNAL_CONFIG_ENTRY(uint, L"Transport", MessageHeaderCompactThreshold, 512, Common::ConfigEntryUpgradePolicy::Static);
@@ -57,15 +69,26 @@ namespace Transport
         // Receive chunk size for non-secure mode
         INTERNAL_CONFIG_ENTRY(uint, L"Transport", DefaultReceiveChunkSize, 4*1024, Common::ConfigEntryUpgradePolicy::Static, Common::InRange<uint>(3, 8*1024*1024));
 
+        // Upper limit of free receive buffer chunks kept for reuse, per receive chunk size. Pooled chunks are not returned
+        // to the heap, so memory used by pooling stays at its peak up to this limit. 0 disables pooling.
+        INTERNAL_CONFIG_ENTRY(uint, L"Transport", ReceiveBufferPoolSizeInMB, 0, Common::ConfigEntryUpgradePolicy::Static);
+
         // Chunk size of SSL receive buffer, it must be at least twice as large as SSL record size:
         // SecPkgContext_StreamSizes{cbHeader + cbMaximumMessage + cbTrailer}
         INTERNAL_CONFIG_ENTRY(uint, L"Transport", SslReceiveChunkSize, 64*1024, Common::ConfigEntryUpgradePolicy::Static, Common::InRange<uint>(32*1024, 8*1024*1024));
+        // Linux only: once TLS 1.2 AES-GCM session is established, hand send direction encryption over to
+        // kernel TLS (TLS_TX), connections fall back to OpenSSL encryption when kernel or cipher is not supported
+        INTERNAL_CONFIG_ENTRY(bool, L"Transport", KernelTlsSendEnabled, false, Common::ConfigEntryUpgradePolicy::Static);
 
         // Indicate how long an outgoing message can be queued until being sent or dropped, set to 0 to disable
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Transport", DefaultOutgoingMessageExpiration, Common::TimeSpan::FromSeconds(180), Common::ConfigEntryUpgradePolicy::Static, Common::TimeSpanNoLessThan(Common::TimeSpan::Zero));
         // Indicate how often periodic outgoing message expiration check is done, set to 0 to disable
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Transport", OutgoingMessageExpirationCheckInterval, Common::TimeSpan::FromSeconds(30), Common::ConfigEntryUpgradePolicy::Static);
 
+        // Interval of reporting latency histograms, i.e. send queueing delay, socket send time and request reply latency
+        // per actor, to trace and percentile perf counters. Histograms are reset after each report. Set to 0 to disable recording.
+        INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Transport", LatencyReportInterval, Common::TimeSpan::FromSeconds(60), Common::ConfigEntryUpgradePolicy::Static, Common::TimeSpanNoLessThan(Common::TimeSpan::Zero));
+
         // Interval of periodic listener state trace, set to 0 to disable.
         INTERNAL_CONFIG_ENTRY(Common::TimeSpan, L"Transport", ListenerStateTraceInterval, Common::TimeSpan::FromMinutes(60), Common::ConfigEntryUpgradePolicy::Static, Common::TimeSpanNoLessThan(Common::TimeSpan::Zero));
 
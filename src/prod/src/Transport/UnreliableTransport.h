@@ -97,6 +97,7 @@ namespace Transport
         void SetEventLoopPool(Common::EventLoopPool* pool) override; 
         void SetEventLoopReadDispatch(bool asyncDispatch) override { innerTransport_->SetEventLoopReadDispatch(asyncDispatch); }
         void SetEventLoopWriteDispatch(bool asyncDispatch) override { innerTransport_->SetEventLoopWriteDispatch(asyncDispatch); }
+        void SetSocketPriority(int priority) override { innerTransport_->SetSocketPriority(priority); }
 #endif
 
         static void AddPartitionIdToMessageProperty(Transport::Message & message, Common::Guid const & partitionId);
@@ -11,6 +11,84 @@ using namespace Transport;
 
 static const StringLiteral TraceType("RequestReply");
 
+namespace
+{
+    //
+    // Latency from sending request to receiving reply, of successful requests of all RequestReply
+    // objects in the process, overall and per actor. Perf counters use one process wide instance
+    // with a stable name, so that they can be tracked across runs. Recording is lock free, samples
+    // are reported and reset from a timer every LatencyReportInterval.
+    //
+    class ProcessRequestLatency
+    {
+        DENY_COPY(ProcessRequestLatency);
+
+    public:
+        // returns null when latency reporting is disabled
+        static ProcessRequestLatency * Get()
+        {
+            // never deleted, RequestReply objects may be destructed during process exit
+            static ProcessRequestLatency* instance = Create();
+            return instance;
+        }
+
+        void Record(Actor::Enum actor, TimeSpan latency)
+        {
+            latency_.Record(latency);
+            actorLatency_.Record(actor, latency);
+        }
+
+    private:
+        static ProcessRequestLatency * Create()
+        {
+            auto reportInterval = TransportConfig::GetConfig().LatencyReportInterval;
+            return (reportInterval > TimeSpan::Zero) ? new ProcessRequestLatency(reportInterval) : nullptr;
+        }
+
+        ProcessRequestLatency(TimeSpan reportInterval)
+            : perfCounters_(PerfCounters::CreateInstance(wformatString("{0}-RequestReply", ::GetCurrentProcessId())))
+        {
+            reportTimer_ = Timer::Create(
+                "RequestReplyLatencyReport",
+                [this](TimerSPtr const &) { Report(); },
+                false);
+
+            reportTimer_->Change(reportInterval, reportInterval);
+        }
+
+        void Report()
+        {
+            LatencyHistogram latency;
+            latency_.TakeSnapshot(latency);
+            if (latency.Count() == 0) return;
+
+            perfCounters_->RequestReplyLatencyP50.Value = latency.PercentileMicroseconds(50);
+            perfCounters_->RequestReplyLatencyP99.Value = latency.PercentileMicroseconds(99);
+
+            vector<unique_ptr<LatencyHistogram>> actorLatency;
+            actorLatency_.TakeSnapshot(actorLatency);
+
+            wstring perActor;
+            StringWriter w(perActor);
+            for (size_t i = 0; i < actorLatency.size(); ++i)
+            {
+                if (!actorLatency[i] || (actorLatency[i]->Count() == 0)) continue;
+
+                w.Write("\r\n");
+                ActorLatencyHistograms::WriteActorName(w, i);
+                w.Write(": {0}", *actorLatency[i]);
+            }
+
+            WriteInfo(TraceType, "request reply latency: {0}\r\nper actor:{1}", latency, perActor);
+        }
+
+        PerfCountersSPtr const perfCounters_;
+        ShardedLatencyHistogram latency_;
+        ActorLatencyHistograms actorLatency_;
+        TimerSPtr reportTimer_;
+    };
+}
+
 class RequestReply::RequestReplyAsyncOperation : public AsyncOperation
 {
     DENY_COPY(RequestReplyAsyncOperation);
@@ -68,6 +146,13 @@ protected:
             request_->Headers.Add(MessageIdHeader(MessageId()));
         }
 
+        latency_ = ProcessRequestLatency::Get();
+        if (latency_)
+        {
+            actor_ = request_->Actor;
+            startTime_ = Stopwatch::Now();
+        }
+
         MessageId const & id = request_->MessageId;
         RequestAsyncOperationSPtr operation = std::make_shared<RequestAsyncOperation>(
             this->requestReply_.requestTable_,
@@ -154,7 +239,13 @@ private:
 
     void FinishRequest(AsyncOperationSPtr const & operation)
     {
-        TryComplete(operation->Parent, RequestAsyncOperation::End(operation, reply_));
+        auto error = RequestAsyncOperation::End(operation, reply_);
+        if (error.IsSuccess() && latency_)
+        {
+            latency_->Record(actor_, Stopwatch::Now() - startTime_);
+        }
+
+        TryComplete(operation->Parent, error);
     }
 
   //Caller of this Async Operation needs to make sure requestReply  is alive till this  AsyncOperation is destructed.
@@ -165,6 +256,9 @@ private:
     TimeSpan const timeout_;
     MessageUPtr reply_;
     bool requestSendCompleted_;
+    ProcessRequestLatency * latency_ = nullptr;
+    Actor::Enum actor_ = Actor::Empty;
+    StopwatchTime startTime_;
 };
 
 RequestReply::RequestReply(
@@ -16,12 +16,42 @@
 #include <ifaddrs.h>
 #include <sys/uio.h>
 #include <sys/epoll.h>
+#include <linux/errqueue.h>
 #include <openssl/bio.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
+#include <openssl/hmac.h>
 #include <openssl/ssl.h>
 #include "Common/CryptoUtility.Linux.h"
 #include "Transport/TransportSecurity.Linux.h"
+
+// MSG_ZEROCOPY support, kernel 4.14+, may be missing from older libc headers
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
+
+// kernel TLS support, kernel 4.13+, header may be missing from older kernel headers
+#if defined(__has_include)
+#if __has_include(<linux/tls.h>)
+#include <linux/tls.h>
+#define KERNEL_TLS_SUPPORTED 1
+#endif
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
 #else
 #include <schannel.h>
 #include <Ws2tcpip.h>
@@ -38,6 +68,7 @@
 #include "Transport/SecurityNegotiationHeader.h"
 #include "Transport/IConnection.h"
 #include "Transport/IoBuffer.h"
+#include "Transport/ReceiveBufferPool.h"
 #include "Transport/ReceiveBuffer.h"
 #include "Transport/TcpReceiveBuffer.h"
 #include "Transport/SendBuffer.h"
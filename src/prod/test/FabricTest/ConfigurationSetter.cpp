@@ -377,6 +377,7 @@ void ConfigurationSetter::PopulateConfigMap()
     AddMapEntry(StoreConfig::GetConfig().EnableTombstoneCleanup2Entry);
     AddMapEntry(StoreConfig::GetConfig().EnableReferenceTrackingEntry, L"StoreEnableReferenceTracking");
     AddMapEntry(StoreConfig::GetConfig().TStoreInitializationRetryDelayEntry);
+    AddMapEntry(StoreConfig::GetConfig().SecondaryApplyParallelismEntry);
     #pragma endregion "StoreConfig"
 
     #pragma region "TransportConfig"